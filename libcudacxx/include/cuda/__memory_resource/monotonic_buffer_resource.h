@@ -0,0 +1,227 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA__MEMORY_RESOURCE_MONOTONIC_BUFFER_RESOURCE_H
+#define _CUDA__MEMORY_RESOURCE_MONOTONIC_BUFFER_RESOURCE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if !defined(_CCCL_COMPILER_MSVC_2017) && defined(LIBCUDACXX_ENABLE_EXPERIMENTAL_MEMORY_RESOURCE) \
+  && !defined(_CCCL_COMPILER_NVRTC)
+
+#  include <cuda/__memory_resource/get_property.h>
+#  include <cuda/__memory_resource/new_delete_resource.h>
+#  include <cuda/__memory_resource/resource.h>
+#  include <cuda/__memory_resource/resource_ref.h>
+#  include <cuda/std/__new/bad_alloc.h>
+#  include <cuda/std/cstdint>
+
+#  if _CCCL_STD_VER >= 2014
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA_MR
+
+//! @brief monotonic_buffer_resource hands out memory from chunks obtained from an upstream resource by bumping a
+//! pointer and only reclaims it in bulk.
+//! @rst
+//! ``deallocate`` is a no-op. Memory is recycled by ``reset``, which rewinds to the start of the first chunk while
+//! keeping all chunks for reuse, or returned to the upstream resource by ``release`` and the destructor. Chunks grow
+//! geometrically, so a workload that repeatedly allocates the same amount between two calls to ``reset`` stops
+//! allocating from the upstream resource after the first iteration.
+//!
+//! Allocation only performs pointer arithmetic on the chunks, which allows using memory that is not host accessible.
+//!
+//! .. note::
+//!
+//!    monotonic_buffer_resource is not synchronized. Concurrent calls to ``allocate`` require external
+//!    synchronization.
+//!
+//! @endrst
+//! @tparam _Properties The properties of the upstream resource, which are also the properties of the arena
+template <class... _Properties>
+class monotonic_buffer_resource
+    : public ::cuda::forward_property<monotonic_buffer_resource<_Properties...>, resource_ref<_Properties...>>
+{
+  static constexpr size_t __default_initial_size = 4096;
+  static constexpr size_t __growth_factor        = 2;
+
+  struct __chunk
+  {
+    void* __ptr;
+    size_t __size;
+    size_t __alignment;
+    __chunk* __next;
+  };
+
+  resource_ref<_Properties...> __upstream_;
+  size_t __next_size_;
+  // Chunks in allocation order; __current_ is the one that is being bumped
+  __chunk* __first_   = nullptr;
+  __chunk* __last_    = nullptr;
+  __chunk* __current_ = nullptr;
+  size_t __offset_    = 0;
+
+  //! @brief Checks whether \p __bytes aligned to \p __alignment fit into \p __node at or after \p __offset. If so,
+  //! advances \p __offset to the start of the allocation
+  static bool __fits(const __chunk* __node, size_t& __offset, const size_t __bytes, const size_t __alignment) noexcept
+  {
+    const _CUDA_VSTD::uintptr_t __base = reinterpret_cast<_CUDA_VSTD::uintptr_t>(__node->__ptr);
+    const size_t __padding             = static_cast<size_t>((~(__base + __offset) + 1) & (__alignment - 1));
+    if (__offset + __padding > __node->__size || __node->__size - __offset - __padding < __bytes)
+    {
+      return false;
+    }
+    __offset += __padding;
+    return true;
+  }
+
+  void __append_chunk(const size_t __bytes, const size_t __alignment)
+  {
+    size_t __size = __next_size_;
+    while (__size < __bytes)
+    {
+      __size *= __growth_factor;
+    }
+    const size_t __chunk_alignment = __alignment > default_host_alignment ? __alignment : default_host_alignment;
+
+    __chunk* __new = new __chunk{nullptr, __size, __chunk_alignment, nullptr};
+#    ifndef _LIBCUDACXX_NO_EXCEPTIONS
+    try
+    {
+      __new->__ptr = __upstream_.allocate(__size, __chunk_alignment);
+    }
+    catch (...)
+    {
+      delete __new;
+      throw;
+    }
+#    else // ^^^ !_LIBCUDACXX_NO_EXCEPTIONS ^^^ / vvv _LIBCUDACXX_NO_EXCEPTIONS vvv
+    __new->__ptr = __upstream_.allocate(__size, __chunk_alignment);
+#    endif // _LIBCUDACXX_NO_EXCEPTIONS
+
+    if (__last_ != nullptr)
+    {
+      __last_->__next = __new;
+    }
+    else
+    {
+      __first_ = __new;
+    }
+    __last_      = __new;
+    __next_size_ = __size * __growth_factor;
+  }
+
+public:
+  //! @brief Constructs an arena on top of \p __upstream
+  //! @param __upstream The resource that provides the chunks. It must outlive the arena
+  //! @param __initial_size The size of the first chunk that is requested from \p __upstream
+  explicit monotonic_buffer_resource(resource_ref<_Properties...> __upstream,
+                                     const size_t __initial_size = __default_initial_size) noexcept
+      : __upstream_(__upstream)
+      , __next_size_(__initial_size != 0 ? __initial_size : 1)
+  {}
+
+  monotonic_buffer_resource(const monotonic_buffer_resource&)            = delete;
+  monotonic_buffer_resource& operator=(const monotonic_buffer_resource&) = delete;
+
+  //! @brief Returns all chunks to the upstream resource
+  ~monotonic_buffer_resource()
+  {
+    release();
+  }
+
+  //! @brief Allocate memory of size at least \p __bytes.
+  //! @param __bytes The size in bytes of the allocation.
+  //! @param __alignment The requested alignment of the allocation.
+  //! @throw std::bad_alloc if the alignment is not a power of two or the upstream resource fails to allocate.
+  //! @return Pointer to the newly allocated memory
+  _CCCL_NODISCARD void* allocate(const size_t __bytes, const size_t __alignment = default_host_alignment)
+  {
+    if (!__is_power_of_two(__alignment))
+    {
+      _CUDA_VSTD::__throw_bad_alloc();
+    }
+
+    // Skip over the kept chunks after a reset until one fits, then append a new one
+    while (__current_ == nullptr || !__fits(__current_, __offset_, __bytes, __alignment))
+    {
+      __chunk* __next = __current_ != nullptr ? __current_->__next : __first_;
+      if (__next == nullptr)
+      {
+        __append_chunk(__bytes, __alignment);
+        __next = __last_;
+      }
+      __current_ = __next;
+      __offset_  = 0;
+    }
+
+    void* __ptr = static_cast<char*>(__current_->__ptr) + __offset_;
+    __offset_ += __bytes;
+    return __ptr;
+  }
+
+  //! @brief Does nothing, memory is only reclaimed by \c reset and \c release
+  void deallocate(void*, const size_t, const size_t = default_host_alignment) noexcept {}
+
+  //! @brief Makes all memory available again without returning any chunk to the upstream resource. Invalidates all
+  //! previous allocations
+  void reset() noexcept
+  {
+    __current_ = nullptr;
+    __offset_  = 0;
+  }
+
+  //! @brief Returns all chunks to the upstream resource. Invalidates all previous allocations
+  void release() noexcept
+  {
+    while (__first_ != nullptr)
+    {
+      __chunk* __node = __first_;
+      __first_        = __node->__next;
+      __upstream_.deallocate(__node->__ptr, __node->__size, __node->__alignment);
+      delete __node;
+    }
+    __last_ = nullptr;
+    reset();
+  }
+
+  //! @brief Returns the upstream resource, which is also used to forward stateful properties
+  _CCCL_NODISCARD resource_ref<_Properties...> upstream_resource() const noexcept
+  {
+    return __upstream_;
+  }
+
+  //! @brief Equality comparison with another \c monotonic_buffer_resource
+  //! @return true if both refer to the same arena
+  _CCCL_NODISCARD bool operator==(monotonic_buffer_resource const& __other) const noexcept
+  {
+    return this == &__other;
+  }
+  //! @brief Inequality comparison with another \c monotonic_buffer_resource
+  _CCCL_NODISCARD bool operator!=(monotonic_buffer_resource const& __other) const noexcept
+  {
+    return this != &__other;
+  }
+};
+
+_LIBCUDACXX_END_NAMESPACE_CUDA_MR
+
+#  endif // _CCCL_STD_VER >= 2014
+
+#endif // !_CCCL_COMPILER_MSVC_2017 && LIBCUDACXX_ENABLE_EXPERIMENTAL_MEMORY_RESOURCE && !_CCCL_COMPILER_NVRTC
+
+#endif //_CUDA__MEMORY_RESOURCE_MONOTONIC_BUFFER_RESOURCE_H
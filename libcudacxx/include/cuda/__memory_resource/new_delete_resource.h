@@ -0,0 +1,149 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA__MEMORY_RESOURCE_NEW_DELETE_RESOURCE_H
+#define _CUDA__MEMORY_RESOURCE_NEW_DELETE_RESOURCE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if !defined(_CCCL_COMPILER_MSVC_2017) && defined(LIBCUDACXX_ENABLE_EXPERIMENTAL_MEMORY_RESOURCE) \
+  && !defined(_CCCL_COMPILER_NVRTC)
+
+#  include <cuda/__memory_resource/get_property.h>
+#  include <cuda/__memory_resource/properties.h>
+#  include <cuda/__memory_resource/resource.h>
+#  include <cuda/__memory_resource/resource_ref.h>
+#  include <cuda/std/__new/allocate.h>
+#  include <cuda/std/__new/bad_alloc.h>
+
+#  if _CCCL_STD_VER >= 2014
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA_MR
+
+//! @brief The default alignment of allocations from the host memory resources
+_LIBCUDACXX_INLINE_VAR constexpr size_t default_host_alignment = alignof(_CUDA_VSTD::max_align_t);
+
+//! @brief Checks whether \p __alignment is a power of two
+_LIBCUDACXX_INLINE_VISIBILITY constexpr bool __is_power_of_two(const size_t __alignment) noexcept
+{
+  return __alignment != 0 && (__alignment & (__alignment - 1)) == 0;
+}
+
+//! @brief new_delete_resource uses the global `operator new` / `operator delete` for allocation / deallocation.
+class new_delete_resource
+{
+public:
+  //! @brief Allocate host memory of size at least \p __bytes.
+  //! @param __bytes The size in bytes of the allocation.
+  //! @param __alignment The requested alignment of the allocation.
+  //! @throw std::bad_alloc if the allocation fails or the alignment is not supported.
+  //! @return Pointer to the newly allocated memory
+  _CCCL_NODISCARD void* allocate(const size_t __bytes, const size_t __alignment = default_host_alignment) const
+  {
+    if (!__is_valid_alignment(__alignment))
+    {
+      _CUDA_VSTD::__throw_bad_alloc();
+    }
+
+    return _CUDA_VSTD::__libcpp_allocate(__bytes, __alignment);
+  }
+
+  //! @brief Deallocate memory pointed to by \p __ptr.
+  //! @param __ptr Pointer to be deallocated. Must have been allocated through a call to `allocate`
+  //! @param __bytes The number of bytes that was passed to the `allocate` call that returned \p __ptr.
+  //! @param __alignment The alignment that was passed to the `allocate` call that returned \p __ptr.
+  void deallocate(void* __ptr, const size_t __bytes, const size_t __alignment = default_host_alignment) const noexcept
+  {
+    _LIBCUDACXX_ASSERT(__is_valid_alignment(__alignment),
+                       "Invalid alignment passed to new_delete_resource::deallocate.");
+    _CUDA_VSTD::__libcpp_deallocate(__ptr, __bytes, __alignment);
+  }
+
+  //! @brief Equality comparison with another \c new_delete_resource
+  //! @return true, all \c new_delete_resource share the global heap
+  _CCCL_NODISCARD constexpr bool operator==(new_delete_resource const&) const noexcept
+  {
+    return true;
+  }
+#    if _CCCL_STD_VER <= 2017
+  //! @brief Inequality comparison with another \c new_delete_resource
+  //! @return false, all \c new_delete_resource share the global heap
+  _CCCL_NODISCARD constexpr bool operator!=(new_delete_resource const&) const noexcept
+  {
+    return false;
+  }
+#    endif // _CCCL_STD_VER <= 2017
+
+  //! @brief Equality comparison between a \c new_delete_resource and another resource
+  //! @param __lhs The \c new_delete_resource
+  //! @param __rhs The resource to compare to
+  //! @return If the underlying types are equality comparable, returns the result of equality comparison of both
+  //! resources. Otherwise, returns false.
+  template <class _Resource>
+  _CCCL_NODISCARD_FRIEND auto operator==(new_delete_resource const& __lhs, _Resource const& __rhs) noexcept
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(__different_resource<new_delete_resource, _Resource>)
+  {
+    return resource_ref<>{const_cast<new_delete_resource&>(__lhs)} == resource_ref<>{const_cast<_Resource&>(__rhs)};
+  }
+#    if _CCCL_STD_VER <= 2017
+  //! @copydoc new_delete_resource::operator<_Resource>==(new_delete_resource const&, _Resource const&)
+  template <class _Resource>
+  _CCCL_NODISCARD_FRIEND auto operator==(_Resource const& __rhs, new_delete_resource const& __lhs) noexcept
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(__different_resource<new_delete_resource, _Resource>)
+  {
+    return resource_ref<>{const_cast<new_delete_resource&>(__lhs)} == resource_ref<>{const_cast<_Resource&>(__rhs)};
+  }
+  //! @copydoc new_delete_resource::operator<_Resource>==(new_delete_resource const&, _Resource const&)
+  template <class _Resource>
+  _CCCL_NODISCARD_FRIEND auto operator!=(new_delete_resource const& __lhs, _Resource const& __rhs) noexcept
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(__different_resource<new_delete_resource, _Resource>)
+  {
+    return resource_ref<>{const_cast<new_delete_resource&>(__lhs)} != resource_ref<>{const_cast<_Resource&>(__rhs)};
+  }
+  //! @copydoc new_delete_resource::operator<_Resource>==(new_delete_resource const&, _Resource const&)
+  template <class _Resource>
+  _CCCL_NODISCARD_FRIEND auto operator!=(_Resource const& __rhs, new_delete_resource const& __lhs) noexcept
+    _LIBCUDACXX_TRAILING_REQUIRES(bool)(__different_resource<new_delete_resource, _Resource>)
+  {
+    return resource_ref<>{const_cast<new_delete_resource&>(__lhs)} != resource_ref<>{const_cast<_Resource&>(__rhs)};
+  }
+#    endif // _CCCL_STD_VER <= 2017
+
+  //! @brief Enables the \c host_accessible property
+  friend constexpr void get_property(new_delete_resource const&, host_accessible) noexcept {}
+
+  //! @brief Checks whether the passed in alignment is valid
+  static constexpr bool __is_valid_alignment(const size_t __alignment) noexcept
+  {
+#    ifdef _LIBCUDACXX_HAS_NO_ALIGNED_ALLOCATION
+    // without aligned new, over-aligned requests would silently receive less
+    return __is_power_of_two(__alignment) && !_CUDA_VSTD::__is_overaligned_for_new(__alignment);
+#    else // ^^^ _LIBCUDACXX_HAS_NO_ALIGNED_ALLOCATION ^^^ / vvv !_LIBCUDACXX_HAS_NO_ALIGNED_ALLOCATION vvv
+    return __is_power_of_two(__alignment);
+#    endif // !_LIBCUDACXX_HAS_NO_ALIGNED_ALLOCATION
+  }
+};
+static_assert(resource_with<new_delete_resource, host_accessible>, "");
+
+_LIBCUDACXX_END_NAMESPACE_CUDA_MR
+
+#  endif // _CCCL_STD_VER >= 2014
+
+#endif // !_CCCL_COMPILER_MSVC_2017 && LIBCUDACXX_ENABLE_EXPERIMENTAL_MEMORY_RESOURCE && !_CCCL_COMPILER_NVRTC
+
+#endif //_CUDA__MEMORY_RESOURCE_NEW_DELETE_RESOURCE_H
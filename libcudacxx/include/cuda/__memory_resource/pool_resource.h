@@ -0,0 +1,235 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA__MEMORY_RESOURCE_POOL_RESOURCE_H
+#define _CUDA__MEMORY_RESOURCE_POOL_RESOURCE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if !defined(_CCCL_COMPILER_MSVC_2017) && defined(LIBCUDACXX_ENABLE_EXPERIMENTAL_MEMORY_RESOURCE) \
+  && !defined(_CCCL_COMPILER_NVRTC)
+
+#  include <cuda/__memory_resource/get_property.h>
+#  include <cuda/__memory_resource/new_delete_resource.h>
+#  include <cuda/__memory_resource/resource.h>
+#  include <cuda/__memory_resource/resource_ref.h>
+#  include <cuda/std/limits>
+
+#  if _CCCL_STD_VER >= 2014
+
+_LIBCUDACXX_BEGIN_NAMESPACE_CUDA_MR
+
+//! @brief Tuning knobs of a \c pool_resource
+struct pool_options
+{
+  //! @brief Requests larger than this are passed through to the upstream resource without pooling
+  size_t largest_pooled_block = size_t{1} << 20;
+  //! @brief Upper bound on the number of bytes cached in the pool. Blocks deallocated beyond it are returned to the
+  //! upstream resource
+  size_t release_threshold = _CUDA_VSTD::numeric_limits<size_t>::max();
+};
+
+//! @brief pool_resource caches deallocated blocks in power of two size classes and serves subsequent allocations
+//! of the same class from that cache instead of the upstream resource.
+//! @rst
+//! Each block is obtained individually from the upstream resource, so any block can be returned to it at any time.
+//! The bookkeeping lives on the host and never touches the pooled memory, which allows pooling memory that is not
+//! host accessible.
+//!
+//! .. note::
+//!
+//!    pool_resource is not synchronized. Concurrent calls to ``allocate`` and ``deallocate`` require external
+//!    synchronization.
+//!
+//! @endrst
+//! @tparam _Properties The properties of the upstream resource, which are also the properties of the pool
+template <class... _Properties>
+class pool_resource : public ::cuda::forward_property<pool_resource<_Properties...>, resource_ref<_Properties...>>
+{
+  // Blocks no larger than this are pooled in the smallest size class
+  static constexpr size_t __min_block_log2 = 4;
+  static constexpr size_t __num_classes    = _CUDA_VSTD::numeric_limits<size_t>::digits;
+
+  struct __block_node
+  {
+    void* __ptr;
+    __block_node* __next;
+  };
+
+  resource_ref<_Properties...> __upstream_;
+  pool_options __options_;
+  size_t __cached_bytes_ = 0;
+  __block_node* __free_lists_[__num_classes] = {};
+  // Unused nodes, recycled so that caching a block rarely needs a host allocation
+  __block_node* __spare_nodes_ = nullptr;
+
+  static size_t __size_class(const size_t __bytes) noexcept
+  {
+    size_t __log2 = __min_block_log2;
+    while ((size_t{1} << __log2) < __bytes)
+    {
+      ++__log2;
+    }
+    return __log2;
+  }
+
+  bool __is_pooled(const size_t __bytes, const size_t __alignment) const noexcept
+  {
+    return __bytes <= __options_.largest_pooled_block && __bytes <= (size_t{1} << (__num_classes - 1))
+        && __alignment <= default_host_alignment;
+  }
+
+public:
+  //! @brief Constructs a pool on top of \p __upstream
+  //! @param __upstream The resource that provides the pooled blocks. It must outlive the pool
+  //! @param __options The tuning knobs of the pool
+  explicit pool_resource(resource_ref<_Properties...> __upstream, pool_options __options = {}) noexcept
+      : __upstream_(__upstream)
+      , __options_(__options)
+  {}
+
+  pool_resource(const pool_resource&)            = delete;
+  pool_resource& operator=(const pool_resource&) = delete;
+
+  //! @brief Returns all cached blocks to the upstream resource
+  ~pool_resource()
+  {
+    release();
+    while (__spare_nodes_ != nullptr)
+    {
+      __block_node* __node = __spare_nodes_;
+      __spare_nodes_       = __node->__next;
+      delete __node;
+    }
+  }
+
+  //! @brief Allocate memory of size at least \p __bytes.
+  //! @param __bytes The size in bytes of the allocation.
+  //! @param __alignment The requested alignment of the allocation.
+  //! @throw std::bad_alloc if the upstream resource fails to allocate.
+  //! @return Pointer to the newly allocated memory
+  _CCCL_NODISCARD void* allocate(const size_t __bytes, const size_t __alignment = default_host_alignment)
+  {
+    if (!__is_pooled(__bytes, __alignment))
+    {
+      return __upstream_.allocate(__bytes, __alignment);
+    }
+
+    const size_t __class = __size_class(__bytes);
+    if (__block_node* __node = __free_lists_[__class])
+    {
+      __free_lists_[__class] = __node->__next;
+      __node->__next         = __spare_nodes_;
+      __spare_nodes_         = __node;
+      __cached_bytes_ -= size_t{1} << __class;
+      return __node->__ptr;
+    }
+
+    return __upstream_.allocate(size_t{1} << __class, default_host_alignment);
+  }
+
+  //! @brief Deallocate memory pointed to by \p __ptr.
+  //! @param __ptr Pointer to be deallocated. Must have been allocated through a call to `allocate`
+  //! @param __bytes The number of bytes that was passed to the `allocate` call that returned \p __ptr.
+  //! @param __alignment The alignment that was passed to the `allocate` call that returned \p __ptr.
+  void deallocate(void* __ptr, const size_t __bytes, const size_t __alignment = default_host_alignment)
+  {
+    if (!__is_pooled(__bytes, __alignment))
+    {
+      __upstream_.deallocate(__ptr, __bytes, __alignment);
+      return;
+    }
+
+    const size_t __class      = __size_class(__bytes);
+    const size_t __class_size = size_t{1} << __class;
+    if (__class_size > __options_.release_threshold - __cached_bytes_)
+    {
+      __upstream_.deallocate(__ptr, __class_size, default_host_alignment);
+      return;
+    }
+
+    __block_node* __node = __spare_nodes_;
+    if (__node != nullptr)
+    {
+      __spare_nodes_ = __node->__next;
+    }
+    else
+    {
+      __node = new __block_node;
+    }
+
+    __node->__ptr          = __ptr;
+    __node->__next         = __free_lists_[__class];
+    __free_lists_[__class] = __node;
+    __cached_bytes_ += __class_size;
+  }
+
+  //! @brief Returns all cached blocks to the upstream resource. Blocks that are currently allocated are unaffected
+  void release() noexcept
+  {
+    for (size_t __class = 0; __class < __num_classes; ++__class)
+    {
+      while (__block_node* __node = __free_lists_[__class])
+      {
+        __free_lists_[__class] = __node->__next;
+        __upstream_.deallocate(__node->__ptr, size_t{1} << __class, default_host_alignment);
+        __node->__next = __spare_nodes_;
+        __spare_nodes_ = __node;
+      }
+    }
+    __cached_bytes_ = 0;
+  }
+
+  //! @brief Returns the number of bytes held in the cache of the pool
+  _CCCL_NODISCARD size_t cached_bytes() const noexcept
+  {
+    return __cached_bytes_;
+  }
+
+  //! @brief Returns the options the pool was constructed with
+  _CCCL_NODISCARD pool_options options() const noexcept
+  {
+    return __options_;
+  }
+
+  //! @brief Returns the upstream resource, which is also used to forward stateful properties
+  _CCCL_NODISCARD resource_ref<_Properties...> upstream_resource() const noexcept
+  {
+    return __upstream_;
+  }
+
+  //! @brief Equality comparison with another \c pool_resource
+  //! @return true if both refer to the same pool, as memory must be returned to the pool that allocated it
+  _CCCL_NODISCARD bool operator==(pool_resource const& __other) const noexcept
+  {
+    return this == &__other;
+  }
+  //! @brief Inequality comparison with another \c pool_resource
+  _CCCL_NODISCARD bool operator!=(pool_resource const& __other) const noexcept
+  {
+    return this != &__other;
+  }
+};
+
+_LIBCUDACXX_END_NAMESPACE_CUDA_MR
+
+#  endif // _CCCL_STD_VER >= 2014
+
+#endif // !_CCCL_COMPILER_MSVC_2017 && LIBCUDACXX_ENABLE_EXPERIMENTAL_MEMORY_RESOURCE && !_CCCL_COMPILER_NVRTC
+
+#endif //_CUDA__MEMORY_RESOURCE_POOL_RESOURCE_H
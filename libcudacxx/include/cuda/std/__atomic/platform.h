@@ -60,17 +60,49 @@
 #  define LIBCUDACXX_ATOMIC_POINTER_LOCK_FREE  2
 #endif
 
-#define _LIBCUDACXX_ATOMIC_IS_LOCK_FREE(size) (size <= 8)
+// Hosts with a double width compare-and-swap (cmpxchg16b, casp) can update 16
+// byte atomics without a lock. This changes the size and alignment of such
+// atomics, so it is opt-in: every translation unit of the program has to agree
+// on _LIBCUDACXX_ENABLE_HOST_ATOMIC_128. Code built by a CUDA compiler always
+// has the locked layout, most devices lack a 16 byte compare-and-swap.
+#if defined(_LIBCUDACXX_ENABLE_HOST_ATOMIC_128)
+#  if defined(_CCCL_CUDA_COMPILER)
+#    error "_LIBCUDACXX_ENABLE_HOST_ATOMIC_128 is not supported by CUDA compilers."
+#  elif !(defined(_CCCL_COMPILER_GCC) || defined(_CCCL_COMPILER_CLANG)) || defined(_LIBCUDACXX_HAS_NO_INT128) \
+    || !defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+#    error "_LIBCUDACXX_ENABLE_HOST_ATOMIC_128 requires a 16 byte compare-and-swap, e.g. -mcx16 on x86-64."
+#  endif
+#  define _LIBCUDACXX_HAS_HOST_ATOMIC_128
+#endif
+
+#if defined(_LIBCUDACXX_HAS_HOST_ATOMIC_128)
+#  define _LIBCUDACXX_ATOMIC_IS_LOCK_FREE(size) (size <= 8 || size == 16)
+#else
+#  define _LIBCUDACXX_ATOMIC_IS_LOCK_FREE(size) (size <= 8)
+#endif
 
 _LIBCUDACXX_BEGIN_NAMESPACE_STD
 
+template <typename _Tp>
+struct __atomic_is_wide
+{
+  enum
+  {
+#if defined(_LIBCUDACXX_HAS_HOST_ATOMIC_128)
+    __value = sizeof(_Tp) == 16
+#else
+    __value = false
+#endif // defined(_LIBCUDACXX_HAS_HOST_ATOMIC_128)
+  };
+};
+
 #if defined(_LIBCUDACXX_ATOMIC_ALWAYS_LOCK_FREE)
 template <typename _Tp>
 struct __atomic_is_always_lock_free
 {
   enum
   {
-    __value = _LIBCUDACXX_ATOMIC_ALWAYS_LOCK_FREE(sizeof(_Tp), 0)
+    __value = _LIBCUDACXX_ATOMIC_ALWAYS_LOCK_FREE(sizeof(_Tp), 0) || __atomic_is_wide<_Tp>::__value
   };
 };
 #else
@@ -79,7 +111,7 @@ struct __atomic_is_always_lock_free
 {
   enum
   {
-    __value = sizeof(_Tp) <= 8
+    __value = sizeof(_Tp) <= 8 || __atomic_is_wide<_Tp>::__value
   };
 };
 #endif // defined(_LIBCUDACXX_ATOMIC_ALWAYS_LOCK_FREE)
@@ -25,6 +25,7 @@
 #include <cuda/std/__atomic/types/locked.h>
 #include <cuda/std/__atomic/types/reference.h>
 #include <cuda/std/__atomic/types/small.h>
+#include <cuda/std/__atomic/types/wide.h>
 #include <cuda/std/__type_traits/conditional.h>
 
 _LIBCUDACXX_BEGIN_NAMESPACE_STD
@@ -34,6 +35,7 @@ struct __atomic_traits
 {
   static constexpr bool __atomic_requires_lock  = !__atomic_is_always_lock_free<_Tp>::__value;
   static constexpr bool __atomic_requires_small = sizeof(_Tp) < 4;
+  static constexpr bool __atomic_requires_wide  = __atomic_is_wide<_Tp>::__value;
   static constexpr bool __atomic_supports_reference =
     __atomic_is_always_lock_free<_Tp>::__value && (sizeof(_Tp) >= 4 && sizeof(_Tp) <= 8);
 };
@@ -42,7 +44,9 @@ template <typename _Tp>
 using __atomic_storage_t =
   _If<__atomic_traits<_Tp>::__atomic_requires_small,
       __atomic_small_storage<_Tp>,
-      _If<__atomic_traits<_Tp>::__atomic_requires_lock, __atomic_locked_storage<_Tp>, __atomic_storage<_Tp>>>;
+      _If<__atomic_traits<_Tp>::__atomic_requires_lock,
+          __atomic_locked_storage<_Tp>,
+          _If<__atomic_traits<_Tp>::__atomic_requires_wide, __atomic_wide_storage<_Tp>, __atomic_storage<_Tp>>>>;
 
 _LIBCUDACXX_END_NAMESPACE_STD
 
@@ -34,6 +34,7 @@ enum class __atomic_tag
   __atomic_base_tag,
   __atomic_locked_tag,
   __atomic_small_tag,
+  __atomic_wide_tag,
 };
 
 // Helpers to SFINAE on the tag inside the storage object
@@ -44,6 +45,8 @@ using __atomic_storage_is_locked =
   __enable_if_t<__atomic_tag::__atomic_locked_tag == __remove_cvref_t<_Sto>::__tag, int>;
 template <typename _Sto>
 using __atomic_storage_is_small = __enable_if_t<__atomic_tag::__atomic_small_tag == __remove_cvref_t<_Sto>::__tag, int>;
+template <typename _Sto>
+using __atomic_storage_is_wide = __enable_if_t<__atomic_tag::__atomic_wide_tag == __remove_cvref_t<_Sto>::__tag, int>;
 
 template <typename _Tp>
 using __atomic_underlying_t = typename _Tp::__underlying_t;
@@ -0,0 +1,258 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _LIBCUDACXX___ATOMIC_TYPES_WIDE_H
+#define _LIBCUDACXX___ATOMIC_TYPES_WIDE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__atomic/order.h>
+#include <cuda/std/__atomic/platform.h>
+#include <cuda/std/__atomic/scopes.h>
+#include <cuda/std/__atomic/types/common.h>
+#include <cuda/std/__type_traits/is_trivially_copyable.h>
+
+_LIBCUDACXX_BEGIN_NAMESPACE_STD
+
+template <typename _Tp>
+struct __atomic_wide_storage;
+
+#if defined(_LIBCUDACXX_HAS_HOST_ATOMIC_128)
+
+// Wide atomics are opt-in and only available to host compilers, see
+// platform.h. Every update is built on the double width compare-and-swap, which
+// is a full barrier and therefore satisfies any memory order.
+
+using __atomic_wide_word_t = unsigned __int128;
+
+inline bool __atomic_compare_exchange_wide_host(void volatile* __ptr, void* __expected, void const* __desired)
+{
+  __atomic_wide_word_t __old;
+  __atomic_wide_word_t __new;
+  memcpy(&__old, __expected, sizeof(__old));
+  memcpy(&__new, __desired, sizeof(__new));
+  __atomic_wide_word_t const __seen =
+    __sync_val_compare_and_swap(static_cast<__atomic_wide_word_t volatile*>(__ptr), __old, __new);
+  memcpy(__expected, &__seen, sizeof(__seen));
+  return __seen == __old;
+}
+
+// Loads must not write, or atomics in read-only mappings would fault. Aligned
+// 16 byte SSE loads are single-copy atomic on x86-64 processors with AVX (Intel
+// SDM volume 3A, 9.1.1; AMD APM volume 2, 7.3.2). Other hosts fall back to a
+// compare-and-swap that stores back the value it found.
+inline void __atomic_load_wide_host(void const volatile* __ptr, void* __ret)
+{
+  __atomic_wide_word_t __seen = 0;
+#  if defined(__x86_64__)
+  if (__builtin_cpu_supports("avx"))
+  {
+    __asm__ __volatile__("movdqa %1, %0"
+                         : "=x"(__seen)
+                         : "m"(*static_cast<__atomic_wide_word_t const volatile*>(__ptr))
+                         : "memory");
+    memcpy(__ret, &__seen, sizeof(__seen));
+    return;
+  }
+#  endif // __x86_64__
+  // Swapping in whatever we guessed leaves the value unchanged either way.
+  __atomic_compare_exchange_wide_host(const_cast<void volatile*>(__ptr), &__seen, &__seen);
+  memcpy(__ret, &__seen, sizeof(__seen));
+}
+
+template <typename _Tp>
+struct __atomic_wide_storage
+{
+  using __underlying_t                = _Tp;
+  static constexpr __atomic_tag __tag = __atomic_tag::__atomic_wide_tag;
+
+  static_assert(sizeof(_Tp) == sizeof(__atomic_wide_word_t), "wide atomics must be 16 bytes");
+#  if !defined(_CCCL_COMPILER_GCC) || (__GNUC__ >= 5)
+  static_assert(_CCCL_TRAIT(is_trivially_copyable, _Tp),
+                "std::atomic<Tp> requires that 'Tp' be a trivially copyable type");
+#  endif
+
+  _CCCL_ALIGNAS(sizeof(__atomic_wide_word_t)) _Tp __a_value;
+
+  constexpr explicit __atomic_wide_storage() noexcept = default;
+
+  _CCCL_HOST_DEVICE constexpr explicit inline __atomic_wide_storage(_Tp value) noexcept
+      : __a_value(value)
+  {}
+
+  _CCCL_HOST_DEVICE inline auto get() noexcept -> __underlying_t*
+  {
+    return &__a_value;
+  }
+  _CCCL_HOST_DEVICE inline auto get() const noexcept -> const __underlying_t*
+  {
+    return &__a_value;
+  }
+  _CCCL_HOST_DEVICE inline auto get() volatile noexcept -> volatile __underlying_t*
+  {
+    return &__a_value;
+  }
+  _CCCL_HOST_DEVICE inline auto get() const volatile noexcept -> const volatile __underlying_t*
+  {
+    return &__a_value;
+  }
+};
+
+template <typename _Sto>
+void volatile* __atomic_wide_address(_Sto* __a)
+{
+  return const_cast<void volatile*>(static_cast<void const volatile*>(__a->get()));
+}
+
+template <typename _Sto, typename _Up, __atomic_storage_is_wide<_Sto> = 0>
+_CCCL_HOST_DEVICE inline void __atomic_init_dispatch(_Sto* __a, _Up __val)
+{
+  __atomic_assign_volatile(__a->get(), __val);
+}
+
+template <typename _Sto, typename _Sco, __atomic_storage_is_wide<_Sto> = 0>
+_CCCL_HOST_DEVICE inline auto
+__atomic_load_dispatch(const _Sto* __a, memory_order, _Sco = {}) -> __atomic_underlying_t<_Sto>
+{
+  __atomic_underlying_t<_Sto> __ret;
+  __atomic_load_wide_host(__a->get(), &__ret);
+  return __ret;
+}
+
+template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_wide<_Sto> = 0>
+_CCCL_HOST_DEVICE inline auto
+__atomic_exchange_dispatch(_Sto* __a, _Up __value, memory_order, _Sco = {}) -> __atomic_underlying_t<_Sto>
+{
+  using _Tp = __atomic_underlying_t<_Sto>;
+  _Tp const __new = __value;
+  _Tp __old       = __atomic_load_dispatch(__a, memory_order_relaxed, _Sco{});
+  while (!__atomic_compare_exchange_wide_host(__atomic_wide_address(__a), &__old, &__new))
+    ;
+  return __old;
+}
+
+template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_wide<_Sto> = 0>
+_CCCL_HOST_DEVICE inline void __atomic_store_dispatch(_Sto* __a, _Up __val, memory_order __order, _Sco = {})
+{
+  __atomic_exchange_dispatch(__a, __val, __order, _Sco{});
+}
+
+template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_wide<_Sto> = 0>
+_CCCL_HOST_DEVICE inline bool __atomic_compare_exchange_strong_dispatch(
+  _Sto* __a, _Up* __expected, _Up __value, memory_order, memory_order, _Sco = {})
+{
+  return __atomic_compare_exchange_wide_host(__atomic_wide_address(__a), __expected, &__value);
+}
+
+template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_wide<_Sto> = 0>
+_CCCL_HOST_DEVICE inline bool
+__atomic_compare_exchange_weak_dispatch(_Sto* __a, _Up* __expected, _Up __value, memory_order, memory_order, _Sco = {})
+{
+  return __atomic_compare_exchange_wide_host(__atomic_wide_address(__a), __expected, &__value);
+}
+
+// Read-modify-write operations retry the compare-and-swap until no other
+// thread intervened between the load and the update.
+template <typename _Sto, typename _Fn>
+_CCCL_HOST_DEVICE inline auto __atomic_fetch_update_wide(_Sto* __a, _Fn __fn) -> __atomic_underlying_t<_Sto>
+{
+  using _Tp = __atomic_underlying_t<_Sto>;
+  _Tp __old = __atomic_load_dispatch(__a, memory_order_relaxed, __thread_scope_system_tag{});
+  _Tp __new = __fn(__old);
+  while (!__atomic_compare_exchange_wide_host(__atomic_wide_address(__a), &__old, &__new))
+  {
+    __new = __fn(__old);
+  }
+  return __old;
+}
+
+template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_wide<_Sto> = 0>
+_CCCL_HOST_DEVICE inline auto
+__atomic_fetch_add_dispatch(_Sto* __a, _Up __delta, memory_order, _Sco = {}) -> __atomic_underlying_t<_Sto>
+{
+  using _Tp = __atomic_underlying_t<_Sto>;
+  return __atomic_fetch_update_wide(__a, [__delta](_Tp __old) {
+    return _Tp(__old + __delta);
+  });
+}
+
+template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_wide<_Sto> = 0>
+_CCCL_HOST_DEVICE inline auto
+__atomic_fetch_sub_dispatch(_Sto* __a, _Up __delta, memory_order, _Sco = {}) -> __atomic_underlying_t<_Sto>
+{
+  using _Tp = __atomic_underlying_t<_Sto>;
+  return __atomic_fetch_update_wide(__a, [__delta](_Tp __old) {
+    return _Tp(__old - __delta);
+  });
+}
+
+template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_wide<_Sto> = 0>
+_CCCL_HOST_DEVICE inline auto
+__atomic_fetch_and_dispatch(_Sto* __a, _Up __pattern, memory_order, _Sco = {}) -> __atomic_underlying_t<_Sto>
+{
+  using _Tp = __atomic_underlying_t<_Sto>;
+  return __atomic_fetch_update_wide(__a, [__pattern](_Tp __old) {
+    return _Tp(__old & __pattern);
+  });
+}
+
+template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_wide<_Sto> = 0>
+_CCCL_HOST_DEVICE inline auto
+__atomic_fetch_or_dispatch(_Sto* __a, _Up __pattern, memory_order, _Sco = {}) -> __atomic_underlying_t<_Sto>
+{
+  using _Tp = __atomic_underlying_t<_Sto>;
+  return __atomic_fetch_update_wide(__a, [__pattern](_Tp __old) {
+    return _Tp(__old | __pattern);
+  });
+}
+
+template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_wide<_Sto> = 0>
+_CCCL_HOST_DEVICE inline auto
+__atomic_fetch_xor_dispatch(_Sto* __a, _Up __pattern, memory_order, _Sco = {}) -> __atomic_underlying_t<_Sto>
+{
+  using _Tp = __atomic_underlying_t<_Sto>;
+  return __atomic_fetch_update_wide(__a, [__pattern](_Tp __old) {
+    return _Tp(__old ^ __pattern);
+  });
+}
+
+template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_wide<_Sto> = 0>
+_CCCL_HOST_DEVICE inline auto
+__atomic_fetch_max_dispatch(_Sto* __a, _Up __val, memory_order, _Sco = {}) -> __atomic_underlying_t<_Sto>
+{
+  using _Tp = __atomic_underlying_t<_Sto>;
+  return __atomic_fetch_update_wide(__a, [__val](_Tp __old) {
+    return __old < __val ? _Tp(__val) : __old;
+  });
+}
+
+template <typename _Sto, typename _Up, typename _Sco, __atomic_storage_is_wide<_Sto> = 0>
+_CCCL_HOST_DEVICE inline auto
+__atomic_fetch_min_dispatch(_Sto* __a, _Up __val, memory_order, _Sco = {}) -> __atomic_underlying_t<_Sto>
+{
+  using _Tp = __atomic_underlying_t<_Sto>;
+  return __atomic_fetch_update_wide(__a, [__val](_Tp __old) {
+    return __val < __old ? _Tp(__val) : __old;
+  });
+}
+
+#endif // _LIBCUDACXX_HAS_HOST_ATOMIC_128
+
+_LIBCUDACXX_END_NAMESPACE_STD
+
+#endif // _LIBCUDACXX___ATOMIC_TYPES_WIDE_H
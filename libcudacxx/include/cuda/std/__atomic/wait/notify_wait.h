@@ -23,41 +23,194 @@
 
 #include <cuda/std/__atomic/order.h>
 #include <cuda/std/__atomic/scopes.h>
+#include <cuda/std/__atomic/types.h>
 #include <cuda/std/__atomic/wait/polling.h>
+#include <cuda/std/__type_traits/integral_constant.h>
 
 _LIBCUDACXX_BEGIN_NAMESPACE_STD
 
 extern "C" _CCCL_DEVICE void __atomic_try_wait_unsupported_before_SM_70__();
 
+template <typename _Tp>
+_LIBCUDACXX_INLINE_VISIBILITY bool __nonatomic_compare_equal(_Tp const& __lhs, _Tp const& __rhs)
+{
+#if defined(_CCCL_CUDA_COMPILER)
+  return __lhs == __rhs;
+#else
+  return memcmp(&__lhs, &__rhs, sizeof(_Tp)) == 0;
+#endif
+}
+
+#if defined(_LIBCUDACXX_HAS_PLATFORM_WAIT) && !defined(_LIBCUDACXX_HAS_NO_THREAD_CONTENTION_TABLE)
+
+// Host threads that exhaust their polling budget block in the kernel. Atomics
+// whose value is a platform wait word are waited on directly, all others wait on
+// the version word of their contention table entry, which notifiers bump. The
+// waiter count of the entry lets notifiers skip the syscall when nobody waits.
+//
+// Only host threads of this process notify that way: device threads and other
+// processes sharing the memory change the value without a wake. Waiters on
+// device and system scope atomics therefore sleep for a bounded time before
+// polling the value again, and only block scope waiters sleep until woken.
+
+// how long waiters on atomics of a scope sleep before polling again, at most
+// the longest sleep of the polling fallback for device and system scopes
+inline __libcpp_timespec_t const* __atomic_wait_timeout(__thread_scope_block_tag)
+{
+  return nullptr;
+}
+
+template <typename _Sco>
+__libcpp_timespec_t const* __atomic_wait_timeout(_Sco)
+{
+  static __libcpp_timespec_t const __timeout = {0, 1000000};
+  return &__timeout;
+}
+
+template <typename _Sto, __atomic_storage_is_base<_Sto> = 0>
+void const volatile* __atomic_wait_address(_Sto const volatile* __a)
+{
+  return __a->get();
+}
+
+template <typename _Sto, __atomic_storage_is_small<_Sto> = 0>
+void const volatile* __atomic_wait_address(_Sto const volatile* __a)
+{
+  return __a->__a_value.get();
+}
+
+template <typename _Sto, __atomic_storage_is_locked<_Sto> = 0>
+void const volatile* __atomic_wait_address(_Sto const volatile* __a)
+{
+  return &__a->__a_value;
+}
+
+template <typename _Sto, __atomic_storage_is_wide<_Sto> = 0>
+void const volatile* __atomic_wait_address(_Sto const volatile* __a)
+{
+  return __a->get();
+}
+
+template <typename _Sto>
+using __atomic_uses_platform_wait =
+  integral_constant<bool,
+                    __atomic_tag::__atomic_base_tag == _Sto::__tag
+                      && sizeof(__atomic_underlying_t<_Sto>) == sizeof(__libcpp_platform_wait_t)>;
+
+template <typename _Tp>
+__libcpp_platform_wait_t const* __atomic_platform_wait_word(_Tp const volatile* __a)
+{
+  return const_cast<__libcpp_platform_wait_t const*>(
+    static_cast<__libcpp_platform_wait_t const volatile*>(__atomic_wait_address(__a)));
+}
+
 template <typename _Tp, typename _Sco>
-_LIBCUDACXX_INLINE_VISIBILITY void
-__atomic_try_wait_slow(_Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
+void __atomic_try_wait_platform(
+  _Tp const volatile* __a,
+  __atomic_underlying_remove_cv_t<_Tp> __val,
+  memory_order,
+  _Sco,
+  __libcpp_contention_t*,
+  true_type)
 {
-  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
-                     , NV_IS_HOST, __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
-                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
+  // The kernel rechecks the word, so a concurrent change can't be missed.
+  __libcpp_platform_wait_t __word;
+  memcpy(&__word, &__val, sizeof(__word));
+  __libcpp_platform_wait(__atomic_platform_wait_word(__a), __word, __atomic_wait_timeout(_Sco{}));
 }
 
 template <typename _Tp, typename _Sco>
-_LIBCUDACXX_INLINE_VISIBILITY void __atomic_notify_one(_Tp const volatile*, _Sco)
+void __atomic_try_wait_platform(
+  _Tp const volatile* __a,
+  __atomic_underlying_remove_cv_t<_Tp> __val,
+  memory_order __order,
+  _Sco,
+  __libcpp_contention_t* __state,
+  false_type)
 {
-  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
+  // Sample the version before rechecking the value: a notify that lands in
+  // between bumps the version and the kernel refuses to sleep.
+  __libcpp_platform_wait_t const __version = __atomic_load_host(&__state->__version, memory_order_seq_cst);
+  if (__nonatomic_compare_equal(__atomic_load_dispatch(__a, __order, _Sco{}), __val))
+  {
+    __libcpp_platform_wait(&__state->__version, __version, __atomic_wait_timeout(_Sco{}));
+  }
 }
 
 template <typename _Tp, typename _Sco>
-_LIBCUDACXX_INLINE_VISIBILITY void __atomic_notify_all(_Tp const volatile*, _Sco)
+void __atomic_try_wait_slow_host(
+  _Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
 {
-  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
+  __libcpp_contention_t* const __state = __libcpp_contention_state(__atomic_wait_address(__a));
+  __atomic_fetch_add_host(&__state->__waiters, 1, memory_order_seq_cst);
+  // Pairs with the fence in __atomic_notify_host: either the notifier sees this
+  // waiter, or the value loaded below is the one that was stored.
+  __atomic_thread_fence_host(memory_order_seq_cst);
+  __atomic_try_wait_platform(__a, __val, __order, _Sco{}, __state, __atomic_uses_platform_wait<_Tp>());
+  __atomic_fetch_sub_host(&__state->__waiters, 1, memory_order_release);
 }
 
 template <typename _Tp>
-_LIBCUDACXX_INLINE_VISIBILITY bool __nonatomic_compare_equal(_Tp const& __lhs, _Tp const& __rhs)
+void __atomic_notify_platform(_Tp const volatile* __a, __libcpp_contention_t*, bool __all, true_type)
 {
-#if defined(_CCCL_CUDA_COMPILER)
-  return __lhs == __rhs;
-#else
-  return memcmp(&__lhs, &__rhs, sizeof(_Tp)) == 0;
-#endif
+  __libcpp_platform_wake(__atomic_platform_wait_word(__a), __all);
+}
+
+template <typename _Tp>
+void __atomic_notify_platform(_Tp const volatile*, __libcpp_contention_t* __state, bool, false_type)
+{
+  // Entries are shared between atomics, so every waiter has to recheck.
+  __atomic_fetch_add_host(&__state->__version, 1, memory_order_seq_cst);
+  __libcpp_platform_wake(&__state->__version, true);
+}
+
+template <typename _Tp>
+void __atomic_notify_host(_Tp const volatile* __a, bool __all)
+{
+  __libcpp_contention_t* const __state = __libcpp_contention_state(__atomic_wait_address(__a));
+  __atomic_thread_fence_host(memory_order_seq_cst);
+  if (0 == __atomic_load_host(&__state->__waiters, memory_order_relaxed))
+  {
+    return;
+  }
+  __atomic_notify_platform(__a, __state, __all, __atomic_uses_platform_wait<_Tp>());
+}
+
+#  define _LIBCUDACXX_ATOMIC_TRY_WAIT_SLOW_HOST(__a, __val, __order, __sco) \
+    __atomic_try_wait_slow_host(__a, __val, __order, __sco)
+#  define _LIBCUDACXX_ATOMIC_NOTIFY_HOST(__a, __all) __atomic_notify_host(__a, __all)
+
+#else // ^^^ _LIBCUDACXX_HAS_PLATFORM_WAIT ^^^ / vvv !_LIBCUDACXX_HAS_PLATFORM_WAIT vvv
+
+#  define _LIBCUDACXX_ATOMIC_TRY_WAIT_SLOW_HOST(__a, __val, __order, __sco) \
+    __atomic_try_wait_slow_fallback(__a, __val, __order, __sco)
+#  define _LIBCUDACXX_ATOMIC_NOTIFY_HOST(__a, __all)
+
+#endif // !_LIBCUDACXX_HAS_PLATFORM_WAIT
+
+template <typename _Tp, typename _Sco>
+_LIBCUDACXX_INLINE_VISIBILITY void
+__atomic_try_wait_slow(_Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
+{
+  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
+                     , NV_IS_HOST, _LIBCUDACXX_ATOMIC_TRY_WAIT_SLOW_HOST(__a, __val, __order, _Sco{});
+                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
+}
+
+template <typename _Tp, typename _Sco>
+_LIBCUDACXX_INLINE_VISIBILITY void __atomic_notify_one(_Tp const volatile* __a, _Sco)
+{
+  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, _LIBCUDACXX_ATOMIC_NOTIFY_HOST(__a, false);
+                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
+  (void) __a;
+}
+
+template <typename _Tp, typename _Sco>
+_LIBCUDACXX_INLINE_VISIBILITY void __atomic_notify_all(_Tp const volatile* __a, _Sco)
+{
+  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, _LIBCUDACXX_ATOMIC_NOTIFY_HOST(__a, true);
+                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
+  (void) __a;
 }
 
 template <typename _Tp, typename _Sco>
@@ -0,0 +1,133 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads, nvrtc, pre-sm-70
+
+// <cuda/std/atomic>
+
+// Host threads waiting on atomics which are not 32 bits wide block on an entry
+// of the contention table, which several atomics share. Notifying one of them
+// must not lose the notifications of the others, nor release their waiters.
+
+#include <cuda/std/atomic>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+
+#include "concurrent_agents.h"
+#include "test_macros.h"
+
+using A = cuda::std::atomic<cuda::std::uint64_t>;
+
+constexpr int num_atomics = 1024;
+
+// finds two atomics of values whose waiters share an entry of the table
+void find_shared_entry(A* values, A*& first, A*& second)
+{
+  first  = &values[0];
+  second = &values[1];
+
+#if !defined(_LIBCUDACXX_HAS_NO_THREAD_CONTENTION_TABLE)
+  for (int i = 0; i < num_atomics; ++i)
+  {
+    for (int j = i + 1; j < num_atomics; ++j)
+    {
+      if (cuda::std::__libcpp_contention_state(&values[i]) == cuda::std::__libcpp_contention_state(&values[j]))
+      {
+        first  = &values[i];
+        second = &values[j];
+        return;
+      }
+    }
+  }
+
+  assert(false);
+#endif // !_LIBCUDACXX_HAS_NO_THREAD_CONTENTION_TABLE
+}
+
+void test_shared_entry()
+{
+  static A values[num_atomics];
+
+  A* a;
+  A* b;
+  find_shared_entry(values, a, b);
+
+  a->store(0);
+  b->store(0);
+
+  A a_woken(0);
+  A b_woken(0);
+
+  auto a_waiter = [&] {
+    a->wait(0);
+    assert(a->load() == 1);
+    ++a_woken;
+  };
+
+  auto b_waiter = [&] {
+    b->wait(0);
+    assert(b->load() == 1);
+    ++b_woken;
+  };
+
+  auto notifier = [&] {
+    // releases the waiters of b, those of a wake as well but block again
+    b->store(1);
+    b->notify_one();
+
+    while (b_woken.load() < 2)
+    {
+      b->notify_one();
+      std::this_thread::yield();
+    }
+
+    assert(a_woken.load() == 0);
+
+    a->store(1);
+    a->notify_all();
+  };
+
+  concurrent_agents_launch(a_waiter, a_waiter, a_waiter, b_waiter, b_waiter, notifier);
+
+  assert(a_woken.load() == 3);
+  assert(b_woken.load() == 2);
+}
+
+// values of several sizes, all of which go through the table
+template <class T>
+void test_notify_all()
+{
+  cuda::std::atomic<T> value(T(0));
+  A woken(0);
+
+  auto waiter = [&] {
+    value.wait(T(0));
+    assert(value.load() == T(1));
+    ++woken;
+  };
+
+  auto notifier = [&] {
+    value.store(T(1));
+    value.notify_all();
+  };
+
+  concurrent_agents_launch(waiter, waiter, waiter, notifier);
+
+  assert(woken.load() == 3);
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST,
+               (test_shared_entry(); test_notify_all<cuda::std::uint8_t>(); test_notify_all<cuda::std::uint16_t>();
+                test_notify_all<cuda::std::uint64_t>();))
+
+  return 0;
+}
@@ -0,0 +1,112 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads, nvrtc, pre-sm-70
+
+// <cuda/std/atomic>
+
+// Host threads waiting on a 32-bit atomic block on its own word, and are only
+// woken by notifications.
+
+#include <cuda/std/atomic>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+
+#include "concurrent_agents.h"
+#include "test_macros.h"
+
+using A = cuda::std::atomic<cuda::std::int32_t>;
+
+// Waiters block until the value changes, then count themselves as woken.
+// Notifications are sent one at a time until every waiter has woken, so each
+// notify_one has to wake one of the blocked waiters for this to end.
+void test_notify_one()
+{
+  A value(0);
+  A woken(0);
+
+  auto waiter = [&] {
+    value.wait(0);
+    assert(value.load() == 1);
+    ++woken;
+  };
+
+  auto notifier = [&] {
+    value.store(1);
+
+    while (woken.load() < 3)
+    {
+      value.notify_one();
+      std::this_thread::yield();
+    }
+  };
+
+  concurrent_agents_launch(waiter, waiter, waiter, notifier);
+
+  assert(woken.load() == 3);
+}
+
+void test_notify_all()
+{
+  A value(0);
+  A woken(0);
+
+  auto waiter = [&] {
+    value.wait(0);
+    assert(value.load() == 1);
+    ++woken;
+  };
+
+  auto notifier = [&] {
+    value.store(1);
+    value.notify_all();
+  };
+
+  concurrent_agents_launch(waiter, waiter, waiter, waiter, notifier);
+
+  assert(woken.load() == 4);
+}
+
+// A notification without a change of the value does not release the waiters,
+// they block again until it does change.
+void test_unchanged_value()
+{
+  A value(0);
+  A woken(0);
+
+  auto waiter = [&] {
+    value.wait(0);
+    ++woken;
+  };
+
+  auto notifier = [&] {
+    for (int i = 0; i < 100; ++i)
+    {
+      value.notify_all();
+      std::this_thread::yield();
+    }
+
+    assert(woken.load() == 0);
+
+    value.store(2);
+    value.notify_all();
+  };
+
+  concurrent_agents_launch(waiter, waiter, notifier);
+
+  assert(woken.load() == 2);
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (test_notify_one(); test_notify_all(); test_unchanged_value();))
+
+  return 0;
+}
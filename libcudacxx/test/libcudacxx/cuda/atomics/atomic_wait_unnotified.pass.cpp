@@ -0,0 +1,66 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads, nvrtc, pre-sm-70
+
+// <cuda/atomic>
+
+// Device threads and other processes change device and system scope atomics
+// without waking host waiters, which have to see the change regardless. Here a
+// host thread stands in for them, and stores without notifying.
+
+#include <cuda/atomic>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+
+#include <chrono>
+
+#include "concurrent_agents.h"
+#include "test_macros.h"
+
+template <class T, cuda::thread_scope Scope>
+void test()
+{
+  cuda::atomic<T, Scope> value(T(0));
+  cuda::atomic<int, Scope> woken(0);
+
+  auto waiter = [&] {
+    value.wait(T(0));
+    assert(value.load() == T(1));
+    ++woken;
+  };
+
+  auto storer = [&] {
+    // long enough for the waiters to give up polling and sleep
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    value.store(T(1));
+  };
+
+  concurrent_agents_launch(waiter, waiter, storer);
+
+  assert(woken.load() == 2);
+}
+
+template <cuda::thread_scope Scope>
+void test_sizes()
+{
+  // waits on the value itself, and on an entry of the contention table
+  test<cuda::std::int32_t, Scope>();
+  test<cuda::std::uint64_t, Scope>();
+  test<cuda::std::uint8_t, Scope>();
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST,
+               (test_sizes<cuda::thread_scope_system>(); test_sizes<cuda::thread_scope_device>();))
+
+  return 0;
+}
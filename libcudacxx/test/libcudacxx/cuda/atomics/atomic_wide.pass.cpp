@@ -0,0 +1,141 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads, nvrtc, pre-sm-70
+
+// <cuda/std/atomic>
+
+// 16 byte atomics, lock-free where the host compiler has a double width
+// compare-and-swap and locked everywhere else.
+
+#include <cuda/std/version>
+
+#if !defined(_CCCL_CUDA_COMPILER) && (defined(_CCCL_COMPILER_GCC) || defined(_CCCL_COMPILER_CLANG)) \
+  && !defined(_LIBCUDACXX_HAS_NO_INT128) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+#  define _LIBCUDACXX_ENABLE_HOST_ATOMIC_128
+#endif
+
+#include <cuda/std/atomic>
+#include <cuda/std/cassert>
+
+#include "concurrent_agents.h"
+#include "test_macros.h"
+
+struct wide
+{
+  long long lo;
+  long long hi;
+
+  __host__ __device__ friend bool operator==(const wide& lhs, const wide& rhs)
+  {
+    return lhs.lo == rhs.lo && lhs.hi == rhs.hi;
+  }
+};
+
+using A = cuda::std::atomic<wide>;
+
+#if defined(_LIBCUDACXX_ENABLE_HOST_ATOMIC_128)
+static_assert(sizeof(A) == 16, "");
+static_assert(alignof(A) == 16, "");
+static_assert(A::is_always_lock_free, "");
+#endif // _LIBCUDACXX_ENABLE_HOST_ATOMIC_128
+
+__host__ __device__ void test_operations()
+{
+  A a(wide{1, -1});
+  assert(a.load() == (wide{1, -1}));
+
+  a.store(wide{2, -2});
+  assert(a.load() == (wide{2, -2}));
+
+  assert(a.exchange(wide{3, -3}) == (wide{2, -2}));
+  assert(a.load() == (wide{3, -3}));
+
+  // both halves are compared, a matching low half is not enough
+  wide expected{3, 0};
+  assert(!a.compare_exchange_strong(expected, wide{4, -4}));
+  assert(expected == (wide{3, -3}));
+  assert(a.compare_exchange_strong(expected, wide{4, -4}));
+  assert(a.load() == (wide{4, -4}));
+
+  expected = wide{4, -4};
+  while (!a.compare_exchange_weak(expected, wide{5, -5}))
+  {
+    assert(expected == (wide{4, -4}));
+  }
+  assert(a.load() == (wide{5, -5}));
+
+  const A& c = a;
+  assert(c.load(cuda::std::memory_order_acquire) == (wide{5, -5}));
+}
+
+void test_concurrent_updates()
+{
+  // The halves are only ever updated together, so a torn load shows up as a
+  // mismatch between them.
+  A a(wide{0, 0});
+
+  auto agent = [&] {
+    for (int i = 0; i < 10000; ++i)
+    {
+      wide old = a.load();
+      assert(old.lo == -old.hi);
+      while (!a.compare_exchange_weak(old, wide{old.lo + 1, old.hi - 1}))
+      {
+        assert(old.lo == -old.hi);
+      }
+    }
+  };
+
+  concurrent_agents_launch(agent, agent, agent, agent);
+
+  assert(a.load() == (wide{40000, -40000}));
+}
+
+void test_wait()
+{
+  A a(wide{0, 0});
+
+  // does not block on a value which differs
+  a.wait(wide{1, 1});
+
+  auto waiter = [&] {
+    a.wait(wide{0, 0});
+    assert(a.load() == (wide{1, 1}));
+  };
+
+  auto notifier = [&] {
+    a.store(wide{1, 1});
+    a.notify_all();
+  };
+
+  concurrent_agents_launch(waiter, waiter, waiter, notifier);
+
+  auto waiter_one = [&] {
+    a.wait(wide{1, 1});
+    assert(a.load() == (wide{2, 2}));
+  };
+
+  auto notifier_one = [&] {
+    a.store(wide{2, 2});
+    a.notify_one();
+  };
+
+  concurrent_agents_launch(waiter_one, notifier_one);
+}
+
+int main(int, char**)
+{
+  test_operations();
+
+  NV_IF_TARGET(NV_IS_HOST, (test_concurrent_updates(); test_wait();))
+
+  return 0;
+}
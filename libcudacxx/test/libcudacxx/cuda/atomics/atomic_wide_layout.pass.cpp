@@ -0,0 +1,50 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+
+// <cuda/std/atomic>
+
+// Unless _LIBCUDACXX_ENABLE_HOST_ATOMIC_128 is defined, 16 byte atomics keep
+// the locked layout with every compiler and flag (e.g. -mcx16), so translation
+// units built by the host and the CUDA compiler agree on it.
+
+#include <cuda/atomic>
+#include <cuda/std/atomic>
+#include <cuda/std/cstdint>
+
+#include "test_macros.h"
+
+struct wide
+{
+  long long lo;
+  long long hi;
+};
+
+struct locked_layout
+{
+  wide value;
+  int lock;
+};
+
+static_assert(sizeof(cuda::std::atomic<wide>) == sizeof(locked_layout), "");
+static_assert(alignof(cuda::std::atomic<wide>) == alignof(locked_layout), "");
+static_assert(!cuda::std::atomic<wide>::is_always_lock_free, "");
+
+static_assert(sizeof(cuda::atomic<wide, cuda::thread_scope_system>) == sizeof(locked_layout), "");
+static_assert(alignof(cuda::atomic<wide, cuda::thread_scope_system>) == alignof(locked_layout), "");
+
+static_assert(sizeof(cuda::std::atomic<cuda::std::uint64_t>) == sizeof(cuda::std::uint64_t), "");
+static_assert(alignof(cuda::std::atomic<cuda::std::uint64_t>) == alignof(cuda::std::uint64_t), "");
+
+int main(int, char**)
+{
+  return 0;
+}
@@ -0,0 +1,163 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11
+// UNSUPPORTED: msvc-19.16
+// UNSUPPORTED: nvrtc
+#include <cuda/memory_resource>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+
+#include "test_macros.h"
+
+// Counts the calls to the upstream resource
+struct counting_resource
+{
+  cuda::mr::new_delete_resource upstream{};
+  int allocations   = 0;
+  int deallocations = 0;
+
+  void* allocate(size_t bytes, size_t alignment)
+  {
+    ++allocations;
+    return upstream.allocate(bytes, alignment);
+  }
+  void deallocate(void* ptr, size_t bytes, size_t alignment)
+  {
+    ++deallocations;
+    upstream.deallocate(ptr, bytes, alignment);
+  }
+
+  bool operator==(const counting_resource& other) const
+  {
+    return this == &other;
+  }
+  bool operator!=(const counting_resource& other) const
+  {
+    return this != &other;
+  }
+
+  friend void get_property(const counting_resource&, cuda::mr::host_accessible) noexcept {}
+};
+
+bool is_aligned(void* ptr, size_t alignment)
+{
+  return reinterpret_cast<cuda::std::uintptr_t>(ptr) % alignment == 0;
+}
+
+void test()
+{
+  { // allocations are carved from a single chunk
+    counting_resource upstream{};
+    cuda::mr::monotonic_buffer_resource<cuda::mr::host_accessible> arena{upstream, 1024};
+
+    char* first  = static_cast<char*>(arena.allocate(10, 1));
+    char* second = static_cast<char*>(arena.allocate(10, 1));
+    assert(second == first + 10);
+
+    void* third = arena.allocate(8, 64);
+    assert(is_aligned(third, 64));
+    assert(upstream.allocations == 1);
+
+    // deallocate is a no-op
+    arena.deallocate(third, 8, 64);
+    assert(arena.allocate(10, 1) != third);
+    assert(upstream.deallocations == 0);
+  }
+
+  { // reset reuses the chunks
+    counting_resource upstream{};
+    cuda::mr::monotonic_buffer_resource<cuda::mr::host_accessible> arena{upstream, 256};
+
+    for (int iteration = 0; iteration < 4; ++iteration)
+    {
+      void* first = arena.allocate(100);
+      for (int i = 0; i < 20; ++i)
+      {
+        void* ptr = arena.allocate(100);
+        assert(is_aligned(ptr, alignof(cuda::std::max_align_t)));
+      }
+      arena.reset();
+      assert(arena.allocate(100) == first);
+      arena.reset();
+    }
+
+    const int allocations = upstream.allocations;
+    assert(allocations > 1);
+    for (int i = 0; i < 21; ++i)
+    {
+      unused(arena.allocate(100));
+    }
+    assert(upstream.allocations == allocations);
+  }
+
+  { // requests larger than the next chunk get a chunk of their own
+    counting_resource upstream{};
+    cuda::mr::monotonic_buffer_resource<cuda::mr::host_accessible> arena{upstream, 64};
+
+    auto* ptr = static_cast<char*>(arena.allocate(4096, 256));
+    assert(is_aligned(ptr, 256));
+    ptr[4095] = 42;
+    assert(upstream.allocations == 1);
+  }
+
+  { // release and the destructor return all chunks
+    counting_resource upstream{};
+    {
+      cuda::mr::monotonic_buffer_resource<cuda::mr::host_accessible> arena{upstream, 16};
+      for (int i = 0; i < 100; ++i)
+      {
+        unused(arena.allocate(32));
+      }
+      arena.release();
+      assert(upstream.allocations == upstream.deallocations);
+
+      unused(arena.allocate(32));
+    }
+    assert(upstream.allocations == upstream.deallocations);
+  }
+
+  { // the arena is a resource itself
+    counting_resource upstream{};
+    cuda::mr::monotonic_buffer_resource<cuda::mr::host_accessible> arena{upstream};
+    cuda::mr::resource_ref<cuda::mr::host_accessible> ref{arena};
+
+    auto* ptr = static_cast<int*>(ref.allocate(sizeof(int) * 4, alignof(int)));
+    ptr[3] = 42;
+    assert(ptr[3] == 42);
+    ref.deallocate(ptr, sizeof(int) * 4, alignof(int));
+  }
+
+#ifndef TEST_HAS_NO_EXCEPTIONS
+  { // allocate with non power of two alignment
+    counting_resource upstream{};
+    cuda::mr::monotonic_buffer_resource<cuda::mr::host_accessible> arena{upstream};
+    while (true)
+    {
+      try
+      {
+        auto* ptr = arena.allocate(5, 42);
+        unused(ptr);
+      }
+      catch (const std::bad_alloc&)
+      {
+        break;
+      }
+      assert(false);
+    }
+  }
+#endif // TEST_HAS_NO_EXCEPTIONS
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+  return 0;
+}
@@ -0,0 +1,34 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11
+// UNSUPPORTED: msvc-19.16
+// UNSUPPORTED: nvrtc
+
+#include <cuda/memory_resource>
+#include <cuda/std/type_traits>
+
+using arena = cuda::mr::monotonic_buffer_resource<cuda::mr::host_accessible>;
+
+static_assert(!cuda::std::is_copy_constructible<arena>::value, "");
+static_assert(!cuda::std::is_copy_assignable<arena>::value, "");
+static_assert(!cuda::std::is_default_constructible<arena>::value, "");
+
+// the arena forwards the properties of its upstream
+static_assert(cuda::mr::resource_with<arena, cuda::mr::host_accessible>, "");
+static_assert(!cuda::mr::resource_with<arena, cuda::mr::device_accessible>, "");
+
+static_assert(cuda::std::is_constructible<arena, cuda::mr::new_delete_resource&>::value, "");
+static_assert(cuda::std::is_constructible<arena, cuda::mr::new_delete_resource&, size_t>::value, "");
+
+int main(int, char**)
+{
+  return 0;
+}
@@ -0,0 +1,84 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11
+// UNSUPPORTED: msvc-19.16
+// UNSUPPORTED: nvrtc
+
+#include <cuda/memory_resource>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+
+#include "test_macros.h"
+
+void test()
+{
+  cuda::mr::new_delete_resource res{};
+
+  { // allocate / deallocate
+    auto* ptr = res.allocate(42);
+    static_assert(cuda::std::is_same<decltype(ptr), void*>::value, "");
+    assert(ptr != nullptr);
+    assert(reinterpret_cast<cuda::std::uintptr_t>(ptr) % alignof(cuda::std::max_align_t) == 0);
+
+    res.deallocate(ptr, 42);
+  }
+
+  { // allocate / deallocate with alignment
+    auto* ptr = res.allocate(42, 4);
+    assert(ptr != nullptr);
+    assert(reinterpret_cast<cuda::std::uintptr_t>(ptr) % 4 == 0);
+
+    res.deallocate(ptr, 42, 4);
+  }
+
+#if !defined(_LIBCUDACXX_HAS_NO_ALIGNED_ALLOCATION)
+  { // allocate / deallocate with extended alignment
+    auto* ptr = res.allocate(42, 256);
+    assert(ptr != nullptr);
+    assert(reinterpret_cast<cuda::std::uintptr_t>(ptr) % 256 == 0);
+
+    res.deallocate(ptr, 42, 256);
+  }
+#endif // !_LIBCUDACXX_HAS_NO_ALIGNED_ALLOCATION
+
+  { // allocate through a resource_ref
+    cuda::mr::resource_ref<cuda::mr::host_accessible> ref{res};
+    auto* ptr = static_cast<int*>(ref.allocate(sizeof(int) * 4, alignof(int)));
+    ptr[3] = 42;
+    assert(ptr[3] == 42);
+
+    ref.deallocate(ptr, sizeof(int) * 4, alignof(int));
+  }
+
+#ifndef TEST_HAS_NO_EXCEPTIONS
+  { // allocate with non power of two alignment
+    while (true)
+    {
+      try
+      {
+        auto* ptr = res.allocate(5, 42);
+        unused(ptr);
+      }
+      catch (const std::bad_alloc&)
+      {
+        break;
+      }
+      assert(false);
+    }
+  }
+#endif // TEST_HAS_NO_EXCEPTIONS
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+  return 0;
+}
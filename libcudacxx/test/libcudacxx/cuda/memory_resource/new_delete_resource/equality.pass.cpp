@@ -0,0 +1,68 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11
+// UNSUPPORTED: msvc-19.16
+// UNSUPPORTED: nvrtc
+
+#include <cuda/memory_resource>
+#include <cuda/std/cassert>
+
+struct resource
+{
+  void* allocate(size_t, size_t)
+  {
+    return nullptr;
+  }
+  void deallocate(void*, size_t, size_t) {}
+
+  bool operator==(const resource&) const
+  {
+    return true;
+  }
+  bool operator!=(const resource&) const
+  {
+    return false;
+  }
+};
+static_assert(cuda::mr::resource<resource>, "");
+
+void test()
+{
+  cuda::mr::new_delete_resource first{};
+  { // comparison against a plain new_delete_resource
+    cuda::mr::new_delete_resource second{};
+    assert(first == second);
+    assert(!(first != second));
+  }
+
+  { // comparison against a new_delete_resource wrapped inside a resource_ref<>
+    cuda::mr::new_delete_resource second{};
+    cuda::mr::resource_ref<> second_ref{second};
+    assert(first == second_ref);
+    assert(!(first != second_ref));
+    assert(second_ref == first);
+    assert(!(second_ref != first));
+  }
+
+  { // comparison against a different resource
+    resource other{};
+    assert(!(first == other));
+    assert(first != other);
+    assert(!(other == first));
+    assert(other != first);
+  }
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+  return 0;
+}
@@ -0,0 +1,146 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11
+// UNSUPPORTED: msvc-19.16
+// UNSUPPORTED: nvrtc
+#include <cuda/memory_resource>
+#include <cuda/std/cassert>
+#include <cuda/std/cstdint>
+
+#include "test_macros.h"
+
+// Counts the calls to the upstream resource
+struct counting_resource
+{
+  cuda::mr::new_delete_resource upstream{};
+  int allocations   = 0;
+  int deallocations = 0;
+
+  void* allocate(size_t bytes, size_t alignment)
+  {
+    ++allocations;
+    return upstream.allocate(bytes, alignment);
+  }
+  void deallocate(void* ptr, size_t bytes, size_t alignment)
+  {
+    ++deallocations;
+    upstream.deallocate(ptr, bytes, alignment);
+  }
+
+  bool operator==(const counting_resource& other) const
+  {
+    return this == &other;
+  }
+  bool operator!=(const counting_resource& other) const
+  {
+    return this != &other;
+  }
+
+  friend void get_property(const counting_resource&, cuda::mr::host_accessible) noexcept {}
+};
+
+void test()
+{
+  { // deallocated blocks are reused for requests of the same size class
+    counting_resource upstream{};
+    cuda::mr::pool_resource<cuda::mr::host_accessible> pool{upstream};
+
+    void* first = pool.allocate(100);
+    assert(first != nullptr);
+    assert(reinterpret_cast<cuda::std::uintptr_t>(first) % alignof(cuda::std::max_align_t) == 0);
+    assert(upstream.allocations == 1);
+
+    pool.deallocate(first, 100);
+    assert(upstream.deallocations == 0);
+    assert(pool.cached_bytes() == 128);
+
+    void* second = pool.allocate(120, 8);
+    assert(second == first);
+    assert(upstream.allocations == 1);
+    assert(pool.cached_bytes() == 0);
+
+    void* third = pool.allocate(129);
+    assert(third != first);
+    assert(upstream.allocations == 2);
+
+    pool.deallocate(second, 120, 8);
+    pool.deallocate(third, 129);
+    assert(pool.cached_bytes() == 128 + 256);
+
+    pool.release();
+    assert(pool.cached_bytes() == 0);
+    assert(upstream.deallocations == 2);
+  }
+
+  { // large and over-aligned requests bypass the pool
+    counting_resource upstream{};
+    cuda::mr::pool_options options{};
+    options.largest_pooled_block = 1024;
+    cuda::mr::pool_resource<cuda::mr::host_accessible> pool{upstream, options};
+
+    void* large = pool.allocate(2048);
+    pool.deallocate(large, 2048);
+    assert(upstream.deallocations == 1);
+
+    void* aligned = pool.allocate(64, 256);
+    assert(reinterpret_cast<cuda::std::uintptr_t>(aligned) % 256 == 0);
+    pool.deallocate(aligned, 64, 256);
+    assert(upstream.deallocations == 2);
+    assert(pool.cached_bytes() == 0);
+  }
+
+  { // blocks beyond the release threshold are returned to the upstream resource
+    counting_resource upstream{};
+    cuda::mr::pool_options options{};
+    options.release_threshold = 64;
+    cuda::mr::pool_resource<cuda::mr::host_accessible> pool{upstream, options};
+
+    void* first  = pool.allocate(64);
+    void* second = pool.allocate(64);
+    pool.deallocate(first, 64);
+    pool.deallocate(second, 64);
+    assert(pool.cached_bytes() == 64);
+    assert(upstream.deallocations == 1);
+  }
+
+  { // the destructor returns all cached blocks
+    counting_resource upstream{};
+    {
+      cuda::mr::pool_resource<cuda::mr::host_accessible> pool{upstream};
+      for (size_t bytes = 1; bytes < 4096; bytes *= 3)
+      {
+        pool.deallocate(pool.allocate(bytes), bytes);
+      }
+    }
+    assert(upstream.allocations == upstream.deallocations);
+  }
+
+  { // the pool is a resource itself
+    counting_resource upstream{};
+    cuda::mr::pool_resource<cuda::mr::host_accessible> pool{upstream};
+    cuda::mr::resource_ref<cuda::mr::host_accessible> ref{pool};
+
+    auto* ptr = static_cast<int*>(ref.allocate(sizeof(int) * 4, alignof(int)));
+    ptr[3] = 42;
+    assert(ptr[3] == 42);
+    ref.deallocate(ptr, sizeof(int) * 4, alignof(int));
+
+    assert(ref == cuda::mr::resource_ref<cuda::mr::host_accessible>{pool});
+    cuda::mr::pool_resource<cuda::mr::host_accessible> other{upstream};
+    assert(pool != other);
+  }
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, test();)
+  return 0;
+}
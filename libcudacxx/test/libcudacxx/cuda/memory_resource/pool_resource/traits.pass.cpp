@@ -0,0 +1,58 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++03, c++11
+// UNSUPPORTED: msvc-19.16
+// UNSUPPORTED: nvrtc
+
+#include <cuda/memory_resource>
+#include <cuda/std/type_traits>
+
+struct device_resource
+{
+  void* allocate(size_t, size_t)
+  {
+    return nullptr;
+  }
+  void deallocate(void*, size_t, size_t) {}
+
+  bool operator==(const device_resource&) const
+  {
+    return true;
+  }
+  bool operator!=(const device_resource&) const
+  {
+    return false;
+  }
+
+  friend void get_property(const device_resource&, cuda::mr::device_accessible) noexcept {}
+};
+
+using host_pool   = cuda::mr::pool_resource<cuda::mr::host_accessible>;
+using device_pool = cuda::mr::pool_resource<cuda::mr::device_accessible>;
+
+static_assert(!cuda::std::is_copy_constructible<host_pool>::value, "");
+static_assert(!cuda::std::is_copy_assignable<host_pool>::value, "");
+static_assert(!cuda::std::is_default_constructible<host_pool>::value, "");
+
+// the pool forwards the properties of its upstream
+static_assert(cuda::mr::resource_with<host_pool, cuda::mr::host_accessible>, "");
+static_assert(!cuda::mr::resource_with<host_pool, cuda::mr::device_accessible>, "");
+static_assert(cuda::mr::resource_with<device_pool, cuda::mr::device_accessible>, "");
+static_assert(!cuda::mr::resource_with<device_pool, cuda::mr::host_accessible>, "");
+
+static_assert(cuda::std::is_constructible<host_pool, cuda::mr::new_delete_resource&>::value, "");
+static_assert(!cuda::std::is_constructible<host_pool, device_resource&>::value, "");
+static_assert(cuda::std::is_constructible<device_pool, device_resource&>::value, "");
+
+int main(int, char**)
+{
+  return 0;
+}
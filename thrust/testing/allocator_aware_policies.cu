@@ -102,8 +102,10 @@ struct TestAllocatorAttachment
 
 using sequential_info = policy_info<thrust::detail::seq_t, thrust::system::detail::sequential::execution_policy>;
 using cpp_par_info    = policy_info<thrust::system::cpp::detail::par_t, thrust::system::cpp::detail::execution_policy>;
-using omp_par_info    = policy_info<thrust::system::omp::detail::par_t, thrust::system::omp::detail::execution_policy>;
-using tbb_par_info    = policy_info<thrust::system::tbb::detail::par_t, thrust::system::tbb::detail::execution_policy>;
+using omp_par_info    =
+  policy_info<thrust::system::omp::detail::par_t, thrust::system::omp::detail::execute_with_threads_base>;
+using tbb_par_info    =
+  policy_info<thrust::system::tbb::detail::par_t, thrust::system::tbb::detail::execute_on_arena_base>;
 
 #if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 using cuda_par_info = policy_info<thrust::system::cuda::detail::par_t, thrust::cuda_cub::execute_on_stream_base>;
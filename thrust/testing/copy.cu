@@ -613,6 +613,48 @@ void TestCopyConstantIteratorToZipIterator()
 };
 DECLARE_VECTOR_UNITTEST(TestCopyConstantIteratorToZipIterator);
 
+// large enough for the parallel backends to split the copy into chunks
+void TestCopyTriviallyRelocatableLarge()
+{
+  const size_t n = (1 << 20) + 13;
+
+  thrust::host_vector<int> h_src(n);
+  thrust::sequence(h_src.begin(), h_src.end());
+  thrust::device_vector<int> d_src = h_src;
+
+  // neither range starts at the beginning of an allocation
+  thrust::host_vector<int> h_dst(n + 8, -1);
+  thrust::device_vector<int> d_dst(n + 8, -1);
+
+  thrust::copy(h_src.begin() + 3, h_src.end(), h_dst.begin() + 5);
+  thrust::device_vector<int>::iterator d_end = thrust::copy(d_src.begin() + 3, d_src.end(), d_dst.begin() + 5);
+
+  ASSERT_EQUAL_QUIET(d_dst.begin() + n + 2, d_end);
+  ASSERT_EQUAL(h_dst, d_dst);
+
+  thrust::copy_n(d_src.begin() + 1, n - 1, d_dst.begin() + 1);
+  thrust::copy_n(h_src.begin() + 1, n - 1, h_dst.begin() + 1);
+
+  ASSERT_EQUAL(h_dst, d_dst);
+}
+DECLARE_UNITTEST(TestCopyTriviallyRelocatableLarge);
+
+void TestCopyTriviallyRelocatableOverlapping()
+{
+  const size_t n = (1 << 20) + 13;
+
+  thrust::host_vector<int> h_data(n);
+  thrust::sequence(h_data.begin(), h_data.end());
+  thrust::device_vector<int> d_data = h_data;
+
+  // shifting towards the front is valid for copy
+  thrust::copy(h_data.begin() + 1000, h_data.end(), h_data.begin());
+  thrust::copy(d_data.begin() + 1000, d_data.end(), d_data.begin());
+
+  ASSERT_EQUAL(h_data, d_data);
+}
+DECLARE_UNITTEST(TestCopyTriviallyRelocatableOverlapping);
+
 template <typename InputIterator, typename OutputIterator>
 OutputIterator copy(my_system& system, InputIterator, InputIterator, OutputIterator result)
 {
@@ -120,6 +120,37 @@ void TestFill(size_t n)
 }
 DECLARE_VARIABLE_UNITTEST(TestFill);
 
+// large enough for the parallel backends to split the fill into chunks
+template <typename T>
+void TestFillLarge(T value)
+{
+  const size_t n = (1 << 20) + 13;
+
+  thrust::host_vector<T> h_data(n + 8, T(1));
+  thrust::device_vector<T> d_data(n + 8, T(1));
+
+  // the range doesn't start at the beginning of an allocation
+  thrust::fill(h_data.begin() + 3, h_data.begin() + 3 + n, value);
+  thrust::fill(d_data.begin() + 3, d_data.begin() + 3 + n, value);
+
+  ASSERT_EQUAL(h_data, d_data);
+
+  thrust::fill_n(h_data.begin() + 5, n - 2, T(0));
+  thrust::fill_n(d_data.begin() + 5, n - 2, T(0));
+
+  ASSERT_EQUAL(h_data, d_data);
+}
+
+void TestFillLargeTrivial()
+{
+  TestFillLarge<int>(0x01010101);
+  TestFillLarge<int>(13);
+  TestFillLarge<double>(-1.5);
+  TestFillLarge<unsigned char>(7);
+  TestFillLarge<short>(-1);
+}
+DECLARE_UNITTEST(TestFillLargeTrivial);
+
 template <class Vector>
 void TestFillNSimple()
 {
@@ -0,0 +1,241 @@
+#include <thrust/count.h>
+#include <thrust/histogram.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/retag.h>
+#include <thrust/sort.h>
+#include <thrust/unique.h>
+
+#include <limits>
+
+#include <unittest/unittest.h>
+
+template <class Vector>
+void TestHistogramEvenSimple()
+{
+  using T = typename Vector::value_type;
+
+  Vector samples(7);
+  samples[0] = 0;
+  samples[1] = 1;
+  samples[2] = 2;
+  samples[3] = 3;
+  samples[4] = 5;
+  samples[5] = 7;
+  samples[6] = 9;
+
+  Vector counts(4, T(13));
+
+  typename Vector::iterator end = thrust::histogram_even(samples.begin(), samples.end(), counts.begin(), 5, T(0), T(8));
+
+  ASSERT_EQUAL_QUIET(counts.end(), end);
+  ASSERT_EQUAL(counts[0], 2);
+  ASSERT_EQUAL(counts[1], 2);
+  ASSERT_EQUAL(counts[2], 1);
+  ASSERT_EQUAL(counts[3], 1);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestHistogramEvenSimple);
+
+template <class Vector>
+void TestHistogramRangeSimple()
+{
+  using T = typename Vector::value_type;
+
+  Vector samples(6);
+  samples[0] = 0;
+  samples[1] = 1;
+  samples[2] = 2;
+  samples[3] = 4;
+  samples[4] = 9;
+  samples[5] = 12;
+
+  Vector levels(4);
+  levels[0] = 1;
+  levels[1] = 2;
+  levels[2] = 4;
+  levels[3] = 10;
+
+  Vector counts(3, T(13));
+
+  typename Vector::iterator end =
+    thrust::histogram_range(samples.begin(), samples.end(), levels.begin(), levels.end(), counts.begin());
+
+  ASSERT_EQUAL_QUIET(counts.end(), end);
+  ASSERT_EQUAL(counts[0], 1);
+  ASSERT_EQUAL(counts[1], 1);
+  ASSERT_EQUAL(counts[2], 2);
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestHistogramRangeSimple);
+
+template <typename T>
+void TestHistogramEven(const size_t n)
+{
+  thrust::host_vector<T> h_samples   = unittest::random_samples<T>(n);
+  thrust::device_vector<T> d_samples = h_samples;
+
+  thrust::host_vector<int> h_counts(11);
+  thrust::device_vector<int> d_counts(11);
+
+  thrust::histogram_even(h_samples.begin(), h_samples.end(), h_counts.begin(), 12, T(10), T(100));
+  thrust::histogram_even(d_samples.begin(), d_samples.end(), d_counts.begin(), 12, T(10), T(100));
+
+  ASSERT_EQUAL(h_counts, d_counts);
+}
+DECLARE_VARIABLE_UNITTEST(TestHistogramEven);
+
+template <typename T>
+void TestHistogramRange(const size_t n)
+{
+  thrust::host_vector<T> h_samples   = unittest::random_samples<T>(n);
+  thrust::device_vector<T> d_samples = h_samples;
+
+  thrust::host_vector<T> h_levels = unittest::random_samples<T>(17);
+  thrust::sort(h_levels.begin(), h_levels.end());
+  h_levels.erase(thrust::unique(h_levels.begin(), h_levels.end()), h_levels.end());
+  thrust::device_vector<T> d_levels = h_levels;
+
+  thrust::host_vector<int> h_counts(h_levels.size() - 1);
+  thrust::device_vector<int> d_counts(h_levels.size() - 1);
+
+  thrust::histogram_range(h_samples.begin(), h_samples.end(), h_levels.begin(), h_levels.end(), h_counts.begin());
+  thrust::histogram_range(d_samples.begin(), d_samples.end(), d_levels.begin(), d_levels.end(), d_counts.begin());
+
+  ASSERT_EQUAL(h_counts, d_counts);
+}
+DECLARE_VARIABLE_UNITTEST(TestHistogramRange);
+
+// compares with the formula of cub::DeviceHistogram::HistogramEven
+void TestHistogramEvenMatchesReference()
+{
+  const size_t n = 100000;
+
+  thrust::host_vector<int> h_samples = unittest::random_integers<int>(n);
+
+  const int num_bins = 37;
+  const int lower    = -1000000000;
+  const int upper    = 2000000000;
+
+  thrust::host_vector<unsigned int> reference(num_bins, 0);
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    const long long x = h_samples[i];
+
+    if (lower <= x && x < upper)
+    {
+      ++reference[static_cast<int>((x - lower) * num_bins / ((long long) upper - lower))];
+    }
+  }
+
+  thrust::device_vector<int> d_samples = h_samples;
+  thrust::device_vector<unsigned int> d_counts(num_bins);
+
+  thrust::histogram_even(d_samples.begin(), d_samples.end(), d_counts.begin(), num_bins + 1, lower, upper);
+
+  ASSERT_EQUAL(reference, d_counts);
+}
+DECLARE_UNITTEST(TestHistogramEvenMatchesReference);
+
+void TestHistogramEvenFloatBoundaries()
+{
+  thrust::device_vector<float> samples(6);
+  samples[0] = -0.5f;
+  samples[1] = 0.0f;
+  samples[2] = 0.99999994f;
+  samples[3] = 1.0f;
+  samples[4] = std::numeric_limits<float>::quiet_NaN();
+  samples[5] = std::numeric_limits<float>::infinity();
+
+  thrust::device_vector<int> counts(3);
+
+  thrust::histogram_even(samples.begin(), samples.end(), counts.begin(), 4, 0.0f, 1.0f);
+
+  ASSERT_EQUAL(counts[0], 1);
+  ASSERT_EQUAL(counts[1], 0);
+  ASSERT_EQUAL(counts[2], 1);
+}
+DECLARE_UNITTEST(TestHistogramEvenFloatBoundaries);
+
+void TestHistogramLarge()
+{
+  const int n = 1 << 20;
+
+  thrust::device_vector<int> counts(1000);
+
+  thrust::histogram_even(
+    thrust::counting_iterator<int>(0), thrust::counting_iterator<int>(n), counts.begin(), 1001, 0, 1000 * 1000);
+
+  ASSERT_EQUAL(1000, thrust::count(counts.begin(), counts.end(), 1000));
+}
+DECLARE_UNITTEST(TestHistogramLarge);
+
+void TestHistogramNoBins()
+{
+  thrust::device_vector<int> samples(10, 1);
+  thrust::device_vector<int> counts(1, 13);
+
+  ASSERT_EQUAL_QUIET(counts.begin(), thrust::histogram_even(samples.begin(), samples.end(), counts.begin(), 1, 0, 2));
+  ASSERT_EQUAL(counts[0], 13);
+}
+DECLARE_UNITTEST(TestHistogramNoBins);
+
+template <typename RandomAccessIterator, typename OutputIterator, typename Level>
+OutputIterator
+histogram_even(my_system& system, RandomAccessIterator, RandomAccessIterator, OutputIterator result, int, Level, Level)
+{
+  system.validate_dispatch();
+  return result;
+}
+
+void TestHistogramEvenDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::histogram_even(sys, vec.begin(), vec.end(), vec.begin(), 2, 0, 1);
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestHistogramEvenDispatchExplicit);
+
+template <typename RandomAccessIterator, typename OutputIterator, typename Level>
+OutputIterator
+histogram_even(my_tag, RandomAccessIterator, RandomAccessIterator, OutputIterator result, int, Level, Level)
+{
+  *result = 13;
+  return result;
+}
+
+void TestHistogramEvenDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::histogram_even(
+    thrust::retag<my_tag>(vec.begin()), thrust::retag<my_tag>(vec.end()), thrust::retag<my_tag>(vec.begin()), 2, 0, 1);
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestHistogramEvenDispatchImplicit);
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator>
+OutputIterator histogram_range(
+  my_system& system,
+  RandomAccessIterator1,
+  RandomAccessIterator1,
+  RandomAccessIterator2,
+  RandomAccessIterator2,
+  OutputIterator result)
+{
+  system.validate_dispatch();
+  return result;
+}
+
+void TestHistogramRangeDispatchExplicit()
+{
+  thrust::device_vector<int> vec(2);
+
+  my_system sys(0);
+  thrust::histogram_range(sys, vec.begin(), vec.end(), vec.begin(), vec.end(), vec.begin());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestHistogramRangeDispatchExplicit);
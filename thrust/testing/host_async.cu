@@ -0,0 +1,247 @@
+#include <thrust/detail/config.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#  include <thrust/async/copy.h>
+#  include <thrust/async/for_each.h>
+#  include <thrust/async/reduce.h>
+#  include <thrust/async/scan.h>
+#  include <thrust/async/sort.h>
+#  include <thrust/async/transform.h>
+#  include <thrust/device_vector.h>
+#  include <thrust/host_vector.h>
+#  include <thrust/iterator/transform_output_iterator.h>
+#  include <thrust/reverse.h>
+#  include <thrust/sequence.h>
+#  include <thrust/sort.h>
+
+#  include <stdexcept>
+
+#  include <unittest/unittest.h>
+
+struct host_async_negate
+{
+  int operator()(int x) const
+  {
+    return -x;
+  }
+};
+
+struct host_async_increment
+{
+  void operator()(int& x) const
+  {
+    ++x;
+  }
+};
+
+struct host_async_throw
+{
+  int operator()(int) const
+  {
+    throw std::runtime_error("host_async_throw");
+  }
+};
+
+void TestHostAsyncEventDefaultConstructed()
+{
+  thrust::device_event e0;
+
+  ASSERT_EQUAL(false, e0.valid_stream());
+  ASSERT_THROWS_EQUAL(e0.wait(), thrust::event_error, thrust::event_error(thrust::event_errc::no_state));
+
+  thrust::device_future<int> f0;
+
+  ASSERT_EQUAL(false, f0.valid_content());
+  ASSERT_THROWS_EQUAL(f0.get(), thrust::event_error, thrust::event_error(thrust::event_errc::no_content));
+}
+DECLARE_UNITTEST(TestHostAsyncEventDefaultConstructed);
+
+template <typename T>
+struct TestHostAsyncReduce
+{
+  void operator()(std::size_t n)
+  {
+    thrust::host_vector<T> h0 = unittest::random_integers<T>(n);
+    thrust::device_vector<T> d0(h0);
+
+    auto f0 = thrust::async::reduce(d0.begin(), d0.end());
+    auto f1 = thrust::async::reduce(thrust::device, d0.begin(), d0.end(), T(1), thrust::plus<T>());
+
+    ASSERT_EQUAL(thrust::reduce(h0.begin(), h0.end()), f0.get());
+    ASSERT_EQUAL(thrust::reduce(h0.begin(), h0.end(), T(1), thrust::plus<T>()), f1.extract());
+    ASSERT_EQUAL(true, f0.valid_content());
+    ASSERT_EQUAL(false, f1.valid_content());
+  }
+};
+VariableUnitTest<TestHostAsyncReduce, IntegralTypes> TestHostAsyncReduceInstance;
+
+template <typename T>
+struct TestHostAsyncReduceInto
+{
+  void operator()(std::size_t n)
+  {
+    thrust::host_vector<T> h0 = unittest::random_integers<T>(n);
+    thrust::device_vector<T> d0(h0);
+    thrust::device_vector<T> d1(1);
+
+    auto e0 = thrust::async::reduce_into(thrust::device, d0.begin(), d0.end(), d1.begin());
+    e0.wait();
+
+    ASSERT_EQUAL(true, e0.ready());
+    ASSERT_EQUAL(thrust::reduce(h0.begin(), h0.end()), d1[0]);
+  }
+};
+VariableUnitTest<TestHostAsyncReduceInto, IntegralTypes> TestHostAsyncReduceIntoInstance;
+
+template <typename T>
+struct TestHostAsyncSort
+{
+  void operator()(std::size_t n)
+  {
+    thrust::host_vector<T> h0 = unittest::random_integers<T>(n);
+    thrust::device_vector<T> d0(h0);
+    thrust::device_vector<T> d1(h0);
+
+    auto e0 = thrust::async::sort(thrust::device, d0.begin(), d0.end());
+    auto e1 = thrust::async::stable_sort(thrust::device, d1.begin(), d1.end(), thrust::greater<T>());
+
+    thrust::sort(h0.begin(), h0.end());
+
+    e0.wait();
+    ASSERT_EQUAL(h0, d0);
+
+    e1.wait();
+    thrust::reverse(h0.begin(), h0.end());
+    ASSERT_EQUAL(h0, d1);
+  }
+};
+VariableUnitTest<TestHostAsyncSort, IntegralTypes> TestHostAsyncSortInstance;
+
+template <typename T>
+struct TestHostAsyncScan
+{
+  void operator()(std::size_t n)
+  {
+    thrust::host_vector<T> h0 = unittest::random_integers<T>(n);
+    thrust::host_vector<T> h1(n);
+    thrust::host_vector<T> h2(n);
+    thrust::device_vector<T> d0(h0);
+    thrust::device_vector<T> d1(n);
+    thrust::device_vector<T> d2(n);
+
+    auto e0 = thrust::async::inclusive_scan(thrust::device, d0.begin(), d0.end(), d1.begin());
+    auto e1 = thrust::async::exclusive_scan(thrust::device, d0.begin(), d0.end(), d2.begin(), T(3));
+
+    thrust::inclusive_scan(h0.begin(), h0.end(), h1.begin());
+    thrust::exclusive_scan(h0.begin(), h0.end(), h2.begin(), T(3));
+
+    e0.wait();
+    e1.wait();
+
+    ASSERT_EQUAL(h1, d1);
+    ASSERT_EQUAL(h2, d2);
+  }
+};
+VariableUnitTest<TestHostAsyncScan, IntegralTypes> TestHostAsyncScanInstance;
+
+void TestHostAsyncCopy()
+{
+  thrust::host_vector<int> h0(1000);
+  thrust::sequence(h0.begin(), h0.end());
+
+  thrust::device_vector<int> d0(h0.size());
+  thrust::device_vector<int> d1(h0.size());
+  thrust::host_vector<int> h1(h0.size());
+
+  auto e0 = thrust::async::copy(thrust::host, thrust::device, h0.begin(), h0.end(), d0.begin());
+  auto e1 = thrust::async::copy(thrust::device.after(e0), d0.begin(), d0.end(), d1.begin());
+  auto e2 = thrust::async::copy(thrust::device.after(e1), thrust::host, d1.begin(), d1.end(), h1.begin());
+  e2.wait();
+
+  ASSERT_EQUAL(h0, h1);
+}
+DECLARE_UNITTEST(TestHostAsyncCopy);
+
+// Each step only starts once the one it was launched after has completed.
+void TestHostAsyncChain()
+{
+  thrust::device_vector<int> d0(1000);
+  thrust::device_vector<int> d1(1000);
+  thrust::sequence(d0.begin(), d0.end());
+
+  auto e0 = thrust::async::for_each(thrust::device, d0.begin(), d0.end(), host_async_increment{});
+  auto e1 = thrust::async::transform(thrust::device.after(e0), d0.begin(), d0.end(), d1.begin(), host_async_negate{});
+  auto f0 = thrust::async::reduce(thrust::device.after(e1), d1.begin(), d1.end());
+
+  ASSERT_EQUAL(-500500, f0.get());
+}
+DECLARE_UNITTEST(TestHostAsyncChain);
+
+// The reduction of d0 waits for both increments, so once its result is ready,
+// d1 has been incremented as well.
+void TestHostAsyncWhenAll()
+{
+  thrust::device_vector<int> d0(1000, 1);
+  thrust::device_vector<int> d1(1000, 2);
+
+  auto e0 = thrust::async::for_each(thrust::device, d0.begin(), d0.end(), host_async_increment{});
+  auto e1 = thrust::async::for_each(thrust::device, d1.begin(), d1.end(), host_async_increment{});
+  auto e2 = thrust::when_all(e0, e1);
+
+  auto f0 = thrust::async::reduce(thrust::device.after(e2), d0.begin(), d0.end());
+  ASSERT_EQUAL(2000, f0.get());
+
+  auto f1 = thrust::async::reduce(thrust::device, d1.begin(), d1.end());
+  ASSERT_EQUAL(3000, f1.get());
+}
+DECLARE_UNITTEST(TestHostAsyncWhenAll);
+
+// An exception thrown by an algorithm skips everything depending on it and
+// surfaces from the last result in the chain. It is raised while storing the
+// result, since exceptions may not escape the parallel regions of OpenMP.
+void TestHostAsyncExceptionPropagation()
+{
+  thrust::device_vector<int> d0(10);
+  thrust::device_vector<int> d1(1);
+
+  auto e0 = thrust::async::reduce_into(
+    thrust::device,
+    d0.begin(),
+    d0.end(),
+    thrust::make_transform_output_iterator(d1.begin(), host_async_throw{}),
+    0,
+    thrust::plus<int>());
+  auto e1 = thrust::async::for_each(thrust::device.after(e0), d0.begin(), d0.end(), host_async_increment{});
+  auto f0 = thrust::async::reduce(thrust::device.after(e1), d0.begin(), d0.end());
+
+  ASSERT_THROWS(f0.get(), std::runtime_error);
+  ASSERT_EQUAL(0, thrust::reduce(d0.begin(), d0.end()));
+
+  // Waiting rethrows as well, for chains ending in an event or a future.
+  auto e2 = thrust::async::reduce_into(
+    thrust::device,
+    d0.begin(),
+    d0.end(),
+    thrust::make_transform_output_iterator(d1.begin(), host_async_throw{}),
+    0,
+    thrust::plus<int>());
+  auto e3 = thrust::async::for_each(thrust::device.after(e2), d0.begin(), d0.end(), host_async_increment{});
+
+  ASSERT_THROWS(e3.wait(), std::runtime_error);
+  ASSERT_EQUAL(0, thrust::reduce(d0.begin(), d0.end()));
+
+  auto e4 = thrust::async::reduce_into(
+    thrust::device,
+    d0.begin(),
+    d0.end(),
+    thrust::make_transform_output_iterator(d1.begin(), host_async_throw{}),
+    0,
+    thrust::plus<int>());
+  auto f1 = thrust::async::reduce(thrust::device.after(e4), d0.begin(), d0.end());
+
+  ASSERT_THROWS(f1.wait(), std::runtime_error);
+}
+DECLARE_UNITTEST(TestHostAsyncExceptionPropagation);
+
+#endif
@@ -0,0 +1,167 @@
+#define THRUST_ENABLE_INSTRUMENTATION
+
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/instrumentation.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <string>
+#include <vector>
+
+#include <unittest/unittest.h>
+
+struct recorded_event
+{
+  std::string algorithm;
+  std::string system;
+  std::size_t size;
+  std::size_t temporary_bytes;
+  int threads;
+  int depth;
+};
+
+static std::vector<recorded_event> recorded_events;
+
+void record_event(const thrust::algorithm_event& e)
+{
+  recorded_events.push_back(recorded_event{e.algorithm, e.system, e.size, e.temporary_bytes, e.threads, e.depth});
+}
+
+// the events of the algorithms the test called itself
+std::vector<recorded_event> outermost_events()
+{
+  std::vector<recorded_event> result;
+
+  for (const recorded_event& e : recorded_events)
+  {
+    if (e.depth == 0)
+    {
+      result.push_back(e);
+    }
+  }
+
+  return result;
+}
+
+const char* device_system_name()
+{
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  return "omp";
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  return "tbb";
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CPP
+  return "cpp";
+#else
+  return "cuda";
+#endif
+}
+
+void TestInstrumentationHook()
+{
+  thrust::device_vector<int> d(1000);
+  thrust::sequence(d.begin(), d.end());
+
+  recorded_events.clear();
+  ASSERT_EQUAL(thrust::set_algorithm_hook(record_event) == nullptr, true);
+  ASSERT_EQUAL(thrust::get_algorithm_hook() == record_event, true);
+
+  thrust::sort(d.begin(), d.end(), thrust::greater<int>());
+  thrust::reduce(thrust::host, d.begin(), d.begin() + 10);
+  thrust::reduce(thrust::seq, d.begin(), d.begin() + 5);
+
+  ASSERT_EQUAL(thrust::set_algorithm_hook(nullptr) == record_event, true);
+
+  // sort, which may be built from other algorithms, and both reductions
+  const std::vector<recorded_event> events = outermost_events();
+  ASSERT_EQUAL(events.size(), 3u);
+
+  ASSERT_EQUAL(events[0].algorithm, "thrust::sort");
+  ASSERT_EQUAL(events[0].system, device_system_name());
+  ASSERT_EQUAL(events[0].size, 1000u);
+
+  ASSERT_EQUAL(events[1].algorithm, "thrust::reduce");
+  ASSERT_EQUAL(events[1].system, "cpp");
+  ASSERT_EQUAL(events[1].size, 10u);
+  ASSERT_EQUAL(events[1].threads, 1);
+
+  ASSERT_EQUAL(events[2].algorithm, "thrust::reduce");
+  ASSERT_EQUAL(events[2].system, "seq");
+  ASSERT_EQUAL(events[2].size, 5u);
+
+  // no hook, no events
+  recorded_events.clear();
+  thrust::sort(d.begin(), d.end());
+  ASSERT_EQUAL(recorded_events.size(), 0u);
+}
+DECLARE_UNITTEST(TestInstrumentationHook);
+
+void TestInstrumentationSameNameIsReportedOnce()
+{
+  thrust::device_vector<int> d(100);
+
+  recorded_events.clear();
+  thrust::set_algorithm_hook(record_event);
+
+  // sort without a comparator sorts with thrust::less
+  thrust::sort(d.begin(), d.end());
+
+  thrust::set_algorithm_hook(nullptr);
+
+  int sorts = 0;
+  for (const recorded_event& e : recorded_events)
+  {
+    sorts += e.algorithm == "thrust::sort" ? 1 : 0;
+  }
+
+  ASSERT_EQUAL(sorts, 1);
+}
+DECLARE_UNITTEST(TestInstrumentationSameNameIsReportedOnce);
+
+void TestInstrumentationTemporaryBytes()
+{
+  thrust::device_vector<int> keys(1 << 16);
+  thrust::device_vector<int> values(keys.size());
+  thrust::sequence(keys.rbegin(), keys.rend());
+
+  recorded_events.clear();
+  thrust::set_algorithm_hook(record_event);
+
+  // merging needs somewhere to put the merged keys and values
+  thrust::stable_sort_by_key(keys.begin(), keys.end(), values.begin());
+
+  thrust::set_algorithm_hook(nullptr);
+
+  const std::vector<recorded_event> events = outermost_events();
+  ASSERT_EQUAL(events.size(), 1u);
+  ASSERT_EQUAL(events[0].algorithm, "thrust::stable_sort_by_key");
+  ASSERT_EQUAL(events[0].temporary_bytes > 0, true);
+}
+DECLARE_UNITTEST(TestInstrumentationTemporaryBytes);
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+struct noop
+{
+  void operator()(int) const {}
+};
+
+void TestInstrumentationOmpThreads()
+{
+  thrust::device_vector<int> d(1000);
+
+  recorded_events.clear();
+  thrust::set_algorithm_hook(record_event);
+
+  thrust::for_each(thrust::omp::par.with_threads(2), d.begin(), d.end(), noop());
+
+  thrust::set_algorithm_hook(nullptr);
+
+  const std::vector<recorded_event> events = outermost_events();
+  ASSERT_EQUAL(events.size(), 1u);
+  ASSERT_EQUAL(events[0].algorithm, "thrust::for_each");
+  ASSERT_EQUAL(events[0].threads, 2);
+}
+DECLARE_UNITTEST(TestInstrumentationOmpThreads);
+#endif
@@ -5,8 +5,12 @@
 #include <thrust/reverse.h>
 #include <thrust/sequence.h>
 #include <thrust/sort.h>
+#include <thrust/system/cpp/execution_policy.h>
+#include <thrust/system/cpp/memory.h>
 
 #include <iostream>
+#include <thread>
+#include <vector>
 
 #include <unittest/unittest.h>
 
@@ -182,6 +186,79 @@ void TestGetTemporaryBuffer()
 }
 DECLARE_UNITTEST(TestGetTemporaryBuffer);
 
+void TestGetTemporaryBufferHostCache()
+{
+  const std::ptrdiff_t n  = 1 << 20;
+  const std::size_t limit = thrust::cpp::get_temporary_cache_limit();
+
+  thrust::cpp::set_temporary_cache_limit(sizeof(int) * n);
+  ASSERT_EQUAL(thrust::cpp::get_temporary_cache_limit(), sizeof(int) * n);
+
+  thrust::cpp::tag host_sys;
+  using pointer                               = thrust::pointer<int, thrust::cpp::tag>;
+  thrust::pair<pointer, std::ptrdiff_t> first = thrust::get_temporary_buffer<int>(host_sys, n);
+  ASSERT_EQUAL(first.second, n);
+
+  int* cached = first.first.get();
+  thrust::return_temporary_buffer(host_sys, first.first, first.second);
+
+  // the buffer stays with the thread while the cache has room for it
+  thrust::pair<pointer, std::ptrdiff_t> second = thrust::get_temporary_buffer<int>(host_sys, n);
+  ASSERT_EQUAL(second.first.get(), cached);
+  thrust::return_temporary_buffer(host_sys, second.first, second.second);
+
+  thrust::cpp::release_temporary_cache();
+  thrust::cpp::set_temporary_cache_limit(limit);
+}
+DECLARE_UNITTEST(TestGetTemporaryBufferHostCache);
+
+void TestGetTemporaryBufferHostCacheAcrossThreads()
+{
+  using buffer = decltype(thrust::get_temporary_buffer<int>(thrust::cpp::par, 0));
+
+  // large buffers are cached one by one, small ones are carved out of chunks
+  for (std::ptrdiff_t n : {std::ptrdiff_t(1) << 20, std::ptrdiff_t(10)})
+  {
+    std::vector<buffer> buffers;
+
+    // returned on another thread than the one which got them
+    std::thread getter([&] {
+      for (int i = 0; i < 4; ++i)
+      {
+        buffers.push_back(thrust::get_temporary_buffer<int>(thrust::cpp::par, n));
+        thrust::fill_n(buffers.back().first, n, i);
+      }
+    });
+    getter.join();
+
+    for (int i = 0; i < 4; ++i)
+    {
+      ASSERT_EQUAL(buffers[i].second, n);
+      ASSERT_EQUAL(true, thrust::all_of(buffers[i].first, buffers[i].first + n, thrust::placeholders::_1 == i));
+    }
+
+    // and those of a thread which has exited as well
+    std::thread returner([&] {
+      for (int i = 0; i < 2; ++i)
+      {
+        thrust::return_temporary_buffer(thrust::cpp::par, buffers[i].first, buffers[i].second);
+      }
+    });
+    returner.join();
+
+    for (int i = 2; i < 4; ++i)
+    {
+      thrust::return_temporary_buffer(thrust::cpp::par, buffers[i].first, buffers[i].second);
+    }
+
+    // the cache of this thread is left as it was
+    buffer own = thrust::get_temporary_buffer<int>(thrust::cpp::par, n);
+    ASSERT_EQUAL(own.second, n);
+    thrust::return_temporary_buffer(thrust::cpp::par, own.first, own.second);
+  }
+}
+DECLARE_UNITTEST(TestGetTemporaryBufferHostCacheAcrossThreads);
+
 void TestMalloc()
 {
   const std::ptrdiff_t n = 9001;
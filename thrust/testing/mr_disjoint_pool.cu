@@ -4,6 +4,8 @@
 #include <thrust/mr/disjoint_sync_pool.h>
 #include <thrust/mr/new.h>
 
+#include <vector>
+
 #include <unittest/unittest.h>
 
 struct alloc_id
@@ -263,6 +265,151 @@ void TestDisjointSynchronizedPoolCachingOversized()
 }
 DECLARE_UNITTEST(TestDisjointSynchronizedPoolCachingOversized);
 
+template <template <typename, typename> class PoolTemplate>
+void TestDisjointPoolCacheLimit()
+{
+  dummy_resource upstream;
+  thrust::mr::new_delete_resource bookkeeper;
+
+  using Pool = PoolTemplate<dummy_resource, thrust::mr::new_delete_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.largest_block_size       = 1024;
+  opts.max_cached_bytes         = 4096;
+
+  Pool pool(&upstream, &bookkeeper, opts);
+
+  upstream.id_to_allocate = 1;
+  alloc_id a1             = pool.do_allocate(2048, 32);
+  upstream.id_to_allocate = 2;
+  alloc_id a2             = pool.do_allocate(2048, 32);
+  upstream.id_to_allocate = 3;
+  alloc_id a3             = pool.do_allocate(4096, 32);
+
+  // the first two blocks fill the cache up to its limit
+  pool.do_deallocate(a1, 2048, 32);
+  pool.do_deallocate(a2, 2048, 32);
+
+  // so the third one goes back to upstream
+  upstream.id_to_deallocate = 3;
+  pool.do_deallocate(a3, 4096, 32);
+  ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+
+  upstream.id_to_allocate = 4;
+  alloc_id a4             = pool.do_allocate(4096, 32);
+  ASSERT_EQUAL(a4.id, 4u);
+
+  // a block taken out of the cache still doesn't make enough room for a bigger one
+  alloc_id a5 = pool.do_allocate(2048, 32);
+  ASSERT_EQUAL(a5.id == 1u || a5.id == 2u, true);
+
+  upstream.id_to_deallocate = 4;
+  pool.do_deallocate(a4, 4096, 32);
+  ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+
+  // but the block itself fits back in
+  upstream.id_to_deallocate = a5.id;
+  pool.do_deallocate(a5, 2048, 32);
+  ASSERT_EQUAL(upstream.id_to_deallocate, a5.id);
+  upstream.id_to_deallocate = 0;
+}
+
+void TestDisjointUnsynchronizedPoolCacheLimit()
+{
+  TestDisjointPoolCacheLimit<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointUnsynchronizedPoolCacheLimit);
+
+template <template <typename, typename> class PoolTemplate>
+void TestDisjointPoolTrim()
+{
+  dummy_resource upstream;
+  thrust::mr::new_delete_resource bookkeeper;
+
+  using Pool = PoolTemplate<dummy_resource, thrust::mr::new_delete_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.largest_block_size       = 1024;
+
+  Pool pool(&upstream, &bookkeeper, opts);
+
+  upstream.id_to_allocate = 1;
+  alloc_id a1             = pool.do_allocate(2048, 32);
+  upstream.id_to_allocate = 2;
+  alloc_id a2             = pool.do_allocate(8192, 32);
+
+  pool.do_deallocate(a1, 2048, 32);
+  pool.do_deallocate(a2, 8192, 32);
+
+  // the largest blocks go first
+  upstream.id_to_deallocate = 2;
+  pool.trim(4096);
+  ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+
+  // what remains cached is still handed out
+  alloc_id a3 = pool.do_allocate(2048, 32);
+  ASSERT_EQUAL(a3.id, 1u);
+  pool.do_deallocate(a3, 2048, 32);
+
+  upstream.id_to_deallocate = 1;
+  pool.trim(0);
+  ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+}
+
+void TestDisjointUnsynchronizedPoolTrim()
+{
+  TestDisjointPoolTrim<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointUnsynchronizedPoolTrim);
+
+void TestDisjointSynchronizedPoolTrim()
+{
+  TestDisjointPoolTrim<thrust::mr::disjoint_synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointSynchronizedPoolTrim);
+
+template <template <typename, typename> class PoolTemplate>
+void TestDisjointPoolManyOversized()
+{
+  dummy_resource upstream;
+  thrust::mr::new_delete_resource bookkeeper;
+
+  using Pool = PoolTemplate<dummy_resource, thrust::mr::new_delete_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = false;
+
+  Pool pool(&upstream, &bookkeeper, opts);
+
+  const std::size_t n = 100;
+  std::vector<alloc_id> blocks(n + 1);
+
+  for (std::size_t i = 1; i <= n; ++i)
+  {
+    upstream.id_to_allocate = i;
+    blocks[i]               = pool.do_allocate(opts.largest_block_size + i, std::size_t(64) << (i % 4));
+    ASSERT_EQUAL(blocks[i].id, i);
+  }
+
+  // every block is returned to upstream, regardless of the order of deallocation
+  for (std::size_t j = 0; j < n; ++j)
+  {
+    const std::size_t i = (j * 37) % n + 1;
+
+    upstream.id_to_deallocate = i;
+    pool.do_deallocate(blocks[i], opts.largest_block_size + i, std::size_t(64) << (i % 4));
+    ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+  }
+}
+
+void TestDisjointUnsynchronizedPoolManyOversized()
+{
+  TestDisjointPoolManyOversized<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointUnsynchronizedPoolManyOversized);
+
 template <template <typename, typename> class PoolTemplate>
 void TestDisjointGlobalPool()
 {
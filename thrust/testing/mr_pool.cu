@@ -2,8 +2,12 @@
 
 #include <thrust/mr/new.h>
 #include <thrust/mr/pool.h>
+#include <thrust/mr/sharded_pool.h>
 #include <thrust/mr/sync_pool.h>
 
+#include <thread>
+#include <vector>
+
 #include <unittest/unittest.h>
 
 template <typename T>
@@ -244,6 +248,12 @@ void TestSynchronizedPool()
 }
 DECLARE_UNITTEST(TestSynchronizedPool);
 
+void TestShardedPool()
+{
+  TestPool<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedPool);
+
 template <template <typename> class PoolTemplate>
 void TestPoolCachingOversized()
 {
@@ -353,6 +363,12 @@ void TestSynchronizedPoolCachingOversized()
 }
 DECLARE_UNITTEST(TestSynchronizedPoolCachingOversized);
 
+void TestShardedPoolCachingOversized()
+{
+  TestPoolCachingOversized<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedPoolCachingOversized);
+
 template <template <typename> class PoolTemplate>
 void TestGlobalPool()
 {
@@ -372,3 +388,70 @@ void TestSynchronizedGlobalPool()
   TestGlobalPool<thrust::mr::synchronized_pool_resource>();
 }
 DECLARE_UNITTEST(TestSynchronizedGlobalPool);
+
+void TestShardedGlobalPool()
+{
+  TestGlobalPool<thrust::mr::sharded_pool_resource>();
+}
+DECLARE_UNITTEST(TestShardedGlobalPool);
+
+void TestShardedPoolCrossThreadDeallocation()
+{
+  using Pool = thrust::mr::sharded_pool_resource<thrust::mr::new_delete_resource>;
+
+  thrust::mr::new_delete_resource upstream;
+  Pool pool(&upstream);
+
+  const int num_threads = 4;
+  const int num_blocks  = 1000;
+
+  // every thread frees the blocks allocated by its neighbor, which are checked
+  // to still hold what was written to them
+  std::vector<std::vector<int*>> blocks(num_threads);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < num_blocks; ++i)
+      {
+        const std::size_t size = sizeof(int) << (i % 8);
+        int* p                 = static_cast<int*>(pool.do_allocate(size));
+        *p                     = t * num_blocks + i;
+        blocks[t].push_back(p);
+      }
+    });
+  }
+
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+  threads.clear();
+
+  std::vector<int> mismatches(num_threads, 0);
+
+  for (int t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back([&, t] {
+      const int owner = (t + 1) % num_threads;
+      for (int i = 0; i < num_blocks; ++i)
+      {
+        int* p = blocks[owner][i];
+        mismatches[t] += *p != owner * num_blocks + i;
+        pool.do_deallocate(p, sizeof(int) << (i % 8));
+      }
+    });
+  }
+
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+
+  for (int t = 0; t < num_threads; ++t)
+  {
+    ASSERT_EQUAL(mismatches[t], 0);
+  }
+}
+DECLARE_UNITTEST(TestShardedPoolCrossThreadDeallocation);
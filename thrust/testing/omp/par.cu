@@ -0,0 +1,464 @@
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/merge.h>
+#include <thrust/partition.h>
+#include <thrust/random.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/set_operations.h>
+#include <thrust/shuffle.h>
+#include <thrust/sort.h>
+#include <thrust/system/omp/execution_policy.h>
+#include <thrust/transform.h>
+#include <thrust/unique.h>
+
+#include <omp.h>
+
+#include <unittest/unittest.h>
+
+struct record_team_size
+{
+  int* max_team_size;
+
+  void operator()(int&) const
+  {
+    const int team_size = omp_get_num_threads();
+
+    THRUST_PRAGMA_OMP(critical)
+    if (team_size > *max_team_size)
+    {
+      *max_team_size = team_size;
+    }
+  }
+};
+
+void TestOmpParWithThreads()
+{
+  thrust::host_vector<int> data(1000);
+
+  int max_team_size = 0;
+  thrust::for_each(thrust::omp::par.with_threads(2), data.begin(), data.end(), record_team_size{&max_team_size});
+  ASSERT_EQUAL(max_team_size, 2);
+
+  max_team_size = 0;
+  thrust::for_each(thrust::omp::par.with_threads(1), data.begin(), data.end(), record_team_size{&max_team_size});
+  ASSERT_EQUAL(max_team_size, 1);
+}
+DECLARE_UNITTEST(TestOmpParWithThreads);
+
+void TestOmpParShuffleWithThreads()
+{
+  thrust::host_vector<int> data((1 << 18) + 5);
+  thrust::sequence(data.begin(), data.end());
+
+  thrust::host_vector<int> expected(data.size());
+  thrust::default_random_engine expected_g(5);
+  thrust::shuffle_copy(thrust::omp::par.with_threads(1), data.begin(), data.end(), expected.begin(), expected_g);
+
+  // the permutation depends only on the seed, however many threads compute it
+  for (int threads = 2; threads <= 4; ++threads)
+  {
+    thrust::host_vector<int> result(data.size());
+    thrust::default_random_engine g(5);
+    thrust::shuffle_copy(thrust::omp::par.with_threads(threads), data.begin(), data.end(), result.begin(), g);
+    ASSERT_EQUAL(expected, result);
+  }
+
+  thrust::default_random_engine g(5);
+  thrust::shuffle(thrust::omp::par.with_threads(3).with_grain(1000), data.begin(), data.end(), g);
+  ASSERT_EQUAL(expected, data);
+}
+DECLARE_UNITTEST(TestOmpParShuffleWithThreads);
+
+template <typename T>
+struct TestOmpParWithThreadsAndGrain
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+    thrust::host_vector<T> d_data = h_data;
+
+    auto policy = thrust::omp::par.with_threads(3).with_grain(7);
+
+    ASSERT_EQUAL(thrust::reduce(h_data.begin(), h_data.end()), thrust::reduce(policy, d_data.begin(), d_data.end()));
+
+    thrust::host_vector<T> h_result(n);
+    thrust::host_vector<T> d_result(n);
+    thrust::inclusive_scan(h_data.begin(), h_data.end(), h_result.begin());
+    thrust::inclusive_scan(policy, d_data.begin(), d_data.end(), d_result.begin());
+    ASSERT_EQUAL(h_result, d_result);
+
+    thrust::stable_sort(h_data.begin(), h_data.end());
+    thrust::stable_sort(policy, d_data.begin(), d_data.end());
+    ASSERT_EQUAL(h_data, d_data);
+
+    h_result.resize(2 * n);
+    d_result.resize(2 * n);
+    thrust::merge(h_data.begin(), h_data.end(), h_data.begin(), h_data.end(), h_result.begin());
+    thrust::merge(policy, d_data.begin(), d_data.end(), d_data.begin(), d_data.end(), d_result.begin());
+    ASSERT_EQUAL(h_result, d_result);
+  }
+};
+VariableUnitTest<TestOmpParWithThreadsAndGrain, IntegralTypes> TestOmpParWithThreadsAndGrainInstance;
+
+void TestOmpParUniqueByKeyWithThreads()
+{
+  thrust::host_vector<int> keys = unittest::random_integers<bool>(100000);
+  thrust::host_vector<int> values(keys.size());
+  thrust::sequence(values.begin(), values.end());
+
+  thrust::host_vector<int> expected_keys   = keys;
+  thrust::host_vector<int> expected_values = values;
+  const auto expected_end =
+    thrust::unique_by_key(thrust::seq, expected_keys.begin(), expected_keys.end(), expected_values.begin());
+  expected_keys.erase(expected_end.first, expected_keys.end());
+  expected_values.erase(expected_end.second, expected_values.end());
+
+  // every thread compacts its own tile, whose groups are then moved together
+  for (int threads = 2; threads <= 4; ++threads)
+  {
+    thrust::host_vector<int> result_keys   = keys;
+    thrust::host_vector<int> result_values = values;
+    const auto result_end = thrust::unique_by_key(
+      thrust::omp::par.with_threads(threads), result_keys.begin(), result_keys.end(), result_values.begin());
+    result_keys.erase(result_end.first, result_keys.end());
+    result_values.erase(result_end.second, result_values.end());
+
+    ASSERT_EQUAL(expected_keys, result_keys);
+    ASSERT_EQUAL(expected_values, result_values);
+    ASSERT_EQUAL(thrust::unique_count(thrust::omp::par.with_threads(threads), keys.begin(), keys.end()),
+                 static_cast<int>(expected_keys.size()));
+  }
+}
+DECLARE_UNITTEST(TestOmpParUniqueByKeyWithThreads);
+
+struct is_nonzero
+{
+  bool operator()(int x) const
+  {
+    return x != 0;
+  }
+};
+
+void TestOmpParCompactionWithThreads()
+{
+  thrust::host_vector<int> values  = unittest::random_integers<int>(100000);
+  thrust::host_vector<int> stencil = unittest::random_integers<bool>(values.size());
+
+  thrust::host_vector<int> expected_selected(values.size());
+  expected_selected.erase(thrust::copy_if(thrust::seq,
+                                          values.begin(),
+                                          values.end(),
+                                          stencil.begin(),
+                                          expected_selected.begin(),
+                                          is_nonzero()),
+                          expected_selected.end());
+
+  thrust::host_vector<int> expected_kept = values;
+  expected_kept.erase(
+    thrust::remove_if(thrust::seq, expected_kept.begin(), expected_kept.end(), stencil.begin(), is_nonzero()),
+    expected_kept.end());
+
+  // every thread counts its own tile before writing it where the counts of the others say
+  for (int threads = 2; threads <= 4; ++threads)
+  {
+    thrust::host_vector<int> selected(values.size());
+    selected.erase(thrust::copy_if(thrust::omp::par.with_threads(threads),
+                                   values.begin(),
+                                   values.end(),
+                                   stencil.begin(),
+                                   selected.begin(),
+                                   is_nonzero()),
+                   selected.end());
+    ASSERT_EQUAL(expected_selected, selected);
+
+    thrust::host_vector<int> kept = values;
+    kept.erase(thrust::remove_if(
+                 thrust::omp::par.with_threads(threads), kept.begin(), kept.end(), stencil.begin(), is_nonzero()),
+               kept.end());
+    ASSERT_EQUAL(expected_kept, kept);
+
+    thrust::host_vector<int> out_true(values.size());
+    thrust::host_vector<int> out_false(values.size());
+    const auto ends = thrust::stable_partition_copy(
+      thrust::omp::par.with_threads(threads),
+      values.begin(),
+      values.end(),
+      stencil.begin(),
+      out_true.begin(),
+      out_false.begin(),
+      is_nonzero());
+    out_true.erase(ends.first, out_true.end());
+    out_false.erase(ends.second, out_false.end());
+    ASSERT_EQUAL(expected_selected, out_true);
+    ASSERT_EQUAL(expected_kept, out_false);
+  }
+}
+DECLARE_UNITTEST(TestOmpParCompactionWithThreads);
+
+void TestOmpParScanWithThreads()
+{
+  // one tile per thread, as long as every tile gets at least a few elements
+  auto policy = thrust::omp::par.with_threads(4).with_grain(3);
+
+  for (size_t n : {0, 1, 5, 12, 13, 1000, 12345})
+  {
+    thrust::host_vector<int> data = unittest::random_integers<int>(n);
+
+    thrust::host_vector<int> expected(n);
+    thrust::host_vector<int> result(n);
+
+    thrust::inclusive_scan(thrust::seq, data.begin(), data.end(), expected.begin());
+    ASSERT_EQUAL(thrust::inclusive_scan(policy, data.begin(), data.end(), result.begin()) - result.begin(),
+                 static_cast<std::ptrdiff_t>(n));
+    ASSERT_EQUAL(expected, result);
+
+    thrust::host_vector<int> in_place = data;
+    thrust::inclusive_scan(policy, in_place.begin(), in_place.end(), in_place.begin());
+    ASSERT_EQUAL(expected, in_place);
+
+    thrust::exclusive_scan(thrust::seq, data.begin(), data.end(), expected.begin(), 13);
+    ASSERT_EQUAL(thrust::exclusive_scan(policy, data.begin(), data.end(), result.begin(), 13) - result.begin(),
+                 static_cast<std::ptrdiff_t>(n));
+    ASSERT_EQUAL(expected, result);
+
+    in_place = data;
+    thrust::exclusive_scan(policy, in_place.begin(), in_place.end(), in_place.begin(), 13);
+    ASSERT_EQUAL(expected, in_place);
+
+    thrust::exclusive_scan(thrust::seq, data.begin(), data.end(), expected.begin(), 0, thrust::maximum<int>());
+    thrust::exclusive_scan(policy, data.begin(), data.end(), result.begin(), 0, thrust::maximum<int>());
+    ASSERT_EQUAL(expected, result);
+  }
+}
+DECLARE_UNITTEST(TestOmpParScanWithThreads);
+
+struct mod_4
+{
+  int operator()(int x) const
+  {
+    return static_cast<unsigned int>(x) % 4;
+  }
+};
+
+// sorted keys of only a few values, whose runs of equal keys span several tiles
+thrust::host_vector<int> sorted_runs(size_t n)
+{
+  thrust::host_vector<int> keys = unittest::random_integers<int>(n);
+  thrust::transform(keys.begin(), keys.end(), keys.begin(), mod_4());
+  thrust::sort(keys.begin(), keys.end());
+  return keys;
+}
+
+void TestOmpParMergeWithThreads()
+{
+  auto policy = thrust::omp::par.with_threads(4).with_grain(3);
+
+  for (size_t n : {0, 1, 7, 1000, 12345})
+  {
+    const thrust::host_vector<int> keys1 = sorted_runs(n);
+    const thrust::host_vector<int> keys2 = sorted_runs(n / 3 + 2);
+
+    // the values tell from which input, and where in it, every key comes from
+    thrust::host_vector<int> values1(keys1.size());
+    thrust::host_vector<int> values2(keys2.size());
+    thrust::sequence(values1.begin(), values1.end());
+    thrust::sequence(values2.begin(), values2.end(), -1, -1);
+
+    thrust::host_vector<int> expected_keys(keys1.size() + keys2.size());
+    thrust::host_vector<int> expected_values(expected_keys.size());
+    thrust::host_vector<int> result_keys(expected_keys.size());
+    thrust::host_vector<int> result_values(expected_keys.size());
+
+    thrust::merge(thrust::seq, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), expected_keys.begin());
+    ASSERT_EQUAL(thrust::merge(policy, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), result_keys.begin())
+                   - result_keys.begin(),
+                 static_cast<std::ptrdiff_t>(expected_keys.size()));
+    ASSERT_EQUAL(expected_keys, result_keys);
+
+    thrust::merge_by_key(
+      thrust::seq,
+      keys1.begin(),
+      keys1.end(),
+      keys2.begin(),
+      keys2.end(),
+      values1.begin(),
+      values2.begin(),
+      expected_keys.begin(),
+      expected_values.begin());
+    const auto result_end = thrust::merge_by_key(
+      policy,
+      keys1.begin(),
+      keys1.end(),
+      keys2.begin(),
+      keys2.end(),
+      values1.begin(),
+      values2.begin(),
+      result_keys.begin(),
+      result_values.begin());
+    ASSERT_EQUAL(result_end.first - result_keys.begin(), static_cast<std::ptrdiff_t>(expected_keys.size()));
+    ASSERT_EQUAL(result_end.second - result_values.begin(), static_cast<std::ptrdiff_t>(expected_keys.size()));
+    ASSERT_EQUAL(expected_keys, result_keys);
+    ASSERT_EQUAL(expected_values, result_values);
+  }
+}
+DECLARE_UNITTEST(TestOmpParMergeWithThreads);
+
+template <typename SetOperation>
+void check_set_operation_with_threads(SetOperation set_operation)
+{
+  auto policy = thrust::omp::par.with_threads(4).with_grain(3);
+
+  for (size_t n : {0, 1, 7, 1000, 12345})
+  {
+    for (size_t m : {size_t{0}, n / 3 + 2, 2 * n + 1})
+    {
+      const thrust::host_vector<int> keys1 = sorted_runs(n);
+      const thrust::host_vector<int> keys2 = sorted_runs(m);
+
+      thrust::host_vector<int> expected(n + m);
+      expected.erase(set_operation(thrust::seq, keys1, keys2, expected.begin()), expected.end());
+
+      thrust::host_vector<int> result(n + m);
+      result.erase(set_operation(policy, keys1, keys2, result.begin()), result.end());
+
+      ASSERT_EQUAL(expected, result);
+    }
+  }
+}
+
+struct call_set_difference
+{
+  template <typename Policy, typename Vector, typename Iterator>
+  Iterator operator()(Policy& exec, const Vector& keys1, const Vector& keys2, Iterator result) const
+  {
+    return thrust::set_difference(exec, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), result);
+  }
+};
+
+struct call_set_intersection
+{
+  template <typename Policy, typename Vector, typename Iterator>
+  Iterator operator()(Policy& exec, const Vector& keys1, const Vector& keys2, Iterator result) const
+  {
+    return thrust::set_intersection(exec, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), result);
+  }
+};
+
+struct call_set_symmetric_difference
+{
+  template <typename Policy, typename Vector, typename Iterator>
+  Iterator operator()(Policy& exec, const Vector& keys1, const Vector& keys2, Iterator result) const
+  {
+    return thrust::set_symmetric_difference(exec, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), result);
+  }
+};
+
+struct call_set_union
+{
+  template <typename Policy, typename Vector, typename Iterator>
+  Iterator operator()(Policy& exec, const Vector& keys1, const Vector& keys2, Iterator result) const
+  {
+    return thrust::set_union(exec, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), result);
+  }
+};
+
+void TestOmpParSetOperationsWithThreads()
+{
+  // equal keys are matched by their rank among the equal keys of the other
+  // input, also when their runs are split over tiles
+  check_set_operation_with_threads(call_set_difference());
+  check_set_operation_with_threads(call_set_intersection());
+  check_set_operation_with_threads(call_set_symmetric_difference());
+  check_set_operation_with_threads(call_set_union());
+}
+DECLARE_UNITTEST(TestOmpParSetOperationsWithThreads);
+
+// keys of segments from one to a few hundred elements long, so that with small
+// inputs some of them span several tiles
+thrust::host_vector<int> segmented_keys(size_t n)
+{
+  thrust::host_vector<int> lengths = unittest::random_integers<int>(n);
+  thrust::host_vector<int> keys(n);
+
+  int key = 0;
+  for (size_t i = 0; i < n; ++key)
+  {
+    const size_t length = 1 + static_cast<unsigned int>(lengths[i]) % 300;
+    for (size_t j = 0; j < length && i < n; ++j, ++i)
+    {
+      keys[i] = key;
+    }
+  }
+
+  return keys;
+}
+
+void TestOmpParReduceByKeyWithThreads()
+{
+  auto policy = thrust::omp::par.with_threads(4).with_grain(3);
+
+  for (size_t n : {0, 1, 7, 1000, 12345})
+  {
+    const thrust::host_vector<int> keys   = segmented_keys(n);
+    const thrust::host_vector<int> values = unittest::random_integers<int>(n);
+
+    thrust::host_vector<int> expected_keys(n);
+    thrust::host_vector<int> expected_values(n);
+    const auto expected_end = thrust::reduce_by_key(
+      thrust::seq, keys.begin(), keys.end(), values.begin(), expected_keys.begin(), expected_values.begin());
+    expected_keys.erase(expected_end.first, expected_keys.end());
+    expected_values.erase(expected_end.second, expected_values.end());
+
+    thrust::host_vector<int> result_keys(n);
+    thrust::host_vector<int> result_values(n);
+    const auto result_end = thrust::reduce_by_key(
+      policy, keys.begin(), keys.end(), values.begin(), result_keys.begin(), result_values.begin());
+    result_keys.erase(result_end.first, result_keys.end());
+    result_values.erase(result_end.second, result_values.end());
+
+    ASSERT_EQUAL(expected_keys, result_keys);
+    ASSERT_EQUAL(expected_values, result_values);
+  }
+}
+DECLARE_UNITTEST(TestOmpParReduceByKeyWithThreads);
+
+void TestOmpParScanByKeyWithThreads()
+{
+  auto policy = thrust::omp::par.with_threads(4).with_grain(3);
+
+  for (size_t n : {0, 1, 7, 1000, 12345})
+  {
+    const thrust::host_vector<int> keys   = segmented_keys(n);
+    const thrust::host_vector<int> values = unittest::random_integers<int>(n);
+
+    thrust::host_vector<int> expected(n);
+    thrust::host_vector<int> result(n);
+
+    // carries from earlier tiles have to reach the segments which span the
+    // tiles after them
+    thrust::inclusive_scan_by_key(thrust::seq, keys.begin(), keys.end(), values.begin(), expected.begin());
+    ASSERT_EQUAL(thrust::inclusive_scan_by_key(policy, keys.begin(), keys.end(), values.begin(), result.begin())
+                   - result.begin(),
+                 static_cast<std::ptrdiff_t>(n));
+    ASSERT_EQUAL(expected, result);
+
+    thrust::host_vector<int> in_place = values;
+    thrust::inclusive_scan_by_key(policy, keys.begin(), keys.end(), in_place.begin(), in_place.begin());
+    ASSERT_EQUAL(expected, in_place);
+
+    thrust::exclusive_scan_by_key(thrust::seq, keys.begin(), keys.end(), values.begin(), expected.begin(), 13);
+    ASSERT_EQUAL(thrust::exclusive_scan_by_key(policy, keys.begin(), keys.end(), values.begin(), result.begin(), 13)
+                   - result.begin(),
+                 static_cast<std::ptrdiff_t>(n));
+    ASSERT_EQUAL(expected, result);
+
+    in_place = values;
+    thrust::exclusive_scan_by_key(policy, keys.begin(), keys.end(), in_place.begin(), in_place.begin(), 13);
+    ASSERT_EQUAL(expected, in_place);
+  }
+}
+DECLARE_UNITTEST(TestOmpParScanByKeyWithThreads);
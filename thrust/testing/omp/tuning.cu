@@ -0,0 +1,232 @@
+#include <thrust/for_each.h>
+#include <thrust/merge.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/omp/tuning.h>
+
+#include <new>
+#include <omp.h>
+#include <sstream>
+
+#include <unittest/unittest.h>
+
+namespace
+{
+
+bool equal_profiles(const thrust::omp::tuning_profile& a, const thrust::omp::tuning_profile& b)
+{
+  for (std::size_t i = 0; i < thrust::system::detail::internal::num_tuning_families; ++i)
+  {
+    if (a.families[i].serial_cutoff != b.families[i].serial_cutoff
+        || a.families[i].tile_bytes != b.families[i].tile_bytes)
+    {
+      return false;
+    }
+  }
+
+  return a.max_threads == b.max_threads;
+}
+
+// restores the profile in effect when it goes out of scope
+struct profile_guard
+{
+  thrust::omp::tuning_profile saved;
+
+  profile_guard()
+      : saved(thrust::omp::get_tuning_profile())
+  {}
+
+  ~profile_guard()
+  {
+    thrust::omp::set_tuning_profile(saved);
+  }
+};
+
+struct record_team_size
+{
+  int* max_team_size;
+
+  void operator()(int&) const
+  {
+    const int team_size = omp_get_num_threads();
+
+    THRUST_PRAGMA_OMP(critical)
+    if (team_size > *max_team_size)
+    {
+      *max_team_size = team_size;
+    }
+  }
+};
+
+} // namespace
+
+void TestOmpTuningProfileRoundTrip()
+{
+  thrust::omp::tuning_profile profile       = thrust::omp::default_tuning_profile();
+  profile.max_threads                       = 3;
+  profile[thrust::omp::tuning_family::sort] = {123456, 789};
+
+  std::stringstream stream;
+  stream << profile;
+
+  thrust::omp::tuning_profile result;
+  stream >> result;
+
+  ASSERT_EQUAL(bool(stream), true);
+  ASSERT_EQUAL(equal_profiles(profile, result), true);
+}
+DECLARE_UNITTEST(TestOmpTuningProfileRoundTrip);
+
+void TestOmpTuningProfileParse()
+{
+  std::istringstream stream("# a comment\n"
+                            "\n"
+                            "scan 100 10\n"
+                            "some_future_family 1 2\n"
+                            "max_threads 2\n");
+
+  thrust::omp::tuning_profile result = thrust::omp::default_tuning_profile();
+  stream >> result;
+
+  ASSERT_EQUAL(bool(stream), true);
+  ASSERT_EQUAL(result.max_threads, 2);
+  ASSERT_EQUAL(result[thrust::omp::tuning_family::scan].serial_cutoff, 100u);
+  ASSERT_EQUAL(result[thrust::omp::tuning_family::scan].tile_bytes, 10u);
+  ASSERT_EQUAL(result[thrust::omp::tuning_family::sort].serial_cutoff,
+               thrust::omp::default_tuning_profile()[thrust::omp::tuning_family::sort].serial_cutoff);
+
+  std::istringstream malformed("reduce 100\n");
+  malformed >> result;
+
+  ASSERT_EQUAL(bool(malformed), false);
+}
+DECLARE_UNITTEST(TestOmpTuningProfileParse);
+
+void TestOmpTuningProfileCutoffs()
+{
+  profile_guard guard;
+
+  thrust::host_vector<int> data(1 << 16);
+
+  // nothing is large enough to run in parallel
+  thrust::omp::tuning_profile serial = thrust::omp::default_tuning_profile();
+  serial[thrust::omp::tuning_family::for_each].serial_cutoff = std::size_t(1) << 30;
+  thrust::omp::set_tuning_profile(serial);
+
+  int max_team_size = 0;
+  thrust::for_each(thrust::omp::par, data.begin(), data.end(), record_team_size{&max_team_size});
+  ASSERT_EQUAL(max_team_size, 1);
+
+  // unless the policy asks for a number of threads
+  max_team_size = 0;
+  thrust::for_each(thrust::omp::par.with_threads(2), data.begin(), data.end(), record_team_size{&max_team_size});
+  ASSERT_EQUAL(max_team_size, 2);
+
+  // everything runs in parallel on at most two threads, in tiles of a single element
+  thrust::omp::tuning_profile parallel;
+  parallel.max_threads = 2;
+  thrust::omp::set_tuning_profile(parallel);
+
+  max_team_size = 0;
+  thrust::for_each(thrust::omp::par, data.begin(), data.begin() + 8, record_team_size{&max_team_size});
+  ASSERT_EQUAL(max_team_size <= 2, true);
+
+  thrust::host_vector<int> h_data = unittest::random_integers<int>(10000);
+
+  for (int profile = 0; profile < 2; ++profile)
+  {
+    thrust::omp::set_tuning_profile(profile == 0 ? serial : parallel);
+
+    thrust::host_vector<int> keys(h_data.size());
+    thrust::sequence(keys.begin(), keys.end());
+
+    ASSERT_EQUAL(thrust::reduce(thrust::omp::par, keys.begin(), keys.end()), 49995000);
+
+    thrust::host_vector<int> sums(keys.size());
+    thrust::inclusive_scan(thrust::omp::par, keys.begin(), keys.end(), sums.begin());
+    ASSERT_EQUAL(sums.back(), 49995000);
+
+    thrust::host_vector<int> sorted = h_data;
+    thrust::sort(thrust::omp::par, sorted.begin(), sorted.end());
+    ASSERT_EQUAL(thrust::is_sorted(sorted.begin(), sorted.end()), true);
+
+    thrust::host_vector<int> merged(2 * keys.size());
+    thrust::merge(thrust::omp::par, keys.begin(), keys.end(), keys.begin(), keys.end(), merged.begin());
+    ASSERT_EQUAL(thrust::is_sorted(merged.begin(), merged.end()), true);
+  }
+}
+DECLARE_UNITTEST(TestOmpTuningProfileCutoffs);
+
+void TestOmpCalibrateTuningProfile()
+{
+  profile_guard guard;
+
+  thrust::omp::tuning_profile before = thrust::omp::get_tuning_profile();
+  before.max_threads                 = 2;
+  thrust::omp::set_tuning_profile(before);
+
+  const thrust::omp::tuning_profile result = thrust::omp::calibrate_tuning_profile();
+
+  // calibrating doesn't change the profile in effect
+  ASSERT_EQUAL(equal_profiles(before, thrust::omp::get_tuning_profile()), true);
+
+  ASSERT_EQUAL(result.max_threads, 2);
+
+  for (std::size_t i = 0; i < thrust::system::detail::internal::num_tuning_families; ++i)
+  {
+    ASSERT_EQUAL(result.families[i].serial_cutoff > 0, true);
+    ASSERT_EQUAL(result.families[i].tile_bytes > 0, true);
+  }
+}
+DECLARE_UNITTEST(TestOmpCalibrateTuningProfile);
+
+template <typename T>
+struct throwing_allocator
+{
+  using value_type = T;
+
+  throwing_allocator() = default;
+
+  template <typename U>
+  throwing_allocator(const throwing_allocator<U>&)
+  {}
+
+  T* allocate(std::size_t)
+  {
+    throw std::bad_alloc();
+  }
+
+  void deallocate(T*, std::size_t) {}
+
+  bool operator==(const throwing_allocator&) const
+  {
+    return true;
+  }
+
+  bool operator!=(const throwing_allocator&) const
+  {
+    return false;
+  }
+};
+
+void TestOmpCalibrateTuningProfileRestoresOnThrow()
+{
+  thrust::omp::tuning_profile storage = thrust::omp::get_tuning_profile();
+  storage.max_threads                 = 3;
+  storage.families[0].serial_cutoff   = 12345;
+
+  const thrust::omp::tuning_profile before = storage;
+
+  // the measurements which need temporary storage fail
+  throwing_allocator<char> alloc;
+  auto par = thrust::omp::par(alloc);
+
+  ASSERT_THROWS(thrust::system::detail::internal::calibrate_tuning_profile(
+                  par, storage, thrust::omp::default_tuning_profile(), 2),
+                std::bad_alloc);
+
+  ASSERT_EQUAL(equal_profiles(before, storage), true);
+}
+DECLARE_UNITTEST(TestOmpCalibrateTuningProfileRestoresOnThrow);
@@ -670,6 +670,358 @@ void TestRanlux48Unequal()
 }
 DECLARE_UNITTEST(TestRanlux48Unequal);
 
+void TestPhilox4x32Validation()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineValidation<Engine, 1955073260u>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Validation);
+
+void TestPhilox4x32Min()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Min);
+
+void TestPhilox4x32Max()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Max);
+
+void TestPhilox4x32SaveRestore()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32SaveRestore);
+
+void TestPhilox4x32Equal()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Equal);
+
+void TestPhilox4x32Unequal()
+{
+  using Engine = thrust::random::philox4x32;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x32Unequal);
+
+void TestPhilox4x64Validation()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineValidation<Engine, 3409172418970261260ull>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Validation);
+
+void TestPhilox4x64Min()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Min);
+
+void TestPhilox4x64Max()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Max);
+
+void TestPhilox4x64SaveRestore()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64SaveRestore);
+
+void TestPhilox4x64Equal()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Equal);
+
+void TestPhilox4x64Unequal()
+{
+  using Engine = thrust::random::philox4x64;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestPhilox4x64Unequal);
+
+void TestThreefry4x32Validation()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineValidation<Engine, 112810865u>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Validation);
+
+void TestThreefry4x32Min()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Min);
+
+void TestThreefry4x32Max()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Max);
+
+void TestThreefry4x32SaveRestore()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32SaveRestore);
+
+void TestThreefry4x32Equal()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Equal);
+
+void TestThreefry4x32Unequal()
+{
+  using Engine = thrust::random::threefry4x32;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x32Unequal);
+
+void TestThreefry4x64Validation()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineValidation<Engine, 9253438642465275567ull>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Validation);
+
+void TestThreefry4x64Min()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineMin<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Min);
+
+void TestThreefry4x64Max()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineMax<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Max);
+
+void TestThreefry4x64SaveRestore()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineSaveRestore<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64SaveRestore);
+
+void TestThreefry4x64Equal()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineEqual<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Equal);
+
+void TestThreefry4x64Unequal()
+{
+  using Engine = thrust::random::threefry4x64;
+
+  TestEngineUnequal<Engine>();
+}
+DECLARE_UNITTEST(TestThreefry4x64Unequal);
+
+template <typename Engine>
+struct ValidateCounterBasedEngineDiscard
+{
+  _CCCL_HOST_DEVICE bool operator()(void) const
+  {
+    bool result = true;
+
+    for (unsigned long long z = 0; z < 13; ++z)
+    {
+      for (int consumed = 0; consumed < 6; ++consumed)
+      {
+        Engine e0(13), e1(13);
+
+        for (int i = 0; i < consumed; ++i)
+        {
+          e0();
+          e1();
+        }
+
+        for (unsigned long long i = 0; i < z; ++i)
+        {
+          e0();
+        }
+
+        e1.discard(z);
+
+        result &= (e0 == e1);
+        result &= (e0() == e1());
+      }
+    }
+
+    // skipping 2^32 blocks carries into the second word of a 32 bit counter
+    using T = typename Engine::result_type;
+    T second = 1, first = 0;
+
+    if (Engine::word_size > 32)
+    {
+      second = 0;
+      first  = static_cast<T>(1ull << 32);
+    }
+
+    Engine e2, e3;
+    e2.discard(Engine::word_count << 32);
+    e3.set_counter({0, 0, second, first});
+    result &= (e2 == e3);
+    result &= (e2() == e3());
+
+    return result;
+  }
+};
+
+template <typename Engine>
+void TestCounterBasedEngineDiscard()
+{
+  // test host
+  thrust::host_vector<bool> h(1);
+  thrust::generate(h.begin(), h.end(), ValidateCounterBasedEngineDiscard<Engine>());
+
+  ASSERT_EQUAL(true, h[0]);
+
+  // test device
+  thrust::device_vector<bool> d(1);
+  thrust::generate(d.begin(), d.end(), ValidateCounterBasedEngineDiscard<Engine>());
+
+  ASSERT_EQUAL(true, d[0]);
+}
+
+void TestCounterBasedEnginesDiscard()
+{
+  TestCounterBasedEngineDiscard<thrust::random::philox4x32>();
+  TestCounterBasedEngineDiscard<thrust::random::philox4x64>();
+  TestCounterBasedEngineDiscard<thrust::random::threefry4x32>();
+  TestCounterBasedEngineDiscard<thrust::random::threefry4x64>();
+}
+DECLARE_UNITTEST(TestCounterBasedEnginesDiscard);
+
+void TestPhiloxKnownAnswers()
+{
+  // the results of Random123 for a zero key and counter
+  thrust::random::philox4x32 e0(0);
+  ASSERT_EQUAL(0x6627e8d5u, e0());
+  ASSERT_EQUAL(0xe169c58du, e0());
+  ASSERT_EQUAL(0xbc57ac4cu, e0());
+  ASSERT_EQUAL(0x9b00dbd8u, e0());
+
+  thrust::random::philox4x64 e1(0);
+  ASSERT_EQUAL(0x16554d9eca36314cull, e1());
+  ASSERT_EQUAL(0xdb20fe9d672d0fdcull, e1());
+  ASSERT_EQUAL(0xd7e772cee186176bull, e1());
+  ASSERT_EQUAL(0x7e68b68aec7ba23bull, e1());
+}
+DECLARE_UNITTEST(TestPhiloxKnownAnswers);
+
+void TestThreefryKnownAnswers()
+{
+  // the results of Random123 for a zero key and counter
+  thrust::random::threefry4x32 e0(0);
+  ASSERT_EQUAL(0x9c6ca96au, e0());
+  ASSERT_EQUAL(0xe17eae66u, e0());
+  ASSERT_EQUAL(0xfc10ecd4u, e0());
+  ASSERT_EQUAL(0x5256a7d8u, e0());
+
+  thrust::random::threefry4x64 e1(0);
+  ASSERT_EQUAL(0x09218ebde6c85537ull, e1());
+  ASSERT_EQUAL(0x55941f5266d86105ull, e1());
+  ASSERT_EQUAL(0x4bd25e16282434dcull, e1());
+  ASSERT_EQUAL(0xee29ec846bd2e40bull, e1());
+
+  thrust::random::threefry_engine<std::uint32_t, 32, 2, 20> e2(0);
+  ASSERT_EQUAL(0x6b200159u, e2());
+  ASSERT_EQUAL(0x99ba4efeu, e2());
+}
+DECLARE_UNITTEST(TestThreefryKnownAnswers);
+
+template <typename Vector, typename Engine>
+void TestGenerateRandomWithEngine()
+{
+  using T = typename Vector::value_type;
+
+  const size_t sizes[] = {0, 1, 3, 4, 5, 17, 1000};
+
+  for (size_t n : sizes)
+  {
+    for (int consumed = 0; consumed < 4; ++consumed)
+    {
+      Engine e0(7), e1(7);
+
+      for (int i = 0; i < consumed; ++i)
+      {
+        e0();
+        e1();
+      }
+
+      Vector v(n);
+      thrust::random::generate_random(v.begin(), v.end(), e0);
+
+      thrust::host_vector<T> ref(n);
+      for (size_t i = 0; i < n; ++i)
+      {
+        ref[i] = static_cast<T>(e1());
+      }
+
+      ASSERT_EQUAL(ref, v);
+      ASSERT_EQUAL(true, e0 == e1);
+    }
+  }
+}
+
+template <typename Vector>
+void TestGenerateRandom()
+{
+  TestGenerateRandomWithEngine<Vector, thrust::random::philox4x32>();
+  TestGenerateRandomWithEngine<Vector, thrust::random::threefry4x32>();
+  TestGenerateRandomWithEngine<Vector, thrust::random::threefry_engine<std::uint32_t, 32, 2, 13>>();
+
+  // engines that aren't counter-based are invoked sequentially
+  TestGenerateRandomWithEngine<Vector, thrust::random::minstd_rand>();
+}
+DECLARE_VECTOR_UNITTEST(TestGenerateRandom);
+
 THRUST_DISABLE_MSVC_WARNING_BEGIN(4305) // truncation warning
 template <typename Distribution, typename Validator>
 void ValidateDistributionCharacteristic()
@@ -758,6 +1110,7 @@ void TestUniformIntDistributionMin()
 
   ValidateDistributionCharacteristic<int_dist, ValidateDistributionMin<int_dist, thrust::minstd_rand>>();
   ValidateDistributionCharacteristic<uint_dist, ValidateDistributionMin<uint_dist, thrust::minstd_rand>>();
+  ValidateDistributionCharacteristic<int_dist, ValidateDistributionMin<int_dist, thrust::philox4x32>>();
 }
 DECLARE_UNITTEST(TestUniformIntDistributionMin);
 
@@ -768,6 +1121,7 @@ void TestUniformIntDistributionMax()
 
   ValidateDistributionCharacteristic<int_dist, ValidateDistributionMax<int_dist, thrust::minstd_rand>>();
   ValidateDistributionCharacteristic<uint_dist, ValidateDistributionMax<uint_dist, thrust::minstd_rand>>();
+  ValidateDistributionCharacteristic<int_dist, ValidateDistributionMax<int_dist, thrust::philox4x32>>();
 }
 DECLARE_UNITTEST(TestUniformIntDistributionMax);
 
@@ -788,6 +1142,7 @@ void TestUniformRealDistributionMin()
 
   ValidateDistributionCharacteristic<float_dist, ValidateDistributionMin<float_dist, thrust::minstd_rand>>();
   ValidateDistributionCharacteristic<double_dist, ValidateDistributionMin<double_dist, thrust::minstd_rand>>();
+  ValidateDistributionCharacteristic<float_dist, ValidateDistributionMin<float_dist, thrust::threefry4x64>>();
 }
 DECLARE_UNITTEST(TestUniformRealDistributionMin);
 
@@ -798,6 +1153,7 @@ void TestUniformRealDistributionMax()
 
   ValidateDistributionCharacteristic<float_dist, ValidateDistributionMax<float_dist, thrust::minstd_rand>>();
   ValidateDistributionCharacteristic<double_dist, ValidateDistributionMax<double_dist, thrust::minstd_rand>>();
+  ValidateDistributionCharacteristic<float_dist, ValidateDistributionMax<float_dist, thrust::threefry4x64>>();
 }
 DECLARE_UNITTEST(TestUniformRealDistributionMax);
 
@@ -818,6 +1174,7 @@ void TestNormalDistributionMin()
 
   ValidateDistributionCharacteristic<float_dist, ValidateDistributionMin<float_dist, thrust::minstd_rand>>();
   ValidateDistributionCharacteristic<double_dist, ValidateDistributionMin<double_dist, thrust::minstd_rand>>();
+  ValidateDistributionCharacteristic<double_dist, ValidateDistributionMin<double_dist, thrust::philox4x64>>();
 }
 DECLARE_UNITTEST(TestNormalDistributionMin);
 
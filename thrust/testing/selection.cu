@@ -0,0 +1,383 @@
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/retag.h>
+#include <thrust/selection.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <unittest/unittest.h>
+
+template <typename RandomAccessIterator>
+void nth_element(my_system& system, RandomAccessIterator, RandomAccessIterator, RandomAccessIterator)
+{
+  system.validate_dispatch();
+}
+
+void TestNthElementDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::nth_element(sys, vec.begin(), vec.begin(), vec.end());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestNthElementDispatchExplicit);
+
+template <typename RandomAccessIterator>
+void nth_element(my_tag, RandomAccessIterator first, RandomAccessIterator, RandomAccessIterator)
+{
+  *first = 13;
+}
+
+void TestNthElementDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::nth_element(
+    thrust::retag<my_tag>(vec.begin()), thrust::retag<my_tag>(vec.begin()), thrust::retag<my_tag>(vec.end()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestNthElementDispatchImplicit);
+
+template <typename RandomAccessIterator, typename Size, typename OutputIterator>
+OutputIterator top_k(my_system& system, RandomAccessIterator, RandomAccessIterator, Size, OutputIterator result)
+{
+  system.validate_dispatch();
+  return result;
+}
+
+void TestTopKDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::top_k(sys, vec.begin(), vec.end(), 1, vec.begin());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestTopKDispatchExplicit);
+
+// checks that data is partitioned around data[nth] as it would be sorted, by
+// comparing with the sorted copy
+template <typename Vector, typename Compare>
+void CheckNthElement(
+  const Vector& data, const thrust::host_vector<typename Vector::value_type>& sorted, size_t nth, Compare comp)
+{
+  using T = typename Vector::value_type;
+
+  const thrust::host_vector<T> h_data = data;
+
+  ASSERT_EQUAL(h_data.size(), sorted.size());
+  ASSERT_EQUAL(h_data[nth], sorted[nth]);
+
+  bool ordered = true;
+
+  for (size_t i = 0; i < nth; ++i)
+  {
+    ordered = ordered && !comp(h_data[nth], h_data[i]);
+  }
+
+  for (size_t i = nth + 1; i < h_data.size(); ++i)
+  {
+    ordered = ordered && !comp(h_data[i], h_data[nth]);
+  }
+
+  ASSERT_EQUAL(ordered, true);
+
+  // and the same elements are still there
+  thrust::host_vector<T> resorted = h_data;
+  thrust::sort(resorted.begin(), resorted.end(), comp);
+  ASSERT_EQUAL(resorted, sorted);
+}
+
+template <class Vector>
+void TestNthElementSimple()
+{
+  using T = typename Vector::value_type;
+
+  Vector data{5, 1, 4, 2, 7, 3, 6};
+
+  thrust::nth_element(data.begin(), data.begin() + 3, data.end());
+
+  CheckNthElement(data, thrust::host_vector<T>{1, 2, 3, 4, 5, 6, 7}, 3, thrust::less<T>());
+
+  // nth at last leaves the range alone
+  Vector unchanged{3, 1, 2};
+  thrust::nth_element(unchanged.begin(), unchanged.end(), unchanged.end());
+  ASSERT_EQUAL(unchanged, (Vector{3, 1, 2}));
+}
+DECLARE_VECTOR_UNITTEST(TestNthElementSimple);
+
+template <typename T>
+void TestNthElement(const size_t n)
+{
+  if (n == 0)
+  {
+    return;
+  }
+
+  const thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+
+  thrust::host_vector<T> sorted = h_data;
+  thrust::sort(sorted.begin(), sorted.end());
+
+  for (size_t nth : {size_t(0), n / 3, n - 1})
+  {
+    thrust::host_vector<T> h_result = h_data;
+    thrust::nth_element(h_result.begin(), h_result.begin() + nth, h_result.end());
+    CheckNthElement(h_result, sorted, nth, thrust::less<T>());
+
+    thrust::device_vector<T> d_result = h_data;
+    thrust::nth_element(d_result.begin(), d_result.begin() + nth, d_result.end());
+    CheckNthElement(d_result, sorted, nth, thrust::less<T>());
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestNthElement);
+
+template <typename T>
+void TestNthElementDescending(const size_t n)
+{
+  if (n == 0)
+  {
+    return;
+  }
+
+  const thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+
+  thrust::host_vector<T> sorted = h_data;
+  thrust::sort(sorted.begin(), sorted.end(), thrust::greater<T>());
+
+  thrust::device_vector<T> d_result = h_data;
+  thrust::nth_element(d_result.begin(), d_result.begin() + n / 2, d_result.end(), thrust::greater<T>());
+  CheckNthElement(d_result, sorted, n / 2, thrust::greater<T>());
+}
+DECLARE_VARIABLE_UNITTEST(TestNthElementDescending);
+
+// large enough for the parallel systems to narrow the range down, with every
+// element one of a few values, or all of them the same
+void TestNthElementDuplicates()
+{
+  const size_t n = 100000;
+
+  for (int num_values : {1, 2, 3, 100})
+  {
+    thrust::host_vector<int> h_data = unittest::random_integers<int>(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+      h_data[i] = static_cast<int>(static_cast<unsigned int>(h_data[i]) % num_values);
+    }
+
+    thrust::host_vector<int> sorted = h_data;
+    thrust::sort(sorted.begin(), sorted.end());
+
+    for (size_t nth : {size_t(0), n / 2, n - 1})
+    {
+      thrust::device_vector<int> d_result = h_data;
+      thrust::nth_element(d_result.begin(), d_result.begin() + nth, d_result.end());
+      CheckNthElement(d_result, sorted, nth, thrust::less<int>());
+    }
+  }
+}
+DECLARE_UNITTEST(TestNthElementDuplicates);
+
+// inputs which make a poor choice of pivot or splitter costly
+void TestNthElementPatterns()
+{
+  const size_t n = 100000;
+
+  thrust::host_vector<int> ascending(n);
+  thrust::sequence(ascending.begin(), ascending.end());
+
+  thrust::host_vector<int> descending(n);
+  thrust::sequence(descending.rbegin(), descending.rend());
+
+  thrust::host_vector<int> organ_pipe(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    organ_pipe[i] = static_cast<int>(i < n / 2 ? i : n - i);
+  }
+
+  for (const thrust::host_vector<int>& h_data : {ascending, descending, organ_pipe})
+  {
+    thrust::host_vector<int> sorted = h_data;
+    thrust::sort(sorted.begin(), sorted.end());
+
+    thrust::host_vector<int> h_result = h_data;
+    thrust::nth_element(thrust::seq, h_result.begin(), h_result.begin() + n / 3, h_result.end());
+    CheckNthElement(h_result, sorted, n / 3, thrust::less<int>());
+
+    thrust::device_vector<int> d_result = h_data;
+    thrust::nth_element(d_result.begin(), d_result.begin() + n / 3, d_result.end());
+    CheckNthElement(d_result, sorted, n / 3, thrust::less<int>());
+  }
+}
+DECLARE_UNITTEST(TestNthElementPatterns);
+
+template <typename T>
+void TestPartialSort(const size_t n)
+{
+  const thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+
+  thrust::host_vector<T> sorted = h_data;
+  thrust::sort(sorted.begin(), sorted.end());
+
+  for (size_t k : {size_t(0), n / 4, n})
+  {
+    thrust::device_vector<T> d_result = h_data;
+    thrust::partial_sort(d_result.begin(), d_result.begin() + k, d_result.end());
+
+    thrust::host_vector<T> h_result = d_result;
+    ASSERT_EQUAL(thrust::host_vector<T>(h_result.begin(), h_result.begin() + k),
+                 thrust::host_vector<T>(sorted.begin(), sorted.begin() + k));
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestPartialSort);
+
+template <class Vector>
+void TestPartialSortCopySimple()
+{
+  using T = typename Vector::value_type;
+
+  const Vector data{1, 4, 2, 8, 5, 7};
+
+  Vector shorter(3);
+  ASSERT_EQUAL(
+    thrust::partial_sort_copy(data.begin(), data.end(), shorter.begin(), shorter.end()) - shorter.begin(), 3);
+  ASSERT_EQUAL(shorter, (Vector{1, 2, 4}));
+
+  Vector longer(8, T(0));
+  ASSERT_EQUAL(thrust::partial_sort_copy(data.begin(), data.end(), longer.begin(), longer.end(), thrust::greater<T>())
+                 - longer.begin(),
+               6);
+  ASSERT_EQUAL(longer, (Vector{8, 7, 5, 4, 2, 1, 0, 0}));
+
+  // the input is left alone
+  ASSERT_EQUAL(data, (Vector{1, 4, 2, 8, 5, 7}));
+}
+DECLARE_VECTOR_UNITTEST(TestPartialSortCopySimple);
+
+template <typename T>
+void TestTopK(const size_t n)
+{
+  const thrust::host_vector<T> h_data   = unittest::random_integers<T>(n);
+  const thrust::device_vector<T> d_data = h_data;
+
+  thrust::host_vector<T> sorted = h_data;
+  thrust::sort(sorted.begin(), sorted.end(), thrust::greater<T>());
+
+  const size_t k = n < 10 ? n : 10;
+
+  thrust::device_vector<T> d_result(k);
+  ASSERT_EQUAL(thrust::top_k(d_data.begin(), d_data.end(), k, d_result.begin()) - d_result.begin(),
+               static_cast<std::ptrdiff_t>(k));
+  ASSERT_EQUAL(d_result, thrust::device_vector<T>(sorted.begin(), sorted.begin() + k));
+
+  // the smallest instead, and more than there are
+  thrust::device_vector<T> d_all(n + 1);
+  ASSERT_EQUAL(thrust::top_k(d_data.begin(), d_data.end(), n + 1, d_all.begin(), thrust::less<T>()) - d_all.begin(),
+               static_cast<std::ptrdiff_t>(n));
+
+  thrust::host_vector<T> ascending = h_data;
+  thrust::sort(ascending.begin(), ascending.end());
+  ASSERT_EQUAL(thrust::device_vector<T>(d_all.begin(), d_all.begin() + n), ascending);
+}
+DECLARE_VARIABLE_UNITTEST(TestTopK);
+
+void TestTopKDuplicates()
+{
+  const size_t n = 100000;
+
+  // from distinct values to a single one, so that the candidates which are
+  // not above the splitter are at times all of the range
+  for (int num_values : {1 << 30, 1000, 3, 1})
+  {
+    thrust::host_vector<int> h_data = unittest::random_integers<int>(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+      h_data[i] = static_cast<int>(static_cast<unsigned int>(h_data[i]) % num_values);
+    }
+    const thrust::device_vector<int> d_data = h_data;
+
+    thrust::host_vector<int> sorted = h_data;
+    thrust::sort(sorted.begin(), sorted.end(), thrust::greater<int>());
+
+    for (size_t k : {size_t(1), size_t(100), n / 5})
+    {
+      thrust::device_vector<int> d_result(k);
+      ASSERT_EQUAL(thrust::top_k(d_data.begin(), d_data.end(), k, d_result.begin()) - d_result.begin(),
+                   static_cast<std::ptrdiff_t>(k));
+      ASSERT_EQUAL(d_result, thrust::device_vector<int>(sorted.begin(), sorted.begin() + k));
+    }
+  }
+}
+DECLARE_UNITTEST(TestTopKDuplicates);
+
+void TestTopKByKeySimple()
+{
+  const thrust::device_vector<int> scores{70, 95, 80, 95, 60};
+  const thrust::device_vector<char> names{'a', 'b', 'c', 'd', 'e'};
+
+  thrust::device_vector<int> best_scores(3);
+  thrust::device_vector<char> best_names(3);
+
+  auto ends = thrust::top_k_by_key(
+    scores.begin(), scores.end(), names.begin(), 3, best_scores.begin(), best_names.begin());
+
+  ASSERT_EQUAL(ends.first - best_scores.begin(), 3);
+  ASSERT_EQUAL(ends.second - best_names.begin(), 3);
+  ASSERT_EQUAL(best_scores, (thrust::device_vector<int>{95, 95, 80}));
+  ASSERT_EQUAL(best_names, (thrust::device_vector<char>{'b', 'd', 'c'}));
+
+  // nothing to select
+  ends = thrust::top_k_by_key(scores.begin(), scores.end(), names.begin(), 0, best_scores.begin(), best_names.begin());
+  ASSERT_EQUAL(ends.first - best_scores.begin(), 0);
+  ASSERT_EQUAL(ends.second - best_names.begin(), 0);
+}
+DECLARE_UNITTEST(TestTopKByKeySimple);
+
+// equivalent keys are preferred in the order they come in, as a stable sort
+// by key would put them, also when most keys are equivalent to the kth
+void TestTopKByKeyMatchesStableSort()
+{
+  const size_t n = 100000;
+
+  for (int num_keys : {5000, 3, 1})
+  {
+    thrust::host_vector<int> h_keys = unittest::random_integers<int>(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+      h_keys[i] = static_cast<int>(static_cast<unsigned int>(h_keys[i]) % num_keys);
+    }
+
+    thrust::host_vector<int> h_values(n);
+    thrust::sequence(h_values.begin(), h_values.end());
+
+    thrust::host_vector<int> sorted_keys   = h_keys;
+    thrust::host_vector<int> sorted_values = h_values;
+    thrust::stable_sort_by_key(sorted_keys.begin(), sorted_keys.end(), sorted_values.begin(), thrust::less<int>());
+
+    const thrust::device_vector<int> d_keys   = h_keys;
+    const thrust::device_vector<int> d_values = h_values;
+
+    for (size_t k : {size_t(1), size_t(1000), n / 2})
+    {
+      thrust::device_vector<int> d_best_keys(k);
+      thrust::device_vector<int> d_best_values(k);
+
+      thrust::top_k_by_key(
+        d_keys.begin(),
+        d_keys.end(),
+        d_values.begin(),
+        k,
+        d_best_keys.begin(),
+        d_best_values.begin(),
+        thrust::less<int>());
+
+      ASSERT_EQUAL(d_best_keys, thrust::host_vector<int>(sorted_keys.begin(), sorted_keys.begin() + k));
+      ASSERT_EQUAL(d_best_values, thrust::host_vector<int>(sorted_values.begin(), sorted_values.begin() + k));
+    }
+  }
+}
+DECLARE_UNITTEST(TestTopKByKeyMatchesStableSort);
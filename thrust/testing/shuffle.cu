@@ -407,6 +407,20 @@ void TestShuffleSimple()
 }
 DECLARE_VECTOR_UNITTEST(TestShuffleSimple);
 
+template <typename Vector>
+void TestShuffleCounterBasedEngine()
+{
+  Vector data(100);
+  thrust::sequence(data.begin(), data.end());
+  Vector shuffled(data.begin(), data.end());
+  thrust::philox4x32 g(2);
+  thrust::shuffle(shuffled.begin(), shuffled.end(), g);
+  ASSERT_EQUAL(false, shuffled == data);
+  thrust::sort(shuffled.begin(), shuffled.end());
+  ASSERT_EQUAL(shuffled, data);
+}
+DECLARE_VECTOR_UNITTEST(TestShuffleCounterBasedEngine);
+
 template <typename Vector>
 void TestShuffleCopySimple()
 {
@@ -443,6 +457,32 @@ void TestHostDeviceIdentical(size_t m)
 }
 DECLARE_VARIABLE_UNITTEST(TestHostDeviceIdentical);
 
+// large enough to be split into several tiles by the parallel host systems
+void TestShuffleCopyLarge()
+{
+  const size_t n = (size_t(1) << 18) + 5;
+
+  thrust::device_vector<unsigned int> input(n);
+  thrust::sequence(input.begin(), input.end());
+
+  thrust::device_vector<unsigned int> result(n);
+  thrust::default_random_engine g(29);
+  thrust::shuffle_copy(input.begin(), input.end(), result.begin(), g);
+
+  ASSERT_EQUAL(false, result == input);
+
+  thrust::host_vector<unsigned int> h_input = input;
+  thrust::host_vector<unsigned int> h_result(n);
+  thrust::default_random_engine h_g(29);
+  thrust::shuffle_copy(h_input.begin(), h_input.end(), h_result.begin(), h_g);
+
+  ASSERT_EQUAL(h_result, result);
+
+  thrust::sort(result.begin(), result.end());
+  ASSERT_EQUAL(input, result);
+}
+DECLARE_UNITTEST(TestShuffleCopyLarge);
+
 template <typename T>
 void TestFunctionIsBijection(size_t m)
 {
@@ -86,6 +86,27 @@ void TestSortAscendingKey(const size_t n)
 }
 DECLARE_VARIABLE_UNITTEST(TestSortAscendingKey);
 
+void TestSortNegativeKeys()
+{
+  const size_t n = 10027;
+
+  thrust::host_vector<int> h_data = unittest::random_integers<int>(n);
+
+  for (size_t i = 0; i < n; i += 2)
+  {
+    h_data[i] = -h_data[i];
+  }
+
+  thrust::device_vector<int> d_data = h_data;
+
+  thrust::sort(h_data.begin(), h_data.end());
+  thrust::sort(d_data.begin(), d_data.end());
+
+  ASSERT_EQUAL(true, thrust::is_sorted(h_data.begin(), h_data.end()));
+  ASSERT_EQUAL(h_data, d_data);
+}
+DECLARE_UNITTEST(TestSortNegativeKeys);
+
 void TestSortDescendingKey()
 {
   const size_t n = 10027;
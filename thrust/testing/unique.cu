@@ -324,3 +324,32 @@ struct TestUniqueCount
   }
 };
 VariableUnitTest<TestUniqueCount, IntegralTypes> TestUniqueCountInstance;
+
+// runs that span many tiles of the parallel backends
+template <typename Vector>
+void TestUniqueLongRuns()
+{
+  using T = typename Vector::value_type;
+
+  const size_t n = 100000;
+
+  thrust::host_vector<T> h_data(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    h_data[i] = static_cast<T>(i / 3000);
+  }
+  Vector d_data = h_data;
+
+  Vector d_result(n);
+  ASSERT_EQUAL(thrust::unique_copy(d_data.begin(), d_data.end(), d_result.begin()) - d_result.begin(), 34);
+  ASSERT_EQUAL(thrust::unique_count(d_data.begin(), d_data.end(), is_equal_div_10_unique<T>()), 4);
+
+  typename Vector::iterator new_last = thrust::unique(d_data.begin(), d_data.end(), is_equal_div_10_unique<T>());
+  ASSERT_EQUAL(new_last - d_data.begin(), 4);
+  ASSERT_EQUAL(d_data[0], T(0));
+  ASSERT_EQUAL(d_data[1], T(10));
+  ASSERT_EQUAL(d_data[2], T(20));
+  ASSERT_EQUAL(d_data[3], T(30));
+  ASSERT_EQUAL(d_result[33], T(33));
+}
+DECLARE_INTEGRAL_VECTOR_UNITTEST(TestUniqueLongRuns);
@@ -373,6 +373,68 @@ void TestVectorWithInitialValue()
 }
 DECLARE_VECTOR_UNITTEST(TestVectorWithInitialValue);
 
+template <class Vector>
+void TestVectorNoInit()
+{
+  using T = typename Vector::value_type;
+
+  Vector v(3, thrust::no_init);
+  ASSERT_EQUAL(v.size(), 3lu);
+
+  thrust::sequence(v.begin(), v.end());
+
+  // grows in place and by reallocating
+  v.reserve(4);
+  v.resize(4, thrust::no_init);
+  v.resize(1000, thrust::no_init);
+  ASSERT_EQUAL(v.size(), 1000lu);
+  ASSERT_EQUAL(v[0], T(0));
+  ASSERT_EQUAL(v[1], T(1));
+  ASSERT_EQUAL(v[2], T(2));
+
+  v[999] = T(13);
+  ASSERT_EQUAL(v[999], T(13));
+
+  v.resize(2, thrust::no_init);
+  ASSERT_EQUAL(v.size(), 2lu);
+  ASSERT_EQUAL(v[0], T(0));
+  ASSERT_EQUAL(v[1], T(1));
+
+  Vector w(0, thrust::no_init, v.get_allocator());
+  ASSERT_EQUAL(w.size(), 0lu);
+}
+DECLARE_VECTOR_UNITTEST(TestVectorNoInit);
+
+struct vector_no_init_item
+{
+  int value = 13;
+};
+
+template <class Vector>
+void TestVectorNoInitNonTrivial()
+{
+  // elements with an effectful default constructor are still constructed
+  Vector v(10, thrust::no_init);
+  v.resize(100, thrust::no_init);
+
+  for (size_t i = 0; i < v.size(); ++i)
+  {
+    ASSERT_EQUAL(static_cast<vector_no_init_item>(v[i]).value, 13);
+  }
+}
+
+void TestVectorNoInitNonTrivialHost()
+{
+  TestVectorNoInitNonTrivial<thrust::host_vector<vector_no_init_item>>();
+}
+DECLARE_UNITTEST(TestVectorNoInitNonTrivialHost);
+
+void TestVectorNoInitNonTrivialDevice()
+{
+  TestVectorNoInitNonTrivial<thrust::device_vector<vector_no_init_item>>();
+}
+DECLARE_UNITTEST(TestVectorNoInitNonTrivialDevice);
+
 template <class Vector>
 void TestVectorSwap()
 {
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/system/detail/adl/adjacent_difference.h>
 #include <thrust/system/detail/generic/adjacent_difference.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -39,6 +40,7 @@ _CCCL_HOST_DEVICE OutputIterator adjacent_difference(
   InputIterator last,
   OutputIterator result)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::adjacent_difference", exec, first, last);
   using thrust::system::detail::generic::adjacent_difference;
 
   return adjacent_difference(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
@@ -53,6 +55,7 @@ _CCCL_HOST_DEVICE OutputIterator adjacent_difference(
   OutputIterator result,
   BinaryFunction binary_op)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::adjacent_difference", exec, first, last);
   using thrust::system::detail::generic::adjacent_difference;
 
   return adjacent_difference(
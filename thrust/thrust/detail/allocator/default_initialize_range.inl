@@ -0,0 +1,131 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/allocator/allocator_traits.h>
+#include <thrust/detail/allocator/value_initialize_range.h>
+#include <thrust/detail/pointer.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/detail/type_traits/pointer_traits.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/system/cpp/detail/execution_policy.h>
+
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+namespace allocator_traits_detail
+{
+
+// the granularity at which the operating system places memory
+const ::cuda::std::size_t first_touch_page_size = 4096;
+
+// writes a byte to every page of [first, first + bytes), which makes the
+// operating system back the page by memory of the node of the writing thread
+struct first_touch_page
+{
+  char* first;
+  ::cuda::std::size_t bytes;
+
+  _CCCL_HOST_DEVICE void operator()(::cuda::std::size_t page) const
+  {
+    const ::cuda::std::size_t misalignment = reinterpret_cast<::cuda::std::uintptr_t>(first) % first_touch_page_size;
+    const ::cuda::std::size_t offset       = page == 0 ? 0 : page * first_touch_page_size - misalignment;
+
+    if (offset < bytes)
+    {
+      first[offset] = 0;
+    }
+  }
+};
+
+// Other systems either place memory on first use anyway or don't use pages
+// of the host at all.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename System, typename Pointer, typename Size>
+_CCCL_HOST_DEVICE void first_touch(const thrust::execution_policy<System>&, Pointer, Size)
+{}
+
+// The parallel host systems derive from the cpp system. Touching the pages
+// with the same decomposition as for_each puts them on the nodes of the
+// threads that will process them.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename System, typename Pointer, typename Size>
+_CCCL_HOST_DEVICE void
+first_touch(const thrust::system::cpp::detail::execution_policy<System>& system, Pointer p, Size n)
+{
+  using T = typename pointer_element<Pointer>::type;
+
+  char* first                     = reinterpret_cast<char*>(thrust::raw_pointer_cast(p));
+  const ::cuda::std::size_t bytes = static_cast<::cuda::std::size_t>(n) * sizeof(T);
+  const ::cuda::std::size_t pages =
+    (reinterpret_cast<::cuda::std::uintptr_t>(first) % first_touch_page_size + bytes + first_touch_page_size - 1)
+    / first_touch_page_size;
+
+  thrust::for_each_n(system, thrust::counting_iterator<::cuda::std::size_t>(0), pages, first_touch_page{first, bytes});
+}
+
+// The sequential cpp system would gain nothing from touching the pages early.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename Pointer, typename Size>
+_CCCL_HOST_DEVICE void
+first_touch(const thrust::system::cpp::detail::execution_policy<thrust::system::cpp::detail::tag>&, Pointer, Size)
+{}
+
+template <typename Allocator, typename Pointer, typename Size>
+_CCCL_HOST_DEVICE ::cuda::std::__enable_if_t<
+  needs_default_construct_via_allocator<Allocator, typename pointer_element<Pointer>::type>::value>
+default_initialize_range(Allocator& a, Pointer p, Size n)
+{
+  // default-initializing elements with effectful constructors is just as
+  // expensive as value-initializing them
+  thrust::detail::value_initialize_range(a, p, n);
+}
+
+template <typename Allocator, typename Pointer, typename Size>
+_CCCL_HOST_DEVICE
+typename disable_if<needs_default_construct_via_allocator<Allocator, typename pointer_element<Pointer>::type>::value>::type
+default_initialize_range(Allocator& a, Pointer p, Size n)
+{
+  if (n > 0)
+  {
+    allocator_traits_detail::first_touch(allocator_system<Allocator>::get(a), p, n);
+  }
+}
+
+} // namespace allocator_traits_detail
+
+template <typename Allocator, typename Pointer, typename Size>
+_CCCL_HOST_DEVICE void default_initialize_range(Allocator& a, Pointer p, Size n)
+{
+  return allocator_traits_detail::default_initialize_range(a, p, n);
+}
+
+} // namespace detail
+THRUST_NAMESPACE_END
@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/binary_search.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/binary_search.h>
 #include <thrust/system/detail/generic/binary_search.h>
@@ -143,6 +144,7 @@ _CCCL_HOST_DEVICE OutputIterator lower_bound(
   InputIterator values_last,
   OutputIterator output)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::lower_bound", exec, values_first, values_last);
   using thrust::system::detail::generic::lower_bound;
   return lower_bound(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output);
@@ -163,6 +165,7 @@ _CCCL_HOST_DEVICE OutputIterator lower_bound(
   OutputIterator output,
   StrictWeakOrdering comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::lower_bound", exec, values_first, values_last);
   using thrust::system::detail::generic::lower_bound;
   return lower_bound(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -184,6 +187,7 @@ _CCCL_HOST_DEVICE OutputIterator upper_bound(
   InputIterator values_last,
   OutputIterator output)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::upper_bound", exec, values_first, values_last);
   using thrust::system::detail::generic::upper_bound;
   return upper_bound(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output);
@@ -204,6 +208,7 @@ _CCCL_HOST_DEVICE OutputIterator upper_bound(
   OutputIterator output,
   StrictWeakOrdering comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::upper_bound", exec, values_first, values_last);
   using thrust::system::detail::generic::upper_bound;
   return upper_bound(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -225,6 +230,7 @@ _CCCL_HOST_DEVICE OutputIterator binary_search(
   InputIterator values_last,
   OutputIterator output)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::binary_search", exec, values_first, values_last);
   using thrust::system::detail::generic::binary_search;
   return binary_search(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output);
@@ -245,6 +251,7 @@ _CCCL_HOST_DEVICE OutputIterator binary_search(
   OutputIterator output,
   StrictWeakOrdering comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::binary_search", exec, values_first, values_last);
   using thrust::system::detail::generic::binary_search;
   return binary_search(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
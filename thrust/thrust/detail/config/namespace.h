@@ -175,6 +175,20 @@
 #endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 // clang-format on
 
+// Instrumented algorithms have different bodies, so translation units built
+// with THRUST_ENABLE_INSTRUMENTATION get their own copy of thrust:: instead of
+// sharing, and violating the ODR for, the inline functions of the others.
+#if defined(THRUST_ENABLE_INSTRUMENTATION)
+#  define THRUST_DETAIL_INSTRUMENTED_NAMESPACE
+#  define THRUST_DETAIL_INSTRUMENTATION_NS_BEGIN \
+    inline namespace instrumented              \
+    {
+#  define THRUST_DETAIL_INSTRUMENTATION_NS_END }
+#else // !defined(THRUST_ENABLE_INSTRUMENTATION)
+#  define THRUST_DETAIL_INSTRUMENTATION_NS_BEGIN
+#  define THRUST_DETAIL_INSTRUMENTATION_NS_END
+#endif // !defined(THRUST_ENABLE_INSTRUMENTATION)
+
 /**
  * \def THRUST_NAMESPACE_BEGIN
  * This macro is used to open a `thrust::` namespace block, along with any
@@ -185,7 +199,8 @@
   THRUST_NS_PREFIX             \
   namespace thrust             \
   {                            \
-  THRUST_DETAIL_ABI_NS_BEGIN
+  THRUST_DETAIL_ABI_NS_BEGIN   \
+  THRUST_DETAIL_INSTRUMENTATION_NS_BEGIN
 
 /**
  * \def THRUST_NAMESPACE_END
@@ -193,9 +208,10 @@
  * enclosing namespaces requested by THRUST_WRAPPED_NAMESPACE, etc.
  * This macro is defined by Thrust and may not be overridden.
  */
-#define THRUST_NAMESPACE_END   \
-  THRUST_DETAIL_ABI_NS_END     \
-  } /* end namespace thrust */ \
+#define THRUST_NAMESPACE_END             \
+  THRUST_DETAIL_INSTRUMENTATION_NS_END   \
+  THRUST_DETAIL_ABI_NS_END               \
+  } /* end namespace thrust */           \
   THRUST_NS_POSTFIX
 
 // The following is just here to add docs for the thrust namespace:
@@ -27,6 +27,7 @@
 #endif // no system header
 #include <thrust/detail/allocator/allocator_traits.h>
 #include <thrust/detail/allocator/copy_construct_range.h>
+#include <thrust/detail/allocator/default_initialize_range.h>
 #include <thrust/detail/allocator/destroy_range.h>
 #include <thrust/detail/allocator/fill_construct_range.h>
 #include <thrust/detail/allocator/value_initialize_range.h>
@@ -208,6 +209,12 @@ _CCCL_HOST_DEVICE void contiguous_storage<T, Alloc>::value_initialize_n(iterator
   value_initialize_range(m_allocator, first.base(), n);
 } // end contiguous_storage::value_initialize_n()
 
+template <typename T, typename Alloc>
+_CCCL_HOST_DEVICE void contiguous_storage<T, Alloc>::default_initialize_n(iterator first, size_type n)
+{
+  default_initialize_range(m_allocator, first.base(), n);
+} // end contiguous_storage::default_initialize_n()
+
 template <typename T, typename Alloc>
 _CCCL_HOST_DEVICE void
 contiguous_storage<T, Alloc>::uninitialized_fill_n(iterator first, size_type n, const value_type& x)
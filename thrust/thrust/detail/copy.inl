@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/copy.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/system/detail/adl/copy.h>
 #include <thrust/system/detail/generic/copy.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -40,6 +41,7 @@ copy(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
      InputIterator last,
      OutputIterator result)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::copy", exec, first, last);
   using thrust::system::detail::generic::copy;
   return copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end copy()
@@ -49,6 +51,7 @@ template <typename DerivedPolicy, typename InputIterator, typename Size, typenam
 _CCCL_HOST_DEVICE OutputIterator copy_n(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, Size n, OutputIterator result)
 {
+  THRUST_DETAIL_INSTRUMENT_N("thrust::copy_n", exec, n);
   using thrust::system::detail::generic::copy_n;
   return copy_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, result);
 } // end copy_n()
@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/count.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/count.h>
 #include <thrust/system/detail/generic/count.h>
@@ -41,6 +42,7 @@ count(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
       InputIterator last,
       const EqualityComparable& value)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::count", exec, first, last);
   using thrust::system::detail::generic::count;
   return count(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end count()
@@ -53,6 +55,7 @@ count_if(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
          InputIterator last,
          Predicate pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::count_if", exec, first, last);
   using thrust::system::detail::generic::count_if;
   return count_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end count_if()
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/extrema.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/extrema.h>
@@ -38,6 +39,7 @@ template <typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE ForwardIterator min_element(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::min_element", exec, first, last);
   using thrust::system::detail::generic::min_element;
   return min_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end min_element()
@@ -50,6 +52,7 @@ _CCCL_HOST_DEVICE ForwardIterator min_element(
   ForwardIterator last,
   BinaryPredicate comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::min_element", exec, first, last);
   using thrust::system::detail::generic::min_element;
   return min_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end min_element()
@@ -59,6 +62,7 @@ template <typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE ForwardIterator max_element(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::max_element", exec, first, last);
   using thrust::system::detail::generic::max_element;
   return max_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end max_element()
@@ -71,6 +75,7 @@ _CCCL_HOST_DEVICE ForwardIterator max_element(
   ForwardIterator last,
   BinaryPredicate comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::max_element", exec, first, last);
   using thrust::system::detail::generic::max_element;
   return max_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end max_element()
@@ -80,6 +85,7 @@ template <typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE thrust::pair<ForwardIterator, ForwardIterator> minmax_element(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::minmax_element", exec, first, last);
   using thrust::system::detail::generic::minmax_element;
   return minmax_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end minmax_element()
@@ -92,6 +98,7 @@ _CCCL_HOST_DEVICE thrust::pair<ForwardIterator, ForwardIterator> minmax_element(
   ForwardIterator last,
   BinaryPredicate comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::minmax_element", exec, first, last);
   using thrust::system::detail::generic::minmax_element;
   return minmax_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end minmax_element()
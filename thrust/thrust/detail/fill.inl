@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/instrumentation.h>
 #include <thrust/fill.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/fill.h>
@@ -42,6 +43,7 @@ fill(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
      ForwardIterator last,
      const T& value)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::fill", exec, first, last);
   using thrust::system::detail::generic::fill;
   return fill(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end fill()
@@ -51,6 +53,7 @@ template <typename DerivedPolicy, typename OutputIterator, typename Size, typena
 _CCCL_HOST_DEVICE OutputIterator
 fill_n(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, OutputIterator first, Size n, const T& value)
 {
+  THRUST_DETAIL_INSTRUMENT_N("thrust::fill_n", exec, n);
   using thrust::system::detail::generic::fill_n;
   return fill_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, value);
 } // end fill_n()
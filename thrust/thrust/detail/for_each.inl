@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/for_each.h>
@@ -41,6 +42,7 @@ _CCCL_HOST_DEVICE InputIterator for_each(
   InputIterator last,
   UnaryFunction f)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::for_each", exec, first, last);
   using thrust::system::detail::generic::for_each;
 
   return for_each(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, f);
@@ -61,6 +63,7 @@ template <typename DerivedPolicy, typename InputIterator, typename Size, typenam
 _CCCL_HOST_DEVICE InputIterator for_each_n(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, Size n, UnaryFunction f)
 {
+  THRUST_DETAIL_INSTRUMENT_N("thrust::for_each_n", exec, n);
   using thrust::system::detail::generic::for_each_n;
 
   return for_each_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, f);
@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/instrumentation.h>
 #include <thrust/gather.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/gather.h>
@@ -43,6 +44,7 @@ _CCCL_HOST_DEVICE OutputIterator gather(
   RandomAccessIterator input_first,
   OutputIterator result)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::gather", exec, map_first, map_last);
   using thrust::system::detail::generic::gather;
   return gather(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), map_first, map_last, input_first, result);
@@ -62,6 +64,7 @@ _CCCL_HOST_DEVICE OutputIterator gather_if(
   RandomAccessIterator input_first,
   OutputIterator result)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::gather_if", exec, map_first, map_last);
   using thrust::system::detail::generic::gather_if;
   return gather_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), map_first, map_last, stencil, input_first, result);
@@ -83,6 +86,7 @@ _CCCL_HOST_DEVICE OutputIterator gather_if(
   OutputIterator result,
   Predicate pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::gather_if", exec, map_first, map_last);
   using thrust::system::detail::generic::gather_if;
   return gather_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
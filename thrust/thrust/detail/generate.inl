@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/instrumentation.h>
 #include <thrust/generate.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/generate.h>
@@ -42,6 +43,7 @@ generate(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
          ForwardIterator last,
          Generator gen)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::generate", exec, first, last);
   using thrust::system::detail::generic::generate;
   return generate(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, gen);
 } // end generate()
@@ -51,6 +53,7 @@ template <typename DerivedPolicy, typename OutputIterator, typename Size, typena
 _CCCL_HOST_DEVICE OutputIterator generate_n(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, OutputIterator first, Size n, Generator gen)
 {
+  THRUST_DETAIL_INSTRUMENT_N("thrust::generate_n", exec, n);
   using thrust::system::detail::generic::generate_n;
   return generate_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, gen);
 } // end generate_n()
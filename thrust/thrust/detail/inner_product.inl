@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/inner_product.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/inner_product.h>
@@ -42,6 +43,7 @@ _CCCL_HOST_DEVICE OutputType inner_product(
   InputIterator2 first2,
   OutputType init)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::inner_product", exec, first1, last1);
   using thrust::system::detail::generic::inner_product;
   return inner_product(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, init);
 } // end inner_product()
@@ -62,6 +64,7 @@ _CCCL_HOST_DEVICE OutputType inner_product(
   BinaryFunction1 binary_op1,
   BinaryFunction2 binary_op2)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::inner_product", exec, first1, last1);
   using thrust::system::detail::generic::inner_product;
   return inner_product(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -0,0 +1,343 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+// The namespace Thrust is in depends on THRUST_ENABLE_INSTRUMENTATION, see
+// config/namespace.h, so the macro may not change after the first header.
+#if defined(THRUST_ENABLE_INSTRUMENTATION) != defined(THRUST_DETAIL_INSTRUMENTED_NAMESPACE)
+#  error "THRUST_ENABLE_INSTRUMENTATION must be defined, or not, before any Thrust header is included."
+#endif
+
+// The algorithms only contain instrumentation in translation units which ask
+// for it; everywhere else the macros below expand to nothing.
+#if defined(THRUST_ENABLE_INSTRUMENTATION)
+
+#  include <thrust/detail/type_traits.h>
+#  include <thrust/instrumentation.h>
+#  include <thrust/iterator/iterator_traits.h>
+
+#  include <cuda/std/type_traits>
+
+#  include <chrono>
+#  include <cstddef>
+#  include <cstdio>
+#  include <cstring>
+
+#  include <nv/target>
+
+#  if __has_include(<nvtx3/nvToolsExt.h>) && !defined(NVTX_DISABLE) && _CCCL_STD_VER >= 2014
+#    include <cub/detail/nvtx.cuh>
+#  endif
+
+// the ranges go to the domain CUB's own ranges are in
+#  if defined(NVTX3_CPP_DEFINITIONS_V1_0)
+#    define THRUST_DETAIL_INSTRUMENTATION_HAS_NVTX 1
+#  else
+#    define THRUST_DETAIL_INSTRUMENTATION_HAS_NVTX 0
+#  endif
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+template <typename>
+struct execution_policy;
+} // namespace sequential
+} // namespace detail
+namespace cpp
+{
+namespace detail
+{
+template <typename>
+struct execution_policy;
+} // namespace detail
+} // namespace cpp
+namespace omp
+{
+namespace detail
+{
+template <typename>
+struct execution_policy;
+} // namespace detail
+} // namespace omp
+namespace tbb
+{
+namespace detail
+{
+template <typename>
+struct execution_policy;
+} // namespace detail
+} // namespace tbb
+} // namespace system
+namespace cuda_cub
+{
+template <typename>
+struct execution_policy;
+} // namespace cuda_cub
+
+namespace detail
+{
+namespace instrumentation
+{
+
+// The systems are told apart by the policies they derive from, which need not
+// be complete for the ones a policy does not derive from. omp and tbb derive
+// from cpp, which derives from sequential.
+template <template <typename> class Policy, typename DerivedPolicy>
+using derives_from = ::cuda::std::is_base_of<Policy<DerivedPolicy>, DerivedPolicy>;
+
+template <typename DerivedPolicy>
+_CCCL_HOST_DEVICE const char* system_name(const thrust::detail::execution_policy_base<DerivedPolicy>&)
+{
+  return derives_from<thrust::system::omp::detail::execution_policy, DerivedPolicy>::value ? "omp"
+       : derives_from<thrust::system::tbb::detail::execution_policy, DerivedPolicy>::value ? "tbb"
+       : derives_from<thrust::system::cpp::detail::execution_policy, DerivedPolicy>::value ? "cpp"
+       : derives_from<thrust::system::detail::sequential::execution_policy, DerivedPolicy>::value ? "seq"
+       : derives_from<thrust::cuda_cub::execution_policy, DerivedPolicy>::value ? "cuda"
+                                                                                 : "unknown";
+}
+
+// the number of host threads an algorithm runs on unless its system reports
+// more, which is none on a device
+template <typename DerivedPolicy>
+_CCCL_HOST_DEVICE int default_threads(const thrust::detail::execution_policy_base<DerivedPolicy>&)
+{
+  return derives_from<thrust::cuda_cub::execution_policy, DerivedPolicy>::value ? 0 : 1;
+}
+
+// the number of elements an algorithm is reported to work on, which is only
+// worth computing for random access iterators
+template <typename Iterator>
+_CCCL_HOST_DEVICE std::size_t range_size(Iterator first, Iterator last, thrust::random_access_traversal_tag)
+{
+  const auto n = last - first;
+  return n > 0 ? static_cast<std::size_t>(n) : 0;
+}
+
+template <typename Iterator, typename Traversal>
+_CCCL_HOST_DEVICE std::size_t range_size(Iterator, Iterator, Traversal)
+{
+  return 0;
+}
+
+template <typename Iterator>
+_CCCL_HOST_DEVICE std::size_t range_size(Iterator first, Iterator last)
+{
+  return instrumentation::range_size(first, last, typename thrust::iterator_traversal<Iterator>::type());
+}
+
+template <typename Size>
+_CCCL_HOST_DEVICE std::size_t range_size(Size n)
+{
+  return n > 0 ? static_cast<std::size_t>(n) : 0;
+}
+
+// An algorithm in progress on the calling thread. Its constructor and
+// destructor do nothing on the device; on the host, the scopes form a stack
+// per thread which the systems report the threads and temporary storage they
+// use to.
+class algorithm_scope
+{
+  const char* m_algorithm;
+  const char* m_system;
+  std::size_t m_size;
+  std::size_t m_temporary_bytes;
+  int m_threads;
+  int m_depth;
+  bool m_active;
+  algorithm_hook m_hook;
+  algorithm_scope* m_parent;
+  std::chrono::steady_clock::rep m_start;
+
+  static algorithm_scope*& current()
+  {
+    static thread_local algorithm_scope* scope = nullptr;
+    return scope;
+  }
+
+  static std::chrono::steady_clock::rep now()
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+  }
+
+  void start()
+  {
+    m_hook = thrust::get_algorithm_hook();
+
+    if (!m_hook && !THRUST_DETAIL_INSTRUMENTATION_HAS_NVTX)
+    {
+      return;
+    }
+
+    m_parent = current();
+
+    // an algorithm implemented with another of the same name is one algorithm
+    if (m_parent && std::strcmp(m_parent->m_algorithm, m_algorithm) == 0)
+    {
+      return;
+    }
+
+    m_active  = true;
+    m_depth   = m_parent ? m_parent->m_depth + 1 : 0;
+    current() = this;
+
+#  if THRUST_DETAIL_INSTRUMENTATION_HAS_NVTX
+    char label[128];
+    std::snprintf(label, sizeof(label), "%s (%s, n = %zu)", m_algorithm, m_system, m_size);
+    const ::nvtx3::v1::event_attributes attributes{::nvtx3::v1::message{label}};
+    nvtxDomainRangePushEx(::nvtx3::v1::domain::get<CUB_NS_QUALIFIER::detail::NVTXCCCLDomain>(), attributes.get());
+#  endif
+
+    m_start = now();
+  }
+
+  void finish()
+  {
+    if (!m_active)
+    {
+      return;
+    }
+
+    const std::chrono::nanoseconds elapsed(now() - m_start);
+
+#  if THRUST_DETAIL_INSTRUMENTATION_HAS_NVTX
+    nvtxDomainRangePop(::nvtx3::v1::domain::get<CUB_NS_QUALIFIER::detail::NVTXCCCLDomain>());
+#  endif
+
+    current() = m_parent;
+
+    // what the algorithms called used counts towards their caller
+    if (m_parent)
+    {
+      m_parent->note_temporary_bytes(m_temporary_bytes);
+      m_parent->note_threads(m_threads);
+    }
+
+    if (m_hook)
+    {
+      const algorithm_event event{m_algorithm, m_system, m_size, elapsed, m_temporary_bytes, m_threads, m_depth};
+      m_hook(event);
+    }
+  }
+
+public:
+  _CCCL_HOST_DEVICE algorithm_scope(const char* algorithm, const char* system, int threads, std::size_t size)
+      : m_algorithm(algorithm)
+      , m_system(system)
+      , m_size(size)
+      , m_temporary_bytes(0)
+      , m_threads(threads)
+      , m_depth(0)
+      , m_active(false)
+      , m_hook(nullptr)
+      , m_parent(nullptr)
+      , m_start(0)
+  {
+    NV_IF_TARGET(NV_IS_HOST, (start();));
+  }
+
+  _CCCL_HOST_DEVICE ~algorithm_scope()
+  {
+    NV_IF_TARGET(NV_IS_HOST, (finish();));
+  }
+
+  algorithm_scope(const algorithm_scope&)            = delete;
+  algorithm_scope& operator=(const algorithm_scope&) = delete;
+
+  void note_temporary_bytes(std::size_t bytes)
+  {
+    m_temporary_bytes += bytes;
+  }
+
+  void note_threads(int threads)
+  {
+    m_threads = threads > m_threads ? threads : m_threads;
+  }
+
+  // the algorithm in progress on the calling thread, if any
+  static algorithm_scope* innermost()
+  {
+    return current();
+  }
+};
+
+inline void note_temporary_bytes(std::size_t bytes)
+{
+  if (algorithm_scope* scope = algorithm_scope::innermost())
+  {
+    scope->note_temporary_bytes(bytes);
+  }
+}
+
+inline void note_threads(int threads)
+{
+  if (algorithm_scope* scope = algorithm_scope::innermost())
+  {
+    scope->note_threads(threads);
+  }
+}
+
+} // namespace instrumentation
+} // namespace detail
+THRUST_NAMESPACE_END
+
+// Reports the algorithm the enclosing function implements, on the elements of
+// [first, last), from here to the end of the function.
+#  define THRUST_DETAIL_INSTRUMENT_RANGE(algorithm, exec, first, last)                     \
+    THRUST_NS_QUALIFIER::detail::instrumentation::algorithm_scope __thrust_algorithm_scope( \
+      algorithm,                                                                            \
+      THRUST_NS_QUALIFIER::detail::instrumentation::system_name(exec),                      \
+      THRUST_NS_QUALIFIER::detail::instrumentation::default_threads(exec),                  \
+      THRUST_NS_QUALIFIER::detail::instrumentation::range_size(first, last))
+
+// the same, for an algorithm on n elements
+#  define THRUST_DETAIL_INSTRUMENT_N(algorithm, exec, n)                                    \
+    THRUST_NS_QUALIFIER::detail::instrumentation::algorithm_scope __thrust_algorithm_scope( \
+      algorithm,                                                                            \
+      THRUST_NS_QUALIFIER::detail::instrumentation::system_name(exec),                      \
+      THRUST_NS_QUALIFIER::detail::instrumentation::default_threads(exec),                  \
+      THRUST_NS_QUALIFIER::detail::instrumentation::range_size(n))
+
+// Attributes temporary storage, or a number of host threads working at once,
+// to the algorithm in progress on the calling thread.
+#  define THRUST_DETAIL_INSTRUMENT_TEMPORARY_BYTES(bytes) \
+    NV_IF_TARGET(NV_IS_HOST, (THRUST_NS_QUALIFIER::detail::instrumentation::note_temporary_bytes(bytes);))
+#  define THRUST_DETAIL_INSTRUMENT_THREADS(threads) \
+    NV_IF_TARGET(NV_IS_HOST, (THRUST_NS_QUALIFIER::detail::instrumentation::note_threads(threads);))
+
+#else // THRUST_ENABLE_INSTRUMENTATION
+
+#  define THRUST_DETAIL_INSTRUMENT_RANGE(algorithm, exec, first, last)
+#  define THRUST_DETAIL_INSTRUMENT_N(algorithm, exec, n)
+#  define THRUST_DETAIL_INSTRUMENT_TEMPORARY_BYTES(bytes)
+#  define THRUST_DETAIL_INSTRUMENT_THREADS(threads)
+
+#endif // THRUST_ENABLE_INSTRUMENTATION
@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/system/detail/adl/merge.h>
@@ -44,6 +45,7 @@ _CCCL_HOST_DEVICE OutputIterator merge(
   InputIterator2 last2,
   OutputIterator result)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::merge", exec, first1, last1);
   using thrust::system::detail::generic::merge;
   return merge(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
 } // end merge()
@@ -63,6 +65,7 @@ _CCCL_HOST_DEVICE OutputIterator merge(
   OutputIterator result,
   StrictWeakCompare comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::merge", exec, first1, last1);
   using thrust::system::detail::generic::merge;
   return merge(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
@@ -87,6 +90,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
   OutputIterator1 keys_result,
   OutputIterator2 values_result)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::merge_by_key", exec, keys_first1, keys_last1);
   using thrust::system::detail::generic::merge_by_key;
   return merge_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -121,6 +125,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
   OutputIterator2 values_result,
   Compare comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::merge_by_key", exec, keys_first1, keys_last1);
   using thrust::system::detail::generic::merge_by_key;
   return merge_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
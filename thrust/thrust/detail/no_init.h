@@ -0,0 +1,84 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file no_init.h
+ *  \brief A tag requesting default-initialization of container elements.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup container_classes Container Classes
+ *  \{
+ */
+
+/*! \p no_init_t is the type of \p no_init, which requests that the
+ *  elements created by a container's sized constructor or \c resize are
+ *  default-initialized rather than value-initialized. Elements of trivially
+ *  default constructible types are left uninitialized, which avoids the
+ *  cost of zeroing memory that is overwritten right away. Other types are
+ *  value-initialized as usual.
+ *
+ *  Containers of the parallel host systems, such as \p thrust::omp::vector,
+ *  touch the new memory from the threads of the system with the same
+ *  decomposition their algorithms use, so that on NUMA machines the pages
+ *  end up on the nodes of the threads that later process them.
+ *
+ *  \see no_init
+ */
+struct no_init_t
+{
+  explicit no_init_t() = default;
+};
+
+/*! \p no_init is the tag to pass to a container's sized constructor or
+ *  \c resize to default-initialize the new elements.
+ *
+ *  The following code snippet demonstrates how to create a \p device_vector
+ *  whose elements are overwritten before they are read.
+ *
+ *  \code
+ *  #include <thrust/device_vector.h>
+ *  #include <thrust/sequence.h>
+ *  ...
+ *  // no need to zero the elements first
+ *  thrust::device_vector<int> vec(1000, thrust::no_init);
+ *
+ *  thrust::sequence(vec.begin(), vec.end());
+ *
+ *  // the new elements are uninitialized as well
+ *  vec.resize(2000, thrust::no_init);
+ *  \endcode
+ *
+ *  \see no_init_t
+ */
+THRUST_INLINE_CONSTANT no_init_t no_init{};
+
+/*! \} // container_classes
+ */
+
+THRUST_NAMESPACE_END
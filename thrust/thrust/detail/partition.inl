@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/partition.h>
 #include <thrust/system/detail/adl/partition.h>
@@ -41,6 +42,7 @@ _CCCL_HOST_DEVICE ForwardIterator partition(
   ForwardIterator last,
   Predicate pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::partition", exec, first, last);
   using thrust::system::detail::generic::partition;
   return partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end partition()
@@ -54,6 +56,7 @@ _CCCL_HOST_DEVICE ForwardIterator partition(
   InputIterator stencil,
   Predicate pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::partition", exec, first, last);
   using thrust::system::detail::generic::partition;
   return partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred);
 } // end partition()
@@ -72,6 +75,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> partition_copy(
   OutputIterator2 out_false,
   Predicate pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::partition_copy", exec, first, last);
   using thrust::system::detail::generic::partition_copy;
   return partition_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, out_true, out_false, pred);
@@ -93,6 +97,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> partition_copy(
   OutputIterator2 out_false,
   Predicate pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::partition_copy", exec, first, last);
   using thrust::system::detail::generic::partition_copy;
   return partition_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, out_true, out_false, pred);
@@ -106,6 +111,7 @@ _CCCL_HOST_DEVICE ForwardIterator stable_partition(
   ForwardIterator last,
   Predicate pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::stable_partition", exec, first, last);
   using thrust::system::detail::generic::stable_partition;
   return stable_partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end stable_partition()
@@ -119,6 +125,7 @@ _CCCL_HOST_DEVICE ForwardIterator stable_partition(
   InputIterator stencil,
   Predicate pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::stable_partition", exec, first, last);
   using thrust::system::detail::generic::stable_partition;
   return stable_partition(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred);
 } // end stable_partition()
@@ -137,6 +144,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> stable_partitio
   OutputIterator2 out_false,
   Predicate pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::stable_partition_copy", exec, first, last);
   using thrust::system::detail::generic::stable_partition_copy;
   return stable_partition_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, out_true, out_false, pred);
@@ -158,6 +166,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> stable_partitio
   OutputIterator2 out_false,
   Predicate pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::stable_partition_copy", exec, first, last);
   using thrust::system::detail::generic::stable_partition_copy;
   return stable_partition_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, out_true, out_false, pred);
@@ -183,6 +192,7 @@ _CCCL_HOST_DEVICE bool is_partitioned(
   InputIterator last,
   Predicate pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::is_partitioned", exec, first, last);
   using thrust::system::detail::generic::is_partitioned;
   return is_partitioned(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end is_partitioned()
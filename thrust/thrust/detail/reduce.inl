@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reduce.h>
 #include <thrust/system/detail/adl/reduce.h>
@@ -41,6 +42,7 @@ template <typename DerivedPolicy, typename InputIterator>
 _CCCL_HOST_DEVICE typename thrust::iterator_traits<InputIterator>::value_type
 reduce(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, InputIterator last)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::reduce", exec, first, last);
   using thrust::system::detail::generic::reduce;
   return reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end reduce()
@@ -50,6 +52,7 @@ template <typename DerivedPolicy, typename InputIterator, typename T>
 _CCCL_HOST_DEVICE T reduce(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, InputIterator last, T init)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::reduce", exec, first, last);
   using thrust::system::detail::generic::reduce;
   return reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init);
 } // end reduce()
@@ -63,6 +66,7 @@ _CCCL_HOST_DEVICE T reduce(
   T init,
   BinaryFunction binary_op)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::reduce", exec, first, last);
   using thrust::system::detail::generic::reduce;
   return reduce(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init, binary_op);
 } // end reduce()
@@ -81,6 +85,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
   OutputIterator1 keys_output,
   OutputIterator2 values_output)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::reduce_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::reduce_by_key;
   return reduce_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -107,6 +112,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
   OutputIterator2 values_output,
   BinaryPredicate binary_pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::reduce_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::reduce_by_key;
   return reduce_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -136,6 +142,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
   BinaryPredicate binary_pred,
   BinaryFunction binary_op)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::reduce_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::reduce_by_key;
   return reduce_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
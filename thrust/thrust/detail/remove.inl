@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/remove.h>
 #include <thrust/system/detail/adl/remove.h>
@@ -41,6 +42,7 @@ _CCCL_HOST_DEVICE ForwardIterator remove(
   ForwardIterator last,
   const T& value)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::remove", exec, first, last);
   using thrust::system::detail::generic::remove;
   return remove(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, value);
 } // end remove()
@@ -54,6 +56,7 @@ _CCCL_HOST_DEVICE OutputIterator remove_copy(
   OutputIterator result,
   const T& value)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::remove_copy", exec, first, last);
   using thrust::system::detail::generic::remove_copy;
   return remove_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, value);
 } // end remove_copy()
@@ -66,6 +69,7 @@ _CCCL_HOST_DEVICE ForwardIterator remove_if(
   ForwardIterator last,
   Predicate pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::remove_if", exec, first, last);
   using thrust::system::detail::generic::remove_if;
   return remove_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred);
 } // end remove_if()
@@ -79,6 +83,7 @@ _CCCL_HOST_DEVICE OutputIterator remove_copy_if(
   OutputIterator result,
   Predicate pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::remove_copy_if", exec, first, last);
   using thrust::system::detail::generic::remove_copy_if;
   return remove_copy_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, pred);
 } // end remove_copy_if()
@@ -92,6 +97,7 @@ _CCCL_HOST_DEVICE ForwardIterator remove_if(
   InputIterator stencil,
   Predicate pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::remove_if", exec, first, last);
   using thrust::system::detail::generic::remove_if;
   return remove_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred);
 } // end remove_if()
@@ -110,6 +116,7 @@ _CCCL_HOST_DEVICE OutputIterator remove_copy_if(
   OutputIterator result,
   Predicate pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::remove_copy_if", exec, first, last);
   using thrust::system::detail::generic::remove_copy_if;
   return remove_copy_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, pred);
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/replace.h>
 #include <thrust/system/detail/adl/replace.h>
@@ -42,6 +43,7 @@ replace(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
         const T& old_value,
         const T& new_value)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::replace", exec, first, last);
   using thrust::system::detail::generic::replace;
   return replace(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, old_value, new_value);
 } // end replace()
@@ -55,6 +57,7 @@ _CCCL_HOST_DEVICE void replace_if(
   Predicate pred,
   const T& new_value)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::replace_if", exec, first, last);
   using thrust::system::detail::generic::replace_if;
   return replace_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, pred, new_value);
 } // end replace_if()
@@ -69,6 +72,7 @@ _CCCL_HOST_DEVICE void replace_if(
   Predicate pred,
   const T& new_value)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::replace_if", exec, first, last);
   using thrust::system::detail::generic::replace_if;
   return replace_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, pred, new_value);
@@ -84,6 +88,7 @@ _CCCL_HOST_DEVICE OutputIterator replace_copy(
   const T& old_value,
   const T& new_value)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::replace_copy", exec, first, last);
   using thrust::system::detail::generic::replace_copy;
   return replace_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, old_value, new_value);
@@ -99,6 +104,7 @@ _CCCL_HOST_DEVICE OutputIterator replace_copy_if(
   Predicate pred,
   const T& new_value)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::replace_copy_if", exec, first, last);
   using thrust::system::detail::generic::replace_copy_if;
   return replace_copy_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, pred, new_value);
@@ -120,6 +126,7 @@ _CCCL_HOST_DEVICE OutputIterator replace_copy_if(
   Predicate pred,
   const T& new_value)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::replace_copy_if", exec, first, last);
   using thrust::system::detail::generic::replace_copy_if;
   return replace_copy_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, pred, new_value);
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/scan.h>
 #include <thrust/system/detail/adl/scan.h>
@@ -43,6 +44,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan(
   InputIterator last,
   OutputIterator result)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::inclusive_scan", exec, first, last);
   using thrust::system::detail::generic::inclusive_scan;
   return inclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end inclusive_scan()
@@ -56,6 +58,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan(
   OutputIterator result,
   AssociativeOperator binary_op)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::inclusive_scan", exec, first, last);
   using thrust::system::detail::generic::inclusive_scan;
   return inclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, binary_op);
 } // end inclusive_scan()
@@ -68,6 +71,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan(
   InputIterator last,
   OutputIterator result)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::exclusive_scan", exec, first, last);
   using thrust::system::detail::generic::exclusive_scan;
   return exclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end exclusive_scan()
@@ -81,6 +85,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan(
   OutputIterator result,
   T init)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::exclusive_scan", exec, first, last);
   using thrust::system::detail::generic::exclusive_scan;
   return exclusive_scan(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, init);
 } // end exclusive_scan()
@@ -95,6 +100,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan(
   T init,
   AssociativeOperator binary_op)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::exclusive_scan", exec, first, last);
   using thrust::system::detail::generic::exclusive_scan;
   return exclusive_scan(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, init, binary_op);
@@ -109,6 +115,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan_by_key(
   InputIterator2 first2,
   OutputIterator result)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::inclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::inclusive_scan_by_key;
   return inclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result);
@@ -128,6 +135,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan_by_key(
   OutputIterator result,
   BinaryPredicate binary_pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::inclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::inclusive_scan_by_key;
   return inclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, binary_pred);
@@ -149,6 +157,7 @@ _CCCL_HOST_DEVICE OutputIterator inclusive_scan_by_key(
   BinaryPredicate binary_pred,
   AssociativeOperator binary_op)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::inclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::inclusive_scan_by_key;
   return inclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -169,6 +178,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan_by_key(
   InputIterator2 first2,
   OutputIterator result)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::exclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result);
@@ -184,6 +194,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan_by_key(
   OutputIterator result,
   T init)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::exclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, init);
@@ -205,6 +216,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan_by_key(
   T init,
   BinaryPredicate binary_pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::exclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, init, binary_pred);
@@ -228,6 +240,7 @@ _CCCL_HOST_DEVICE OutputIterator exclusive_scan_by_key(
   BinaryPredicate binary_pred,
   AssociativeOperator binary_op)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::exclusive_scan_by_key", exec, first1, last1);
   using thrust::system::detail::generic::exclusive_scan_by_key;
   return exclusive_scan_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/scatter.h>
 #include <thrust/system/detail/adl/scatter.h>
@@ -43,6 +44,7 @@ scatter(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
         InputIterator2 map,
         RandomAccessIterator output)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::scatter", exec, first, last);
   using thrust::system::detail::generic::scatter;
   return scatter(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, map, output);
 } // end scatter()
@@ -61,6 +63,7 @@ _CCCL_HOST_DEVICE void scatter_if(
   InputIterator3 stencil,
   RandomAccessIterator output)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::scatter_if", exec, first, last);
   using thrust::system::detail::generic::scatter_if;
   return scatter_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, map, stencil, output);
 } // end scatter_if()
@@ -81,6 +84,7 @@ _CCCL_HOST_DEVICE void scatter_if(
   RandomAccessIterator output,
   Predicate pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::scatter_if", exec, first, last);
   using thrust::system::detail::generic::scatter_if;
   return scatter_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, map, stencil, output, pred);
@@ -0,0 +1,404 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/instrumentation.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/selection.h>
+#include <thrust/system/detail/adl/selection.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/selection.h>
+
+THRUST_NAMESPACE_BEGIN
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void nth_element(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                                   RandomAccessIterator first,
+                                   RandomAccessIterator nth,
+                                   RandomAccessIterator last)
+{
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::nth_element", exec, first, last);
+  using thrust::system::detail::generic::nth_element;
+  return nth_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, nth, last);
+} // end nth_element()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void nth_element(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator nth,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp)
+{
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::nth_element", exec, first, last);
+  using thrust::system::detail::generic::nth_element;
+  return nth_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, nth, last, comp);
+} // end nth_element()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void partial_sort(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                                    RandomAccessIterator first,
+                                    RandomAccessIterator middle,
+                                    RandomAccessIterator last)
+{
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::partial_sort", exec, first, last);
+  using thrust::system::detail::generic::partial_sort;
+  return partial_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, middle, last);
+} // end partial_sort()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void partial_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator middle,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp)
+{
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::partial_sort", exec, first, last);
+  using thrust::system::detail::generic::partial_sort;
+  return partial_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, middle, last, comp);
+} // end partial_sort()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2>
+_CCCL_HOST_DEVICE RandomAccessIterator2 partial_sort_copy(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 result_first,
+  RandomAccessIterator2 result_last)
+{
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::partial_sort_copy", exec, first, last);
+  using thrust::system::detail::generic::partial_sort_copy;
+  return partial_sort_copy(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result_first, result_last);
+} // end partial_sort_copy()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE RandomAccessIterator2 partial_sort_copy(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 result_first,
+  RandomAccessIterator2 result_last,
+  StrictWeakOrdering comp)
+{
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::partial_sort_copy", exec, first, last);
+  using thrust::system::detail::generic::partial_sort_copy;
+  return partial_sort_copy(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result_first, result_last, comp);
+} // end partial_sort_copy()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator
+top_k(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+      RandomAccessIterator first,
+      RandomAccessIterator last,
+      Size k,
+      OutputIterator result)
+{
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::top_k", exec, first, last);
+  using thrust::system::detail::generic::top_k;
+  return top_k(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, k, result);
+} // end top_k()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename Size,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator
+top_k(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+      RandomAccessIterator first,
+      RandomAccessIterator last,
+      Size k,
+      OutputIterator result,
+      StrictWeakOrdering comp)
+{
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::top_k", exec, first, last);
+  using thrust::system::detail::generic::top_k;
+  return top_k(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, k, result, comp);
+} // end top_k()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size,
+          typename OutputIterator1,
+          typename OutputIterator2>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> top_k_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  Size k,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result)
+{
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::top_k_by_key", exec, keys_first, keys_last);
+  using thrust::system::detail::generic::top_k_by_key;
+  return top_k_by_key(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    keys_first,
+    keys_last,
+    values_first,
+    k,
+    keys_result,
+    values_result);
+} // end top_k_by_key()
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> top_k_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  Size k,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp)
+{
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::top_k_by_key", exec, keys_first, keys_last);
+  using thrust::system::detail::generic::top_k_by_key;
+  return top_k_by_key(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    keys_first,
+    keys_last,
+    values_first,
+    k,
+    keys_result,
+    values_result,
+    comp);
+} // end top_k_by_key()
+
+template <typename RandomAccessIterator>
+void nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System = typename thrust::iterator_system<RandomAccessIterator>::type;
+
+  System system;
+
+  return thrust::nth_element(select_system(system), first, nth, last);
+} // end nth_element()
+
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+void nth_element(
+  RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System = typename thrust::iterator_system<RandomAccessIterator>::type;
+
+  System system;
+
+  return thrust::nth_element(select_system(system), first, nth, last, comp);
+} // end nth_element()
+
+template <typename RandomAccessIterator>
+void partial_sort(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System = typename thrust::iterator_system<RandomAccessIterator>::type;
+
+  System system;
+
+  return thrust::partial_sort(select_system(system), first, middle, last);
+} // end partial_sort()
+
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+void partial_sort(
+  RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System = typename thrust::iterator_system<RandomAccessIterator>::type;
+
+  System system;
+
+  return thrust::partial_sort(select_system(system), first, middle, last, comp);
+} // end partial_sort()
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+RandomAccessIterator2 partial_sort_copy(
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 result_first,
+  RandomAccessIterator2 result_last)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::partial_sort_copy(select_system(system1, system2), first, last, result_first, result_last);
+} // end partial_sort_copy()
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+RandomAccessIterator2 partial_sort_copy(
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 result_first,
+  RandomAccessIterator2 result_last,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::partial_sort_copy(select_system(system1, system2), first, last, result_first, result_last, comp);
+} // end partial_sort_copy()
+
+template <typename RandomAccessIterator, typename Size, typename OutputIterator>
+OutputIterator top_k(RandomAccessIterator first, RandomAccessIterator last, Size k, OutputIterator result)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::top_k(select_system(system1, system2), first, last, k, result);
+} // end top_k()
+
+template <typename RandomAccessIterator, typename Size, typename OutputIterator, typename StrictWeakOrdering>
+OutputIterator
+top_k(RandomAccessIterator first, RandomAccessIterator last, Size k, OutputIterator result, StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator>::type;
+  using System2 = typename thrust::iterator_system<OutputIterator>::type;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::top_k(select_system(system1, system2), first, last, k, result, comp);
+} // end top_k()
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size,
+          typename OutputIterator1,
+          typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2> top_k_by_key(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  Size k,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System4 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::top_k_by_key(
+    select_system(system1, system2, system3, system4),
+    keys_first,
+    keys_last,
+    values_first,
+    k,
+    keys_result,
+    values_result);
+} // end top_k_by_key()
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+thrust::pair<OutputIterator1, OutputIterator2> top_k_by_key(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  Size k,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System1 = typename thrust::iterator_system<RandomAccessIterator1>::type;
+  using System2 = typename thrust::iterator_system<RandomAccessIterator2>::type;
+  using System3 = typename thrust::iterator_system<OutputIterator1>::type;
+  using System4 = typename thrust::iterator_system<OutputIterator2>::type;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::top_k_by_key(
+    select_system(system1, system2, system3, system4),
+    keys_first,
+    keys_last,
+    values_first,
+    k,
+    keys_result,
+    values_result,
+    comp);
+} // end top_k_by_key()
+
+THRUST_NAMESPACE_END
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/sequence.h>
 #include <thrust/system/detail/adl/sequence.h>
@@ -38,6 +39,7 @@ template <typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE void
 sequence(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::sequence", exec, first, last);
   using thrust::system::detail::generic::sequence;
   return sequence(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end sequence()
@@ -47,6 +49,7 @@ template <typename DerivedPolicy, typename ForwardIterator, typename T>
 _CCCL_HOST_DEVICE void sequence(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, T init)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::sequence", exec, first, last);
   using thrust::system::detail::generic::sequence;
   return sequence(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init);
 } // end sequence()
@@ -60,6 +63,7 @@ _CCCL_HOST_DEVICE void sequence(
   T init,
   T step)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::sequence", exec, first, last);
   using thrust::system::detail::generic::sequence;
   return sequence(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, init, step);
 } // end sequence()
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/set_operations.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -42,6 +43,7 @@ _CCCL_HOST_DEVICE OutputIterator set_difference(
   InputIterator2 last2,
   OutputIterator result)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::set_difference", exec, first1, last1);
   using thrust::system::detail::generic::set_difference;
   return set_difference(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
@@ -62,6 +64,7 @@ _CCCL_HOST_DEVICE OutputIterator set_difference(
   OutputIterator result,
   StrictWeakCompare comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::set_difference", exec, first1, last1);
   using thrust::system::detail::generic::set_difference;
   return set_difference(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
@@ -86,6 +89,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> set_difference_
   OutputIterator1 keys_result,
   OutputIterator2 values_result)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::set_difference_by_key", exec, keys_first1, keys_last1);
   using thrust::system::detail::generic::set_difference_by_key;
   return set_difference_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -120,6 +124,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> set_difference_
   OutputIterator2 values_result,
   StrictWeakCompare comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::set_difference_by_key", exec, keys_first1, keys_last1);
   using thrust::system::detail::generic::set_difference_by_key;
   return set_difference_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -144,6 +149,7 @@ _CCCL_HOST_DEVICE OutputIterator set_intersection(
   InputIterator2 last2,
   OutputIterator result)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::set_intersection", exec, first1, last1);
   using thrust::system::detail::generic::set_intersection;
   return set_intersection(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
@@ -164,6 +170,7 @@ _CCCL_HOST_DEVICE OutputIterator set_intersection(
   OutputIterator result,
   StrictWeakCompare comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::set_intersection", exec, first1, last1);
   using thrust::system::detail::generic::set_intersection;
   return set_intersection(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
@@ -186,6 +193,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> set_intersectio
   OutputIterator1 keys_result,
   OutputIterator2 values_result)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::set_intersection_by_key", exec, keys_first1, keys_last1);
   using thrust::system::detail::generic::set_intersection_by_key;
   return set_intersection_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -217,6 +225,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> set_intersectio
   OutputIterator2 values_result,
   StrictWeakCompare comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::set_intersection_by_key", exec, keys_first1, keys_last1);
   using thrust::system::detail::generic::set_intersection_by_key;
   return set_intersection_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -240,6 +249,7 @@ _CCCL_HOST_DEVICE OutputIterator set_symmetric_difference(
   InputIterator2 last2,
   OutputIterator result)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::set_symmetric_difference", exec, first1, last1);
   using thrust::system::detail::generic::set_symmetric_difference;
   return set_symmetric_difference(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
@@ -260,6 +270,7 @@ _CCCL_HOST_DEVICE OutputIterator set_symmetric_difference(
   OutputIterator result,
   StrictWeakCompare comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::set_symmetric_difference", exec, first1, last1);
   using thrust::system::detail::generic::set_symmetric_difference;
   return set_symmetric_difference(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
@@ -284,6 +295,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> set_symmetric_d
   OutputIterator1 keys_result,
   OutputIterator2 values_result)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::set_symmetric_difference_by_key", exec, keys_first1, keys_last1);
   using thrust::system::detail::generic::set_symmetric_difference_by_key;
   return set_symmetric_difference_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -318,6 +330,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> set_symmetric_d
   OutputIterator2 values_result,
   StrictWeakCompare comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::set_symmetric_difference_by_key", exec, keys_first1, keys_last1);
   using thrust::system::detail::generic::set_symmetric_difference_by_key;
   return set_symmetric_difference_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -342,6 +355,7 @@ _CCCL_HOST_DEVICE OutputIterator set_union(
   InputIterator2 last2,
   OutputIterator result)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::set_union", exec, first1, last1);
   using thrust::system::detail::generic::set_union;
   return set_union(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result);
@@ -362,6 +376,7 @@ _CCCL_HOST_DEVICE OutputIterator set_union(
   OutputIterator result,
   StrictWeakCompare comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::set_union", exec, first1, last1);
   using thrust::system::detail::generic::set_union;
   return set_union(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, last2, result, comp);
@@ -386,6 +401,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> set_union_by_ke
   OutputIterator1 keys_result,
   OutputIterator2 values_result)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::set_union_by_key", exec, keys_first1, keys_last1);
   using thrust::system::detail::generic::set_union_by_key;
   return set_union_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -420,6 +436,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> set_union_by_ke
   OutputIterator2 values_result,
   StrictWeakCompare comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::set_union_by_key", exec, keys_first1, keys_last1);
   using thrust::system::detail::generic::set_union_by_key;
   return set_union_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
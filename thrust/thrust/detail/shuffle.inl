@@ -25,8 +25,10 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/shuffle.h>
+#include <thrust/system/detail/adl/shuffle.h>
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/shuffle.h>
 
@@ -37,6 +39,7 @@ template <typename DerivedPolicy, typename RandomIterator, typename URBG>
 _CCCL_HOST_DEVICE void shuffle(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, URBG&& g)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::shuffle", exec, first, last);
   using thrust::system::detail::generic::shuffle;
   return shuffle(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, g);
 }
@@ -61,6 +64,7 @@ _CCCL_HOST_DEVICE void shuffle_copy(
   OutputIterator result,
   URBG&& g)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::shuffle_copy", exec, first, last);
   using thrust::system::detail::generic::shuffle_copy;
   return shuffle_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, g);
 }
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/sort.h>
 #include <thrust/system/detail/adl/sort.h>
@@ -39,6 +40,7 @@ _CCCL_HOST_DEVICE void sort(const thrust::detail::execution_policy_base<DerivedP
                             RandomAccessIterator first,
                             RandomAccessIterator last)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::sort", exec, first, last);
   using thrust::system::detail::generic::sort;
   return sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end sort()
@@ -51,6 +53,7 @@ sort(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
      RandomAccessIterator last,
      StrictWeakOrdering comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::sort", exec, first, last);
   using thrust::system::detail::generic::sort;
   return sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end sort()
@@ -61,6 +64,7 @@ _CCCL_HOST_DEVICE void stable_sort(const thrust::detail::execution_policy_base<D
                                    RandomAccessIterator first,
                                    RandomAccessIterator last)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::stable_sort", exec, first, last);
   using thrust::system::detail::generic::stable_sort;
   return stable_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end stable_sort()
@@ -73,6 +77,7 @@ _CCCL_HOST_DEVICE void stable_sort(
   RandomAccessIterator last,
   StrictWeakOrdering comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::stable_sort", exec, first, last);
   using thrust::system::detail::generic::stable_sort;
   return stable_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end stable_sort()
@@ -85,6 +90,7 @@ _CCCL_HOST_DEVICE void sort_by_key(
   RandomAccessIterator1 keys_last,
   RandomAccessIterator2 values_first)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::sort_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::sort_by_key;
   return sort_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first);
@@ -102,6 +108,7 @@ _CCCL_HOST_DEVICE void sort_by_key(
   RandomAccessIterator2 values_first,
   StrictWeakOrdering comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::sort_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::sort_by_key;
   return sort_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, comp);
@@ -115,6 +122,7 @@ _CCCL_HOST_DEVICE void stable_sort_by_key(
   RandomAccessIterator1 keys_last,
   RandomAccessIterator2 values_first)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::stable_sort_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::stable_sort_by_key;
   return stable_sort_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first);
@@ -132,6 +140,7 @@ _CCCL_HOST_DEVICE void stable_sort_by_key(
   RandomAccessIterator2 values_first,
   StrictWeakOrdering comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::stable_sort_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::stable_sort_by_key;
   return stable_sort_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, comp);
@@ -142,6 +151,7 @@ template <typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE bool
 is_sorted(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::is_sorted", exec, first, last);
   using thrust::system::detail::generic::is_sorted;
   return is_sorted(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end is_sorted()
@@ -154,6 +164,7 @@ is_sorted(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
           ForwardIterator last,
           Compare comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::is_sorted", exec, first, last);
   using thrust::system::detail::generic::is_sorted;
   return is_sorted(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end is_sorted()
@@ -163,6 +174,7 @@ template <typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE ForwardIterator is_sorted_until(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::is_sorted_until", exec, first, last);
   using thrust::system::detail::generic::is_sorted_until;
   return is_sorted_until(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end is_sorted_until()
@@ -175,6 +187,7 @@ _CCCL_HOST_DEVICE ForwardIterator is_sorted_until(
   ForwardIterator last,
   Compare comp)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::is_sorted_until", exec, first, last);
   using thrust::system::detail::generic::is_sorted_until;
   return is_sorted_until(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, comp);
 } // end is_sorted_until()
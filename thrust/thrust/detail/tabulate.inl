@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/tabulate.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -41,6 +42,7 @@ tabulate(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
          ForwardIterator last,
          UnaryOperation unary_op)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::tabulate", exec, first, last);
   using thrust::system::detail::generic::tabulate;
   return tabulate(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, unary_op);
 } // end tabulate()
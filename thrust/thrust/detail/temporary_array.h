@@ -149,3 +149,6 @@ public:
 THRUST_NAMESPACE_END
 
 #include <thrust/detail/temporary_array.inl>
+
+// the host systems cache temporary buffers in a pool, which needs temporary_array to be complete
+#include <thrust/mr/disjoint_pool.h>
@@ -27,6 +27,7 @@
 #endif // no system header
 #include <thrust/detail/execute_with_allocator.h>
 #include <thrust/detail/execution_policy.h>
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/pointer.h>
 #include <thrust/detail/raw_pointer_cast.h>
 #include <thrust/pair.h>
@@ -63,8 +64,12 @@ get_temporary_buffer(const thrust::detail::execution_policy_base<DerivedPolicy>&
   using thrust::detail::get_temporary_buffer; // execute_with_allocator
   using thrust::system::detail::generic::get_temporary_buffer;
 
-  return thrust::detail::down_cast_pair<T, DerivedPolicy>(
+  const auto result = thrust::detail::down_cast_pair<T, DerivedPolicy>(
     get_temporary_buffer<T>(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), n));
+
+  THRUST_DETAIL_INSTRUMENT_TEMPORARY_BYTES(sizeof(T) * static_cast<std::size_t>(result.second));
+
+  return result;
 } // end get_temporary_buffer()
 
 _CCCL_EXEC_CHECK_DISABLE
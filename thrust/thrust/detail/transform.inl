@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/transform.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -43,6 +44,7 @@ _CCCL_HOST_DEVICE OutputIterator transform(
   OutputIterator result,
   UnaryFunction op)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::transform", exec, first, last);
   using thrust::system::detail::generic::transform;
   return transform(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, op);
 } // end transform()
@@ -61,6 +63,7 @@ _CCCL_HOST_DEVICE OutputIterator transform(
   OutputIterator result,
   BinaryFunction op)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::transform", exec, first1, last1);
   using thrust::system::detail::generic::transform;
   return transform(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first1, last1, first2, result, op);
 } // end transform()
@@ -79,6 +82,7 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if(
   UnaryFunction op,
   Predicate pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::transform_if", exec, first, last);
   using thrust::system::detail::generic::transform_if;
   return transform_if(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, op, pred);
 } // end transform_if()
@@ -99,6 +103,7 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if(
   UnaryFunction op,
   Predicate pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::transform_if", exec, first, last);
   using thrust::system::detail::generic::transform_if;
   return transform_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, stencil, result, op, pred);
@@ -122,6 +127,7 @@ _CCCL_HOST_DEVICE ForwardIterator transform_if(
   BinaryFunction binary_op,
   Predicate pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::transform_if", exec, first1, last1);
   using thrust::system::detail::generic::transform_if;
   return transform_if(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
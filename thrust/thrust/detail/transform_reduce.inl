@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/transform_reduce.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -46,6 +47,7 @@ _CCCL_HOST_DEVICE OutputType transform_reduce(
   OutputType init,
   BinaryFunction binary_op)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::transform_reduce", exec, first, last);
   using thrust::system::detail::generic::transform_reduce;
   return transform_reduce(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, unary_op, init, binary_op);
@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/scan.h>
 #include <thrust/system/detail/adl/transform_scan.h>
@@ -48,6 +49,7 @@ _CCCL_HOST_DEVICE OutputIterator transform_inclusive_scan(
   UnaryFunction unary_op,
   AssociativeOperator binary_op)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::transform_inclusive_scan", exec, first, last);
   using thrust::system::detail::generic::transform_inclusive_scan;
   return transform_inclusive_scan(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, unary_op, binary_op);
@@ -69,6 +71,7 @@ _CCCL_HOST_DEVICE OutputIterator transform_exclusive_scan(
   T init,
   AssociativeOperator binary_op)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::transform_exclusive_scan", exec, first, last);
   using thrust::system::detail::generic::transform_exclusive_scan;
   return transform_exclusive_scan(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result, unary_op, init, binary_op);
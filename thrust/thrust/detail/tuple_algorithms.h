@@ -42,7 +42,7 @@ namespace detail
 template <typename Tuple, typename F, std::size_t... Is>
 void tuple_for_each_impl(Tuple&& t, F&& f, index_sequence<Is...>)
 {
-  auto l = {(f(std::get<Is>(t)), 0)...};
+  int l[] = {0, (f(std::get<Is>(t)), 0)...};
   THRUST_UNUSED_VAR(l);
 }
 
@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/instrumentation.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/uninitialized_copy.h>
 #include <thrust/system/detail/generic/select_system.h>
@@ -42,6 +43,7 @@ _CCCL_HOST_DEVICE ForwardIterator uninitialized_copy(
   InputIterator last,
   ForwardIterator result)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::uninitialized_copy", exec, first, last);
   using thrust::system::detail::generic::uninitialized_copy;
   return uninitialized_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result);
 } // end uninitialized_copy()
@@ -51,6 +53,7 @@ template <typename DerivedPolicy, typename InputIterator, typename Size, typenam
 _CCCL_HOST_DEVICE ForwardIterator uninitialized_copy_n(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, InputIterator first, Size n, ForwardIterator result)
 {
+  THRUST_DETAIL_INSTRUMENT_N("thrust::uninitialized_copy_n", exec, n);
   using thrust::system::detail::generic::uninitialized_copy_n;
   return uninitialized_copy_n(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, n, result);
 } // end uninitialized_copy_n()
@@ -25,6 +25,7 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/adl/unique.h>
@@ -41,6 +42,7 @@ template <typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE ForwardIterator
 unique(const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::unique", exec, first, last);
   using thrust::system::detail::generic::unique;
   return unique(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end unique()
@@ -53,6 +55,7 @@ _CCCL_HOST_DEVICE ForwardIterator unique(
   ForwardIterator last,
   BinaryPredicate binary_pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::unique", exec, first, last);
   using thrust::system::detail::generic::unique;
   return unique(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, binary_pred);
 } // end unique()
@@ -65,6 +68,7 @@ _CCCL_HOST_DEVICE OutputIterator unique_copy(
   InputIterator last,
   OutputIterator output)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::unique_copy", exec, first, last);
   using thrust::system::detail::generic::unique_copy;
   return unique_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, output);
 } // end unique_copy()
@@ -78,6 +82,7 @@ _CCCL_HOST_DEVICE OutputIterator unique_copy(
   OutputIterator output,
   BinaryPredicate binary_pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::unique_copy", exec, first, last);
   using thrust::system::detail::generic::unique_copy;
   return unique_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, output, binary_pred);
 } // end unique_copy()
@@ -90,6 +95,7 @@ _CCCL_HOST_DEVICE thrust::pair<ForwardIterator1, ForwardIterator2> unique_by_key
   ForwardIterator1 keys_last,
   ForwardIterator2 values_first)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::unique_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::unique_by_key;
   return unique_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first);
@@ -104,6 +110,7 @@ _CCCL_HOST_DEVICE thrust::pair<ForwardIterator1, ForwardIterator2> unique_by_key
   ForwardIterator2 values_first,
   BinaryPredicate binary_pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::unique_by_key", exec, keys_first, keys_last);
   using thrust::system::detail::generic::unique_by_key;
   return unique_by_key(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, binary_pred);
@@ -123,6 +130,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> unique_by_key_c
   OutputIterator1 keys_output,
   OutputIterator2 values_output)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::unique_by_key_copy", exec, keys_first, keys_last);
   using thrust::system::detail::generic::unique_by_key_copy;
   return unique_by_key_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -149,6 +157,7 @@ _CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> unique_by_key_c
   OutputIterator2 values_output,
   BinaryPredicate binary_pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::unique_by_key_copy", exec, keys_first, keys_last);
   using thrust::system::detail::generic::unique_by_key_copy;
   return unique_by_key_copy(
     thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
@@ -309,6 +318,7 @@ _CCCL_HOST_DEVICE typename thrust::iterator_traits<ForwardIterator>::difference_
   ForwardIterator last,
   BinaryPredicate binary_pred)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::unique_count", exec, first, last);
   using thrust::system::detail::generic::unique_count;
   return unique_count(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, binary_pred);
 } // end unique_count()
@@ -318,6 +328,7 @@ template <typename DerivedPolicy, typename ForwardIterator>
 _CCCL_HOST_DEVICE typename thrust::iterator_traits<ForwardIterator>::difference_type unique_count(
   const thrust::detail::execution_policy_base<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last)
 {
+  THRUST_DETAIL_INSTRUMENT_RANGE("thrust::unique_count", exec, first, last);
   using thrust::system::detail::generic::unique_count;
   return unique_count(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
 } // end unique_count()
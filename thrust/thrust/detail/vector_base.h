@@ -32,6 +32,7 @@
 #endif // no system header
 
 #include <thrust/detail/contiguous_storage.h>
+#include <thrust/detail/no_init.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/iterator/detail/normal_iterator.h>
 #include <thrust/iterator/iterator_traits.h>
@@ -88,6 +89,21 @@ public:
    */
   explicit vector_base(size_type n, const Alloc& alloc);
 
+  /*! This constructor creates a vector_base with default-initialized
+   *  elements, i.e. trivially default constructible elements are left
+   *  uninitialized.
+   *  \param n The number of elements to create.
+   */
+  vector_base(size_type n, no_init_t);
+
+  /*! This constructor creates a vector_base with default-initialized
+   *  elements, i.e. trivially default constructible elements are left
+   *  uninitialized.
+   *  \param n The number of elements to create.
+   *  \param alloc The allocator to use by this vector_base.
+   */
+  vector_base(size_type n, no_init_t, const Alloc& alloc);
+
   /*! This constructor creates a vector_base with copies
    *  of an exemplar element.
    *  \param n The number of elements to initially create.
@@ -224,6 +240,18 @@ public:
    */
   void resize(size_type new_size, const value_type& x);
 
+  /*! \brief Resizes this vector_base to the specified number of elements.
+   *  \param new_size Number of elements this vector_base should contain.
+   *  \throw std::length_error If n exceeds max_size().
+   *
+   *  This method will resize this vector_base to the specified number of
+   *  elements. If the number is smaller than this vector_base's current
+   *  size this vector_base is truncated, otherwise this vector_base is
+   *  extended and new elements are default initialized, i.e. trivially
+   *  default constructible elements are left uninitialized.
+   */
+  void resize(size_type new_size, no_init_t);
+
   /*! Returns the number of elements in this vector_base.
    */
   _CCCL_HOST_DEVICE size_type size() const;
@@ -499,6 +527,8 @@ private:
 
   void value_init(size_type n);
 
+  void default_init(size_type n);
+
   void fill_init(size_type n, const T& x);
 
   // these methods resolve the ambiguity of the insert() template of form (iterator, InputIterator, InputIterator)
@@ -510,8 +540,9 @@ private:
   template <typename InputIteratorOrIntegralType>
   void insert_dispatch(iterator position, InputIteratorOrIntegralType n, InputIteratorOrIntegralType x, true_type);
 
-  // this method appends n value-initialized elements at the end
-  void append(size_type n);
+  // this method appends n value-initialized, or default-initialized if
+  // default_init is true, elements at the end
+  void append(size_type n, bool default_init = false);
 
   // this method performs insertion from a fill value
   void fill_insert(iterator position, size_type n, const T& x);
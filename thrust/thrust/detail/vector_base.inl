@@ -75,6 +75,22 @@ vector_base<T, Alloc>::vector_base(size_type n, const Alloc& alloc)
   value_init(n);
 } // end vector_base::vector_base()
 
+template <typename T, typename Alloc>
+vector_base<T, Alloc>::vector_base(size_type n, no_init_t)
+    : m_storage()
+    , m_size(0)
+{
+  default_init(n);
+} // end vector_base::vector_base()
+
+template <typename T, typename Alloc>
+vector_base<T, Alloc>::vector_base(size_type n, no_init_t, const Alloc& alloc)
+    : m_storage(alloc)
+    , m_size(0)
+{
+  default_init(n);
+} // end vector_base::vector_base()
+
 template <typename T, typename Alloc>
 vector_base<T, Alloc>::vector_base(size_type n, const value_type& value)
     : m_storage()
@@ -223,6 +239,18 @@ void vector_base<T, Alloc>::value_init(size_type n)
   } // end if
 } // end vector_base::value_init()
 
+template <typename T, typename Alloc>
+void vector_base<T, Alloc>::default_init(size_type n)
+{
+  if (n > 0)
+  {
+    m_storage.allocate(n);
+    m_size = n;
+
+    m_storage.default_initialize_n(begin(), size());
+  } // end if
+} // end vector_base::default_init()
+
 template <typename T, typename Alloc>
 void vector_base<T, Alloc>::fill_init(size_type n, const T& x)
 {
@@ -325,6 +353,21 @@ void vector_base<T, Alloc>::resize(size_type new_size, const value_type& x)
   } // end else
 } // end vector_base::resize()
 
+template <typename T, typename Alloc>
+void vector_base<T, Alloc>::resize(size_type new_size, no_init_t)
+{
+  if (new_size < size())
+  {
+    iterator new_end = begin();
+    thrust::advance(new_end, new_size);
+    erase(new_end, end());
+  } // end if
+  else
+  {
+    append(new_size - size(), true);
+  } // end else
+} // end vector_base::resize()
+
 template <typename T, typename Alloc>
 _CCCL_HOST_DEVICE typename vector_base<T, Alloc>::size_type vector_base<T, Alloc>::size() const
 {
@@ -783,7 +826,7 @@ void vector_base<T, Alloc>::copy_insert(iterator position, ForwardIterator first
 } // end vector_base::copy_insert()
 
 template <typename T, typename Alloc>
-void vector_base<T, Alloc>::append(size_type n)
+void vector_base<T, Alloc>::append(size_type n, bool default_init)
 {
   if (n != 0)
   {
@@ -792,7 +835,14 @@ void vector_base<T, Alloc>::append(size_type n)
       // we've got room for all of them
 
       // default construct new elements at the end of the vector
-      m_storage.value_initialize_n(end(), n);
+      if (default_init)
+      {
+        m_storage.default_initialize_n(end(), n);
+      }
+      else
+      {
+        m_storage.value_initialize_n(end(), n);
+      }
 
       // extend the size
       m_size += n;
@@ -822,7 +872,14 @@ void vector_base<T, Alloc>::append(size_type n)
         new_end = m_storage.uninitialized_copy(begin(), end(), new_storage.begin());
 
         // construct new elements to insert
-        new_storage.value_initialize_n(new_end, n);
+        if (default_init)
+        {
+          new_storage.default_initialize_n(new_end, n);
+        }
+        else
+        {
+          new_storage.value_initialize_n(new_end, n);
+        }
         new_end += n;
       } // end try
       catch (...)
@@ -105,6 +105,25 @@ public:
       : Parent(n, alloc)
   {}
 
+  /*! This constructor creates a \p device_vector with the given
+   *  size whose elements are default-initialized, i.e. trivially default
+   *  constructible elements are left uninitialized.
+   *  \param n The number of elements to initially create.
+   */
+  device_vector(size_type n, no_init_t)
+      : Parent(n, no_init)
+  {}
+
+  /*! This constructor creates a \p device_vector with the given
+   *  size whose elements are default-initialized, i.e. trivially default
+   *  constructible elements are left uninitialized.
+   *  \param n The number of elements to initially create.
+   *  \param alloc The allocator to use by this device_vector.
+   */
+  device_vector(size_type n, no_init_t, const Alloc& alloc)
+      : Parent(n, no_init, alloc)
+  {}
+
   /*! This constructor creates a \p device_vector with copies
    *  of an exemplar element.
    *  \param n The number of elements to initially create.
@@ -286,6 +305,18 @@ public:
      */
     void resize(size_type new_size, const value_type &x = value_type());
 
+    /*! \brief Resizes this vector to the specified number of elements.
+     *  \param new_size Number of elements this vector should contain.
+     *  \throw std::length_error If n exceeds max_size().
+     *
+     *  This method will resize this vector to the specified number of
+     *  elements.  If the number is smaller than this vector's current
+     *  size this vector is truncated, otherwise this vector is
+     *  extended and new elements are default-initialized, i.e. trivially
+     *  default constructible elements are left uninitialized.
+     */
+    void resize(size_type new_size, no_init_t);
+
     /*! Returns the number of elements in this vector.
      */
     size_type size() const;
@@ -0,0 +1,286 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file histogram.h
+ *  \brief Counting the elements of a range falling into each of a set of bins
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup algorithms
+ */
+
+/*! \addtogroup reductions
+ *  \ingroup algorithms
+ *  \{
+ */
+
+/*! \addtogroup counting
+ *  \ingroup reductions
+ *  \{
+ */
+
+/*! \p histogram_even counts the samples in <tt>[first, last)</tt> falling into
+ *  each of <tt>num_levels - 1</tt> bins of equal width, which together cover
+ *  <tt>[lower_level, upper_level)</tt>. Bin \c b holds the samples \c x with
+ *  <tt>lower_level + b * w <= x < lower_level + (b + 1) * w</tt>, where \c w is the
+ *  width of a bin. Samples outside of <tt>[lower_level, upper_level)</tt> are
+ *  ignored. The count of bin \c b is written to <tt>histogram[b]</tt>.
+ *
+ *  Samples are converted to \p Level before they are placed. For integral levels
+ *  the bin of a sample is
+ *  <tt>(x - lower_level) * (num_levels - 1) / (upper_level - lower_level)</tt>,
+ *  as in <tt>cub::DeviceHistogram::HistogramEven</tt>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the samples.
+ *  \param last The end of the samples.
+ *  \param histogram The beginning of the <tt>num_levels - 1</tt> counts.
+ *  \param num_levels The number of bin boundaries, one more than the number of bins.
+ *  \param lower_level The lower bound, inclusive, of the first bin.
+ *  \param upper_level The upper bound, exclusive, of the last bin.
+ *  \return <tt>histogram + (num_levels - 1)</tt>
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is convertible to \p Level. \tparam OutputIterator is a mutable <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> whose \c
+ * value_type is an arithmetic type. \tparam Level is an arithmetic type.
+ *
+ *  \pre <tt>lower_level < upper_level</tt>.
+ *  \pre The range <tt>[histogram, histogram + num_levels - 1)</tt> shall not overlap <tt>[first, last)</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_even to count
+ *  samples into four bins covering <tt>[0, 8)</tt> using the \p thrust::host
+ *  execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  int samples[7] = {0, 1, 2, 3, 5, 7, 9};
+ *  int counts[4];
+ *
+ *  thrust::histogram_even(thrust::host, samples, samples + 7, counts, 5, 0, 8);
+ *
+ *  // counts is now {2, 2, 1, 1}
+ *  \endcode
+ *
+ *  \see histogram_range
+ *  \see https://nvidia.github.io/cccl/cub/api/structcub_1_1DeviceHistogram.html
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator, typename Level>
+_CCCL_HOST_DEVICE OutputIterator histogram_even(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  Level lower_level,
+  Level upper_level);
+
+/*! \p histogram_even counts the samples in <tt>[first, last)</tt> falling into
+ *  each of <tt>num_levels - 1</tt> bins of equal width, which together cover
+ *  <tt>[lower_level, upper_level)</tt>. Bin \c b holds the samples \c x with
+ *  <tt>lower_level + b * w <= x < lower_level + (b + 1) * w</tt>, where \c w is the
+ *  width of a bin. Samples outside of <tt>[lower_level, upper_level)</tt> are
+ *  ignored. The count of bin \c b is written to <tt>histogram[b]</tt>.
+ *
+ *  Samples are converted to \p Level before they are placed. For integral levels
+ *  the bin of a sample is
+ *  <tt>(x - lower_level) * (num_levels - 1) / (upper_level - lower_level)</tt>,
+ *  as in <tt>cub::DeviceHistogram::HistogramEven</tt>.
+ *
+ *  \param first The beginning of the samples.
+ *  \param last The end of the samples.
+ *  \param histogram The beginning of the <tt>num_levels - 1</tt> counts.
+ *  \param num_levels The number of bin boundaries, one more than the number of bins.
+ *  \param lower_level The lower bound, inclusive, of the first bin.
+ *  \param upper_level The upper bound, exclusive, of the last bin.
+ *  \return <tt>histogram + (num_levels - 1)</tt>
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is convertible to \p Level. \tparam OutputIterator is a mutable <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> whose \c
+ * value_type is an arithmetic type. \tparam Level is an arithmetic type.
+ *
+ *  \pre <tt>lower_level < upper_level</tt>.
+ *  \pre The range <tt>[histogram, histogram + num_levels - 1)</tt> shall not overlap <tt>[first, last)</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_even to count
+ *  samples into four bins covering <tt>[0, 8)</tt>:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/device_vector.h>
+ *  ...
+ *  int samples[7] = {0, 1, 2, 3, 5, 7, 9};
+ *  thrust::device_vector<int> d_samples(samples, samples + 7);
+ *  thrust::device_vector<int> d_counts(4);
+ *
+ *  thrust::histogram_even(d_samples.begin(), d_samples.end(), d_counts.begin(), 5, 0, 8);
+ *
+ *  // d_counts is now {2, 2, 1, 1}
+ *  \endcode
+ *
+ *  \see histogram_range
+ */
+template <typename RandomAccessIterator, typename OutputIterator, typename Level>
+OutputIterator histogram_even(
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  Level lower_level,
+  Level upper_level);
+
+/*! \p histogram_range counts the samples in <tt>[first, last)</tt> falling into
+ *  each of the bins delimited by the increasing levels in
+ *  <tt>[levels_first, levels_last)</tt>. Bin \c b holds the samples \c x with
+ *  <tt>levels_first[b] <= x < levels_first[b + 1]</tt>. Samples outside of
+ *  <tt>[*levels_first, *(levels_last - 1))</tt> are ignored. The count of bin \c b
+ *  is written to <tt>histogram[b]</tt>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the samples.
+ *  \param last The end of the samples.
+ *  \param levels_first The beginning of the bin boundaries.
+ *  \param levels_last The end of the bin boundaries.
+ *  \param histogram The beginning of the <tt>(levels_last - levels_first) - 1</tt> counts.
+ *  \return <tt>histogram + (levels_last - levels_first) - 1</tt>
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a> with
+ * \c RandomAccessIterator2's \c value_type. \tparam RandomAccessIterator2 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>. \tparam
+ * OutputIterator is a mutable <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access
+ * Iterator</a> whose \c value_type is an arithmetic type.
+ *
+ *  \pre <tt>[levels_first, levels_last)</tt> shall be sorted in strictly increasing order.
+ *  \pre The range of counts shall not overlap <tt>[first, last)</tt> or <tt>[levels_first, levels_last)</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_range to count
+ *  samples into bins of different widths using the \p thrust::host execution
+ *  policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  float samples[6] = {0.5f, 1.5f, 2.5f, 4.0f, 9.0f, 12.0f};
+ *  float levels[4]  = {0.0f, 1.0f, 4.0f, 10.0f};
+ *  int counts[3];
+ *
+ *  thrust::histogram_range(thrust::host, samples, samples + 6, levels, levels + 4, counts);
+ *
+ *  // counts is now {1, 2, 2}
+ *  \endcode
+ *
+ *  \see histogram_even
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator histogram_range(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 levels_first,
+  RandomAccessIterator2 levels_last,
+  OutputIterator histogram);
+
+/*! \p histogram_range counts the samples in <tt>[first, last)</tt> falling into
+ *  each of the bins delimited by the increasing levels in
+ *  <tt>[levels_first, levels_last)</tt>. Bin \c b holds the samples \c x with
+ *  <tt>levels_first[b] <= x < levels_first[b + 1]</tt>. Samples outside of
+ *  <tt>[*levels_first, *(levels_last - 1))</tt> are ignored. The count of bin \c b
+ *  is written to <tt>histogram[b]</tt>.
+ *
+ *  \param first The beginning of the samples.
+ *  \param last The end of the samples.
+ *  \param levels_first The beginning of the bin boundaries.
+ *  \param levels_last The end of the bin boundaries.
+ *  \param histogram The beginning of the <tt>(levels_last - levels_first) - 1</tt> counts.
+ *  \return <tt>histogram + (levels_last - levels_first) - 1</tt>
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and its \c
+ * value_type is <a href="https://en.cppreference.com/w/cpp/named_req/LessThanComparable">LessThan Comparable</a> with
+ * \c RandomAccessIterator2's \c value_type. \tparam RandomAccessIterator2 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>. \tparam
+ * OutputIterator is a mutable <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access
+ * Iterator</a> whose \c value_type is an arithmetic type.
+ *
+ *  \pre <tt>[levels_first, levels_last)</tt> shall be sorted in strictly increasing order.
+ *  \pre The range of counts shall not overlap <tt>[first, last)</tt> or <tt>[levels_first, levels_last)</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_range to count
+ *  samples into bins of different widths:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/device_vector.h>
+ *  ...
+ *  float samples[6] = {0.5f, 1.5f, 2.5f, 4.0f, 9.0f, 12.0f};
+ *  float levels[4]  = {0.0f, 1.0f, 4.0f, 10.0f};
+ *  thrust::device_vector<float> d_samples(samples, samples + 6);
+ *  thrust::device_vector<float> d_levels(levels, levels + 4);
+ *  thrust::device_vector<int> d_counts(3);
+ *
+ *  thrust::histogram_range(d_samples.begin(), d_samples.end(), d_levels.begin(), d_levels.end(), d_counts.begin());
+ *
+ *  // d_counts is now {1, 2, 2}
+ *  \endcode
+ *
+ *  \see histogram_even
+ */
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename OutputIterator>
+OutputIterator histogram_range(
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 levels_first,
+  RandomAccessIterator2 levels_last,
+  OutputIterator histogram);
+
+/*! \} // end counting
+ *  \} // end reductions
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/histogram.inl>
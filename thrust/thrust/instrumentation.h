@@ -0,0 +1,182 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file instrumentation.h
+ *  \brief Observing the algorithms Thrust runs on the host
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+// The hook is shared by the instrumented translation units of a program and
+// the others, so this header stays out of the namespace the former put the
+// rest of Thrust in. It must not declare namespaces the rest of Thrust has.
+THRUST_NS_PREFIX
+namespace thrust
+{
+THRUST_DETAIL_ABI_NS_BEGIN
+
+/*! \addtogroup utility
+ *  \{
+ */
+
+/*! \addtogroup instrumentation Instrumentation
+ *  \ingroup utility
+ *
+ *  Translation units compiled with \c THRUST_ENABLE_INSTRUMENTATION defined
+ *  report every algorithm they invoke from the host, whichever system it runs
+ *  on. Each algorithm is wrapped in an NVTX range in the \c CCCL domain, named
+ *  after the algorithm and the number of elements, when the NVTX headers are
+ *  available and \c NVTX_DISABLE is not defined. Once it returns, the hook
+ *  installed with \p set_algorithm_hook, if any, is called with an
+ *  \p algorithm_event describing it.
+ *
+ *  Without \c THRUST_ENABLE_INSTRUMENTATION, the algorithms contain no
+ *  instrumentation at all.
+ *
+ *  \c THRUST_ENABLE_INSTRUMENTATION must be defined before the first Thrust
+ *  header is included. Thrust is then placed in an inline namespace of its
+ *  own, so the instrumented and uninstrumented copies of its functions never
+ *  collide. Functions which take or return Thrust types, such as
+ *  \p thrust::host_vector, therefore fail to link when they are defined in a
+ *  translation unit with a different setting than their callers. The hook and
+ *  \p algorithm_event are the same in every translation unit.
+ *  \{
+ */
+
+/*! \p algorithm_event describes an algorithm which has returned.
+ */
+struct algorithm_event
+{
+  /*! The name of the algorithm, such as <tt>"thrust::sort"</tt>.
+   */
+  const char* algorithm;
+
+  /*! The system the algorithm ran on: <tt>"cpp"</tt>, <tt>"omp"</tt>,
+   *  <tt>"tbb"</tt>, <tt>"cuda"</tt>, <tt>"seq"</tt> for \p thrust::seq, or
+   *  <tt>"unknown"</tt> for systems Thrust does not provide.
+   */
+  const char* system;
+
+  /*! The number of elements of the algorithm's input, or \c 0 if its
+   *  iterators are not random access.
+   */
+  std::size_t size;
+
+  /*! The time the algorithm took, as measured on the host.
+   */
+  std::chrono::nanoseconds elapsed;
+
+  /*! The number of bytes of temporary storage the algorithm, and those it
+   *  called, obtained.
+   */
+  std::size_t temporary_bytes;
+
+  /*! The largest number of host threads the algorithm ran on at once, or \c 0
+   *  if it ran on a device.
+   */
+  int threads;
+
+  /*! The number of instrumented algorithms the algorithm was called from on
+   *  the same thread. Algorithms the user called directly have a depth of
+   *  \c 0; an algorithm calling one of the same name is reported only once.
+   */
+  int depth;
+};
+
+/*! \p algorithm_hook is the type of the functions which may be installed with
+ *  \p set_algorithm_hook.
+ */
+using algorithm_hook = void (*)(const algorithm_event&);
+
+namespace instrumentation_detail
+{
+
+inline std::atomic<algorithm_hook>& algorithm_hook_storage()
+{
+  static std::atomic<algorithm_hook> hook(nullptr);
+  return hook;
+}
+
+} // namespace instrumentation_detail
+
+/*! \p set_algorithm_hook installs the function called whenever an
+ *  instrumented algorithm returns. The hook is called on the thread which
+ *  invoked the algorithm, and may be called from several threads at once.
+ *
+ *  \param hook The function to call, or \c nullptr to stop calling one.
+ *  \return The hook installed previously.
+ *
+ *  The following code snippet demonstrates how to use \p set_algorithm_hook to
+ *  print the algorithms a program runs.
+ *
+ *  \code
+ *  #define THRUST_ENABLE_INSTRUMENTATION
+ *  #include <thrust/instrumentation.h>
+ *  #include <thrust/sort.h>
+ *  #include <thrust/host_vector.h>
+ *  #include <cstdio>
+ *
+ *  void print(const thrust::algorithm_event& e)
+ *  {
+ *    std::printf("%s on %s: %zu elements in %lld ns\n",
+ *                e.algorithm, e.system, e.size, static_cast<long long>(e.elapsed.count()));
+ *  }
+ *  ...
+ *  thrust::set_algorithm_hook(print);
+ *
+ *  thrust::host_vector<int> v(1000);
+ *  thrust::sort(v.begin(), v.end());
+ *  // prints thrust::sort on cpp: 1000 elements in ... ns
+ *  \endcode
+ */
+inline algorithm_hook set_algorithm_hook(algorithm_hook hook)
+{
+  return instrumentation_detail::algorithm_hook_storage().exchange(hook);
+}
+
+/*! \p get_algorithm_hook returns the function installed with
+ *  \p set_algorithm_hook.
+ *
+ *  \return The hook, or \c nullptr if there is none.
+ */
+inline algorithm_hook get_algorithm_hook()
+{
+  return instrumentation_detail::algorithm_hook_storage().load(std::memory_order_acquire);
+}
+
+/*! \} // end instrumentation
+ */
+
+/*! \} // end utility
+ */
+
+THRUST_DETAIL_ABI_NS_END
+} // namespace thrust
+THRUST_NS_POSTFIX
@@ -33,17 +33,24 @@
 
 #include <thrust/detail/config.h>
 
-#include <thrust/binary_search.h>
 #include <thrust/detail/algorithm_wrapper.h>
-#include <thrust/detail/seq.h>
+#include <thrust/detail/integer_math.h>
 #include <thrust/host_vector.h>
 #include <thrust/mr/allocator.h>
 #include <thrust/mr/memory_resource.h>
 #include <thrust/mr/pool_options.h>
 
 #include <cassert>
+#include <cstdint>
+#include <limits>
 
 THRUST_NAMESPACE_BEGIN
+
+// temporary_array includes this header for the host systems' temporary buffer cache, which may happen while
+// host_vector.h is still being read
+template <typename T, typename Alloc>
+class host_vector;
+
 namespace mr
 {
 
@@ -122,14 +129,19 @@ public:
       , m_smallest_block_log2(detail::log2_ri(m_options.smallest_block_size))
       , m_pools(m_bookkeeper)
       , m_allocated(m_bookkeeper)
-      , m_cached_oversized(m_bookkeeper)
       , m_oversized(m_bookkeeper)
+      , m_oversized_count(0)
+      , m_cached_oversized(m_bookkeeper)
+      , m_cached_bytes(0)
   {
     assert(m_options.validate());
 
     pointer_vector free(m_bookkeeper);
     pool p(free);
     m_pools.resize(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+
+    oversized_block_vector bin(m_bookkeeper);
+    m_cached_oversized.resize(4 * std::numeric_limits<std::size_t>::digits, bin);
   }
 
   // TODO: C++11: use delegating constructors
@@ -145,14 +157,19 @@ public:
       , m_smallest_block_log2(detail::log2_ri(m_options.smallest_block_size))
       , m_pools(m_bookkeeper)
       , m_allocated(m_bookkeeper)
-      , m_cached_oversized(m_bookkeeper)
       , m_oversized(m_bookkeeper)
+      , m_oversized_count(0)
+      , m_cached_oversized(m_bookkeeper)
+      , m_cached_bytes(0)
   {
     assert(m_options.validate());
 
     pointer_vector free(m_bookkeeper);
     pool p(free);
     m_pools.resize(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+
+    oversized_block_vector bin(m_bookkeeper);
+    m_cached_oversized.resize(4 * std::numeric_limits<std::size_t>::digits, bin);
   }
 
   /*! Destructor. Releases all held memory to upstream.
@@ -174,58 +191,20 @@ private:
 
   using chunk_vector = thrust::host_vector<chunk_descriptor, allocator<chunk_descriptor, Bookkeeper>>;
 
+  // a size of zero marks an empty slot of the oversized block table
   struct oversized_block_descriptor
   {
     std::size_t size;
     std::size_t alignment;
     void_ptr pointer;
-
-    _CCCL_HOST_DEVICE bool operator==(const oversized_block_descriptor& other) const
-    {
-      return size == other.size && alignment == other.alignment && pointer == other.pointer;
-    }
-
-    _CCCL_HOST_DEVICE bool operator<(const oversized_block_descriptor& other) const
-    {
-      return size < other.size || (size == other.size && alignment < other.alignment);
-    }
-  };
-
-  struct equal_pointers
-  {
-  public:
-    _CCCL_HOST_DEVICE equal_pointers(void_ptr p)
-        : p(p)
-    {}
-
-    _CCCL_HOST_DEVICE bool operator()(const oversized_block_descriptor& desc) const
-    {
-      return desc.pointer == p;
-    }
-
-  private:
-    void_ptr p;
-  };
-
-  struct matching_alignment
-  {
-  public:
-    _CCCL_HOST_DEVICE matching_alignment(std::size_t requested)
-        : requested(requested)
-    {}
-
-    _CCCL_HOST_DEVICE bool operator()(const oversized_block_descriptor& desc) const
-    {
-      return desc.alignment >= requested;
-    }
-
-  private:
-    std::size_t requested;
   };
 
   using oversized_block_vector =
     thrust::host_vector<oversized_block_descriptor, allocator<oversized_block_descriptor, Bookkeeper>>;
 
+  using oversized_bin_vector =
+    thrust::host_vector<oversized_block_vector, allocator<oversized_block_vector, Bookkeeper>>;
+
   using pointer_vector = thrust::host_vector<void_ptr, allocator<void_ptr, Bookkeeper>>;
 
   struct pool
@@ -260,10 +239,96 @@ private:
   pool_vector m_pools;
   // list of all allocations from upstream for the above
   chunk_vector m_allocated;
-  // list of all cached oversized/overaligned blocks that have been returned to the pool to cache
-  oversized_block_vector m_cached_oversized;
-  // list of all oversized/overaligned allocations from upstream
+  // all oversized/overaligned allocations from upstream, in an open addressing hash table keyed by their pointers
   oversized_block_vector m_oversized;
+  std::size_t m_oversized_count;
+  // cached oversized/overaligned blocks that have been returned to the pool, binned by their size
+  oversized_bin_vector m_cached_oversized;
+  std::size_t m_cached_bytes;
+
+  // there are four bins per power of two, told apart by the two bits following the leading one of the size
+  static std::size_t cached_bin(std::size_t size)
+  {
+    const std::size_t size_log2 = detail::log2(size);
+    return size_log2 < 2 ? 4 * size_log2 : 4 * size_log2 + ((size >> (size_log2 - 2)) & 3);
+  }
+
+  // the smallest size that falls into the given bin
+  static std::size_t cached_bin_floor(std::size_t bin)
+  {
+    const std::size_t size_log2 = bin / 4;
+    return size_log2 < 2 ? static_cast<std::size_t>(1) << size_log2 : (4 + bin % 4) << (size_log2 - 2);
+  }
+
+  // the home slot of p in the oversized block table; Fibonacci hashing spreads the regularly spaced addresses of
+  // aligned blocks over the whole table
+  std::size_t oversized_home(void_ptr p) const
+  {
+    const std::uint64_t address =
+      static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(detail::pointer_traits<void_ptr>::get(p)));
+    const std::size_t log2_capacity = detail::log2(m_oversized.size());
+
+    return static_cast<std::size_t>((address * 0x9E3779B97F4A7C15ull) >> (64 - log2_capacity));
+  }
+
+  // the slot holding the descriptor of p, or the empty slot where it belongs
+  std::size_t find_oversized(void_ptr p) const
+  {
+    const std::size_t mask = m_oversized.size() - 1;
+
+    std::size_t slot = oversized_home(p);
+    while (m_oversized[slot].size != 0 && !(m_oversized[slot].pointer == p))
+    {
+      slot = (slot + 1) & mask;
+    }
+
+    return slot;
+  }
+
+  void insert_oversized(const oversized_block_descriptor& oversized)
+  {
+    // keep the table at most half full, so that probe sequences stay short
+    if (2 * (m_oversized_count + 1) > m_oversized.size())
+    {
+      oversized_block_vector old(m_bookkeeper);
+      old.swap(m_oversized);
+
+      oversized_block_descriptor empty = oversized_block_descriptor();
+      m_oversized.resize(old.empty() ? 16 : 2 * old.size(), empty);
+
+      for (std::size_t i = 0; i < old.size(); ++i)
+      {
+        if (old[i].size != 0)
+        {
+          m_oversized[find_oversized(old[i].pointer)] = old[i];
+        }
+      }
+    }
+
+    m_oversized[find_oversized(oversized.pointer)] = oversized;
+    ++m_oversized_count;
+  }
+
+  void erase_oversized(std::size_t slot)
+  {
+    const std::size_t mask = m_oversized.size() - 1;
+
+    // shift back the following descriptors of the probe sequence, instead of leaving a tombstone behind
+    std::size_t hole = slot;
+    for (std::size_t next = (hole + 1) & mask; m_oversized[next].size != 0; next = (next + 1) & mask)
+    {
+      // the descriptor may fill the hole unless its home slot lies after the hole
+      const std::size_t home = oversized_home(m_oversized[next].pointer);
+      if (((next - home) & mask) >= ((next - hole) & mask))
+      {
+        m_oversized[hole] = m_oversized[next];
+        hole              = next;
+      }
+    }
+
+    m_oversized[hole] = oversized_block_descriptor();
+    --m_oversized_count;
+  }
 
 public:
   /*! Releases all held memory to upstream.
@@ -286,12 +351,51 @@ public:
     // deallocate cached oversized/overaligned memory
     for (std::size_t i = 0; i < m_oversized.size(); ++i)
     {
-      m_upstream->do_deallocate(m_oversized[i].pointer, m_oversized[i].size, m_oversized[i].alignment);
+      if (m_oversized[i].size != 0)
+      {
+        m_upstream->do_deallocate(m_oversized[i].pointer, m_oversized[i].size, m_oversized[i].alignment);
+      }
+    }
+
+    for (std::size_t i = 0; i < m_cached_oversized.size(); ++i)
+    {
+      m_cached_oversized[i].clear();
     }
 
     m_allocated.clear();
     m_oversized.clear();
-    m_cached_oversized.clear();
+    m_oversized_count = 0;
+    m_cached_bytes    = 0;
+  }
+
+  /*! Returns cached oversized and overaligned blocks to upstream, the largest first, until at most \p max_bytes of
+   *      them remain cached. Blocks in use and the chunks of the internal pools are left alone.
+   *
+   *  \param max_bytes the number of bytes of cached blocks to keep
+   */
+  void trim(std::size_t max_bytes)
+  {
+    for (std::size_t bin = m_cached_oversized.size(); bin-- > 0 && m_cached_bytes > max_bytes;)
+    {
+      oversized_block_vector& cached = m_cached_oversized[bin];
+
+      while (!cached.empty() && m_cached_bytes > max_bytes)
+      {
+        const oversized_block_descriptor desc = cached.back();
+        cached.pop_back();
+        m_cached_bytes -= desc.size;
+
+        erase_oversized(find_oversized(desc.pointer));
+        m_upstream->do_deallocate(desc.pointer, desc.size, desc.alignment);
+      }
+    }
+  }
+
+  /*! \return the number of bytes of oversized and overaligned blocks currently cached.
+   */
+  std::size_t cached_bytes() const
+  {
+    return m_cached_bytes;
   }
 
   _CCCL_NODISCARD virtual void_ptr
@@ -307,51 +411,43 @@ public:
       oversized.size      = bytes;
       oversized.alignment = alignment;
 
-      if (m_options.cache_oversized && !m_cached_oversized.empty())
+      if (m_options.cache_oversized && m_cached_bytes != 0)
       {
-        typename oversized_block_vector::iterator it =
-          thrust::lower_bound(thrust::seq, m_cached_oversized.begin(), m_cached_oversized.end(), oversized);
-
-        // if the size is bigger than the requested size by a factor
-        // bigger than or equal to the specified cutoff for size,
-        // allocate a new block
-        if (it != m_cached_oversized.end())
+        // only the first bin may hold blocks that are too small, and the blocks of a bin are smaller than those of the
+        // following ones, so the first bin with a fitting block has a good fit
+        for (std::size_t bin = cached_bin(bytes); bin < m_cached_oversized.size(); ++bin)
         {
-          std::size_t size_factor = (*it).size / bytes;
-          if (size_factor >= m_options.cached_size_cutoff_factor)
+          // if even the smallest size of this bin is bigger than the requested size by a factor
+          // bigger than or equal to the specified cutoff for size, allocate a new block
+          if (cached_bin_floor(bin) / bytes >= m_options.cached_size_cutoff_factor)
           {
-            it = m_cached_oversized.end();
+            break;
           }
-        }
 
-        if (it != m_cached_oversized.end() && (*it).alignment < alignment)
-        {
-          it = find_if(it + 1, m_cached_oversized.end(), matching_alignment(alignment));
-        }
+          oversized_block_vector& cached = m_cached_oversized[bin];
 
-        // if the alignment is bigger than the requested one by a factor
-        // bigger than or equal to the specified cutoff for alignment,
-        // allocate a new block
-        if (it != m_cached_oversized.end())
-        {
-          std::size_t alignment_factor = (*it).alignment / alignment;
-          if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
+          // prefer the most recently cached blocks, which are the cheapest to take out of the bin
+          for (std::size_t i = cached.size(); i-- > 0;)
           {
-            it = m_cached_oversized.end();
+            const oversized_block_descriptor desc = cached[i];
+
+            if (desc.size < bytes || desc.size / bytes >= m_options.cached_size_cutoff_factor
+                || desc.alignment < alignment || desc.alignment / alignment >= m_options.cached_alignment_cutoff_factor)
+            {
+              continue;
+            }
+
+            m_cached_bytes -= desc.size;
+            cached[i] = cached.back();
+            cached.pop_back();
+            return desc.pointer;
           }
         }
-
-        if (it != m_cached_oversized.end())
-        {
-          oversized.pointer = (*it).pointer;
-          m_cached_oversized.erase(it);
-          return oversized.pointer;
-        }
       }
 
       // no fitting cached block found; allocate a new one that's just up to the specs
       oversized.pointer = m_upstream->do_allocate(bytes, alignment);
-      m_oversized.push_back(oversized);
+      insert_oversized(oversized);
 
       return oversized.pointer;
     }
@@ -403,6 +499,7 @@ public:
       m_allocated.push_back(allocated);
       bucket.previous_allocated_count = n;
 
+      bucket.free_blocks.reserve(n);
       for (std::size_t i = 0; i < n; ++i)
       {
         bucket.free_blocks.push_back(static_cast<void_ptr>(static_cast<char_ptr>(allocated.pointer) + i * bucket_size));
@@ -426,20 +523,20 @@ public:
     // the deallocated block is oversized and/or overaligned
     if (n > m_options.largest_block_size || alignment > m_options.alignment)
     {
-      typename oversized_block_vector::iterator it = find_if(m_oversized.begin(), m_oversized.end(), equal_pointers(p));
-      assert(it != m_oversized.end());
+      const std::size_t slot = find_oversized(p);
+      assert(m_oversized[slot].size != 0);
 
-      oversized_block_descriptor oversized = *it;
+      oversized_block_descriptor oversized = m_oversized[slot];
 
-      if (m_options.cache_oversized)
+      // cache the block, unless that would grow the cache beyond its limit
+      if (m_options.cache_oversized && oversized.size <= m_options.max_cached_bytes - m_cached_bytes)
       {
-        typename oversized_block_vector::iterator position =
-          lower_bound(m_cached_oversized.begin(), m_cached_oversized.end(), oversized);
-        m_cached_oversized.insert(position, oversized);
+        m_cached_oversized[cached_bin(oversized.size)].push_back(oversized);
+        m_cached_bytes += oversized.size;
         return;
       }
 
-      m_oversized.erase(it);
+      erase_oversized(slot);
 
       m_upstream->do_deallocate(p, oversized.size, oversized.alignment);
 
@@ -93,6 +93,14 @@ public:
     upstream_pool.release();
   }
 
+  /*! Returns cached oversized and overaligned blocks to upstream until at most \p max_bytes of them remain cached.
+   */
+  void trim(std::size_t max_bytes)
+  {
+    lock_t lock(mtx);
+    upstream_pool.trim(max_bytes);
+  }
+
   _CCCL_NODISCARD virtual void_ptr
   do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
   {
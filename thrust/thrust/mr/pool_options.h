@@ -35,6 +35,7 @@
 #include <thrust/detail/integer_math.h>
 
 #include <cstddef>
+#include <limits>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -98,6 +99,11 @@ struct pool_options
    */
   std::size_t cached_alignment_cutoff_factor;
 
+  /*! The maximal number of bytes of oversized and overaligned blocks that the disjoint pool resources keep cached. A
+   *      block deallocated while the cache is full is returned to the upstream resource instead. Unlimited by default.
+   */
+  std::size_t max_cached_bytes = (std::numeric_limits<std::size_t>::max)();
+
   /*! Checks if the options are self-consistent.
    *
    *  /returns true if the options are self-consitent, false otherwise.
@@ -0,0 +1,478 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A thread-safe pooling memory resource adaptor which keeps per-thread
+ *  caches of free blocks in front of shared free lists.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/mr/pool.h>
+
+#include <atomic>
+#include <cassert>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A thread-safe pooling memory resource adaptor, meant for workloads in which many threads allocate concurrently, and
+ *      in which memory is often freed by a different thread than the one that allocated it.
+ *
+ *  Unlike \p synchronized_pool_resource, which serializes every request on a single mutex, this resource gives every
+ *      thread a shard: a small cache of free blocks of every size, which it allocates from and deallocates to without
+ *      contending with other threads. Behind the shards sit shared free lists, one per block size, which only ever
+ *      exchange whole batches of blocks with the shards: a shard that runs dry takes a batch, and a shard that caches
+ *      too many blocks hands a batch back. Blocks are not owned by any shard, so memory freed by another thread is
+ *      simply cached by that thread, and flows back to the shared lists once it accumulates. Only allocating new chunks
+ *      from upstream, and serving oversized and overaligned requests, takes a mutex.
+ *
+ *  Threads are assigned to shards round-robin; there are as many shards as there are hardware threads, so more threads
+ *      than that will share shards.
+ *
+ *  Like \p unsynchronized_pool_resource, this resource keeps its bookkeeping inside the blocks it allocates, and so
+ *      requires that memory allocated from \p Upstream is accessible from the host.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory blocks
+ */
+template <typename Upstream>
+class sharded_pool_resource final : public memory_resource<typename Upstream::pointer>
+{
+  using oversized_pool = unsynchronized_pool_resource<Upstream>;
+  using lock_t         = std::lock_guard<std::mutex>;
+
+public:
+  /*! Get the default options for a pool. These are meant to be a sensible set of values for many use cases,
+   *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
+   *      just a slight departure from the defaults is easy.
+   */
+  static pool_options get_default_options()
+  {
+    return oversized_pool::get_default_options();
+  }
+
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource for allocations
+   *  \param options pool options to use
+   */
+  sharded_pool_resource(Upstream* upstream, pool_options options = get_default_options())
+      : m_upstream(upstream)
+      , m_options(options)
+      , m_smallest_block_log2(detail::log2_ri(m_options.smallest_block_size))
+      , m_num_buckets(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1)
+      , m_buckets(m_num_buckets)
+      , m_shards((std::max)(std::thread::hardware_concurrency(), 1u))
+      , m_allocated()
+      , m_oversized(upstream, options)
+  {
+    assert(m_options.validate());
+
+    for (shard& s : m_shards)
+    {
+      s.lists.resize(m_num_buckets);
+    }
+  }
+
+  /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+   *
+   *  \param options pool options to use
+   */
+  sharded_pool_resource(pool_options options = get_default_options())
+      : sharded_pool_resource(get_global_resource<Upstream>(), options)
+  {}
+
+  /*! Destructor. Releases all held memory to upstream.
+   */
+  ~sharded_pool_resource()
+  {
+    release();
+  }
+
+private:
+  using void_ptr        = typename Upstream::pointer;
+  using void_ptr_traits = thrust::detail::pointer_traits<void_ptr>;
+  using char_ptr        = typename void_ptr_traits::template rebind<char>::other;
+
+  struct block_descriptor;
+  struct chunk_descriptor;
+
+  using block_descriptor_ptr = typename void_ptr_traits::template rebind<block_descriptor>::other;
+  using chunk_descriptor_ptr = typename void_ptr_traits::template rebind<chunk_descriptor>::other;
+
+  // stored right after the memory handed out to the user; next_batch is only
+  // meaningful for the first block of a batch in a shared free list
+  struct block_descriptor
+  {
+    block_descriptor_ptr next;
+    block_descriptor_ptr next_batch;
+  };
+
+  struct chunk_descriptor
+  {
+    std::size_t size;
+    chunk_descriptor_ptr next;
+  };
+
+  // guards the short critical sections on the shards and the shared lists,
+  // which only ever pop or push a single block or splice a single batch
+  class spin_lock
+  {
+  public:
+    void lock()
+    {
+      while (m_flag.test_and_set(std::memory_order_acquire))
+      {
+        std::this_thread::yield();
+      }
+    }
+
+    void unlock()
+    {
+      m_flag.clear(std::memory_order_release);
+    }
+
+  private:
+    std::atomic_flag m_flag = ATOMIC_FLAG_INIT;
+  };
+
+  using spin_lock_t = std::lock_guard<spin_lock>;
+
+  struct free_list
+  {
+    block_descriptor_ptr head;
+    std::size_t count;
+  };
+
+  // a stack of batches of blocks of a single size, each of them batch_size(i)
+  // blocks long
+  struct bucket
+  {
+    spin_lock lock;
+    block_descriptor_ptr batches;
+    std::size_t previous_allocated_count;
+  };
+
+  struct shard
+  {
+    spin_lock lock;
+    std::vector<free_list> lists;
+
+    // keep the locks of neighboring shards off each other's cache lines
+    char padding[64];
+  };
+
+  Upstream* m_upstream;
+
+  pool_options m_options;
+  std::size_t m_smallest_block_log2;
+  std::size_t m_num_buckets;
+
+  std::vector<bucket> m_buckets;
+  std::vector<shard> m_shards;
+
+  // chunks allocated from upstream, and the resource serving requests that
+  // don't fit in any bucket; both are guarded by m_upstream_mutex
+  std::mutex m_upstream_mutex;
+  chunk_descriptor_ptr m_allocated;
+  oversized_pool m_oversized;
+
+  static block_descriptor& descriptor(block_descriptor_ptr block)
+  {
+    return thrust::raw_reference_cast(*block);
+  }
+
+  shard& current_shard()
+  {
+    static std::atomic<std::size_t> next_ticket(0);
+    static thread_local const std::size_t ticket = next_ticket++;
+
+    return m_shards[ticket % m_shards.size()];
+  }
+
+  // the number of blocks moved between a shard and the shared list at once;
+  // small blocks move min_bytes_per_chunk at a time, but no more than
+  // min_blocks_per_chunk of them
+  std::size_t batch_size(std::size_t bytes_log2) const
+  {
+    std::size_t n = m_options.min_bytes_per_chunk >> bytes_log2;
+    n             = (std::min)(n, m_options.min_blocks_per_chunk);
+    return (std::max)(n, static_cast<std::size_t>(1));
+  }
+
+  // allocates a new chunk of blocks of the given size, pushes all but the last
+  // few of them to the shared list as full batches, and returns the rest
+  free_list allocate_chunk(std::size_t bucket_idx, std::size_t bytes_log2)
+  {
+    const std::size_t bytes = static_cast<std::size_t>(1) << bytes_log2;
+    const std::size_t batch = batch_size(bytes_log2);
+    bucket& b               = m_buckets[bucket_idx];
+
+    lock_t lock(m_upstream_mutex);
+
+    std::size_t n = b.previous_allocated_count;
+    if (n == 0)
+    {
+      n = m_options.min_blocks_per_chunk;
+      if (n < (m_options.min_bytes_per_chunk >> bytes_log2))
+      {
+        n = m_options.min_bytes_per_chunk >> bytes_log2;
+      }
+    }
+    else
+    {
+      n = n * 3 / 2;
+      if (n > (m_options.max_bytes_per_chunk >> bytes_log2))
+      {
+        n = m_options.max_bytes_per_chunk >> bytes_log2;
+      }
+      if (n > m_options.max_blocks_per_chunk)
+      {
+        n = m_options.max_blocks_per_chunk;
+      }
+    }
+    n                          = (std::max)(n, static_cast<std::size_t>(1));
+    b.previous_allocated_count = n;
+
+    std::size_t descriptor_size = (std::max)(sizeof(block_descriptor), m_options.alignment);
+    std::size_t block_size      = bytes + descriptor_size;
+    block_size                  = (block_size + m_options.alignment - 1) / m_options.alignment * m_options.alignment;
+    std::size_t chunk_size      = block_size * n;
+
+    void_ptr allocated = m_upstream->do_allocate(chunk_size + sizeof(chunk_descriptor), m_options.alignment);
+    chunk_descriptor_ptr chunk =
+      static_cast<chunk_descriptor_ptr>(static_cast<void_ptr>(static_cast<char_ptr>(allocated) + chunk_size));
+
+    chunk_descriptor chunk_desc;
+    chunk_desc.size = chunk_size;
+    chunk_desc.next = m_allocated;
+    *chunk          = chunk_desc;
+    m_allocated     = chunk;
+
+    // thread the blocks into a single list, then cut full batches off its end
+    free_list list = {block_descriptor_ptr(), 0};
+
+    for (std::size_t i = n; i > 0; --i)
+    {
+      block_descriptor_ptr block = static_cast<block_descriptor_ptr>(
+        static_cast<void_ptr>(static_cast<char_ptr>(allocated) + block_size * (i - 1) + bytes));
+
+      descriptor(block).next = list.head;
+      list.head              = block;
+      ++list.count;
+    }
+
+    const std::size_t kept = n - (n - 1) / batch * batch;
+
+    block_descriptor_ptr last = list.head;
+    for (std::size_t i = 1; i < kept; ++i)
+    {
+      last = descriptor(last).next;
+    }
+
+    block_descriptor_ptr batches = descriptor(last).next;
+    descriptor(last).next        = block_descriptor_ptr();
+    list.count                   = kept;
+
+    while (detail::pointer_traits<block_descriptor_ptr>::get(batches))
+    {
+      block_descriptor_ptr first = batches;
+
+      for (std::size_t i = 1; i < batch; ++i)
+      {
+        batches = descriptor(batches).next;
+      }
+
+      block_descriptor_ptr rest = descriptor(batches).next;
+      descriptor(batches).next  = block_descriptor_ptr();
+      push_batch(b, first);
+      batches = rest;
+    }
+
+    return list;
+  }
+
+  static void push_batch(bucket& b, block_descriptor_ptr batch)
+  {
+    spin_lock_t lock(b.lock);
+    descriptor(batch).next_batch = b.batches;
+    b.batches                    = batch;
+  }
+
+  static block_descriptor_ptr pop_batch(bucket& b)
+  {
+    spin_lock_t lock(b.lock);
+    block_descriptor_ptr batch = b.batches;
+    if (detail::pointer_traits<block_descriptor_ptr>::get(batch))
+    {
+      b.batches = descriptor(batch).next_batch;
+    }
+    return batch;
+  }
+
+public:
+  /*! Releases all held memory to upstream. Must not be called concurrently with any other member function.
+   */
+  void release()
+  {
+    for (shard& s : m_shards)
+    {
+      for (free_list& list : s.lists)
+      {
+        list.head  = block_descriptor_ptr();
+        list.count = 0;
+      }
+    }
+
+    for (bucket& b : m_buckets)
+    {
+      b.batches                  = block_descriptor_ptr();
+      b.previous_allocated_count = 0;
+    }
+
+    while (detail::pointer_traits<chunk_descriptor_ptr>::get(m_allocated))
+    {
+      chunk_descriptor_ptr alloc = m_allocated;
+      m_allocated                = thrust::raw_reference_cast(*m_allocated).next;
+
+      void_ptr p = static_cast<void_ptr>(
+        static_cast<char_ptr>(static_cast<void_ptr>(alloc)) - thrust::raw_reference_cast(*alloc).size);
+      m_upstream->do_deallocate(
+        p, thrust::raw_reference_cast(*alloc).size + sizeof(chunk_descriptor), m_options.alignment);
+    }
+
+    m_oversized.release();
+  }
+
+  _CCCL_NODISCARD virtual void_ptr
+  do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    bytes = (std::max)(bytes, m_options.smallest_block_size);
+    assert(detail::is_power_of_2(alignment));
+
+    if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
+    {
+      lock_t lock(m_upstream_mutex);
+      return m_oversized.do_allocate(bytes, alignment);
+    }
+
+    std::size_t bytes_log2 = thrust::detail::log2_ri(bytes);
+    std::size_t bucket_idx = bytes_log2 - m_smallest_block_log2;
+
+    bytes = static_cast<std::size_t>(1) << bytes_log2;
+
+    shard& s = current_shard();
+    spin_lock_t lock(s.lock);
+    free_list& list = s.lists[bucket_idx];
+
+    // refill the shard with a batch from the shared list, or from a new chunk
+    if (list.count == 0)
+    {
+      block_descriptor_ptr batch = pop_batch(m_buckets[bucket_idx]);
+
+      if (detail::pointer_traits<block_descriptor_ptr>::get(batch))
+      {
+        list.head  = batch;
+        list.count = batch_size(bytes_log2);
+      }
+      else
+      {
+        list = allocate_chunk(bucket_idx, bytes_log2);
+      }
+    }
+
+    block_descriptor_ptr block = list.head;
+    list.head                  = descriptor(block).next;
+    --list.count;
+
+    return static_cast<void_ptr>(static_cast<char_ptr>(static_cast<void_ptr>(block)) - bytes);
+  }
+
+  virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    n = (std::max)(n, m_options.smallest_block_size);
+    assert(detail::is_power_of_2(alignment));
+
+    // verify that the pointer is at least as aligned as claimed
+    assert(reinterpret_cast<detail::intmax_t>(void_ptr_traits::get(p)) % alignment == 0);
+
+    if (n > m_options.largest_block_size || alignment > m_options.alignment)
+    {
+      lock_t lock(m_upstream_mutex);
+      m_oversized.do_deallocate(p, n, alignment);
+      return;
+    }
+
+    std::size_t n_log2     = thrust::detail::log2_ri(n);
+    std::size_t bucket_idx = n_log2 - m_smallest_block_log2;
+
+    n = static_cast<std::size_t>(1) << n_log2;
+
+    block_descriptor_ptr block = static_cast<block_descriptor_ptr>(static_cast<void_ptr>(static_cast<char_ptr>(p) + n));
+
+    shard& s = current_shard();
+    spin_lock_t lock(s.lock);
+    free_list& list = s.lists[bucket_idx];
+
+    descriptor(block).next = list.head;
+    list.head              = block;
+    ++list.count;
+
+    // hand a batch back to the shared list once the shard caches two of them,
+    // so that the next few allocations and deallocations stay local
+    const std::size_t batch = batch_size(n_log2);
+
+    if (list.count >= 2 * batch)
+    {
+      block_descriptor_ptr last = list.head;
+      for (std::size_t i = 1; i < batch; ++i)
+      {
+        last = descriptor(last).next;
+      }
+
+      block_descriptor_ptr first = list.head;
+      list.head                  = descriptor(last).next;
+      list.count -= batch;
+      descriptor(last).next = block_descriptor_ptr();
+
+      push_batch(m_buckets[bucket_idx], first);
+    }
+  }
+};
+
+/*! \} // memory_resources
+ */
+
+} // namespace mr
+THRUST_NAMESPACE_END
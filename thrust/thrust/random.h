@@ -35,7 +35,9 @@
 #include <thrust/random/discard_block_engine.h>
 #include <thrust/random/linear_congruential_engine.h>
 #include <thrust/random/linear_feedback_shift_engine.h>
+#include <thrust/random/philox_engine.h>
 #include <thrust/random/subtract_with_carry_engine.h>
+#include <thrust/random/threefry_engine.h>
 #include <thrust/random/xor_combine_engine.h>
 
 // distributions
@@ -43,6 +45,9 @@
 #include <thrust/random/uniform_int_distribution.h>
 #include <thrust/random/uniform_real_distribution.h>
 
+// algorithms
+#include <thrust/random/generate_random.h>
+
 THRUST_NAMESPACE_BEGIN
 
 /*! \addtogroup random Random Number Generation
@@ -0,0 +1,87 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/type_traits.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// true for engines whose i-th block of results is a pure function of their
+// key and counter, which random_core_access::generate_blocks evaluates
+template <typename Engine>
+struct is_counter_based_engine : thrust::detail::false_type
+{};
+
+// the largest value of a w bit word of type UIntType
+template <typename UIntType, std::size_t w>
+struct counter_based_engine_wordmask
+{
+  static const UIntType value = ((UIntType(1) << (w - 1)) - 1) * 2 + 1;
+};
+
+template <typename UIntType, std::size_t w>
+_CCCL_HOST_DEVICE UIntType counter_based_engine_rotl(UIntType x, unsigned int r)
+{
+  const UIntType mask = counter_based_engine_wordmask<UIntType, w>::value;
+
+  return ((x << r) | ((x & mask) >> (w - r))) & mask;
+}
+
+// adds z to the counter, whose n words of w bits are stored least significant
+// word first
+template <typename UIntType, std::size_t w, std::size_t n>
+_CCCL_HOST_DEVICE void counter_based_engine_add(UIntType (&counter)[n], unsigned long long z)
+{
+  const UIntType mask = counter_based_engine_wordmask<UIntType, w>::value;
+
+  for (std::size_t j = 0; j < n && z != 0; ++j)
+  {
+    const UIntType word = counter[j];
+    const UIntType add  = static_cast<UIntType>(z) & mask;
+
+    counter[j] = (word + add) & mask;
+
+    // carry into the next word, unless z doesn't reach past this one
+    const bool carry = counter[j] < word;
+    z                = w < 64 ? z >> (w % 64) : 0;
+    z += carry ? 1 : 0;
+  }
+}
+
+} // namespace detail
+
+} // namespace random
+
+THRUST_NAMESPACE_END
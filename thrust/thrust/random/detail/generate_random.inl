@@ -0,0 +1,205 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/distance.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/random/detail/counter_based_engine.h>
+#include <thrust/random/detail/random_core_access.h>
+#include <thrust/random/generate_random.h>
+#include <thrust/system/detail/generic/select_system.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// the number of blocks a thread encrypts at once
+const std::size_t generate_random_lanes = 4;
+
+// writes the results of batch consecutive groups of generate_random_lanes
+// blocks, and the results buffered by engine in front of them
+template <typename Engine, typename RandomAccessIterator, typename Size>
+struct generate_random_blocks
+{
+  Engine engine;
+  RandomAccessIterator first;
+  Size head;
+  Size n;
+
+  _CCCL_HOST_DEVICE void operator()(Size batch) const
+  {
+    const Size words = static_cast<Size>(Engine::word_count);
+    const Size lanes = static_cast<Size>(generate_random_lanes);
+
+    if (batch == 0)
+    {
+      Engine e = engine;
+
+      for (Size k = 0; k < head; ++k)
+      {
+        first[k] = e();
+      }
+    }
+
+    typename Engine::result_type results[Engine::word_count][generate_random_lanes];
+    random_core_access::generate_blocks<generate_random_lanes>(
+      engine, static_cast<unsigned long long>(batch) * generate_random_lanes, results);
+
+    const Size begin = head + batch * lanes * words;
+
+    for (Size l = 0; l < lanes; ++l)
+    {
+      for (Size j = 0; j < words; ++j)
+      {
+        const Size k = begin + l * words + j;
+
+        if (k < n)
+        {
+          first[k] = results[j][l];
+        }
+      }
+    }
+  }
+};
+
+// invokes a copy of engine for every element in order
+template <typename Engine, typename RandomAccessIterator, typename Size>
+struct generate_random_sequentially
+{
+  Engine engine;
+  RandomAccessIterator first;
+  Size n;
+
+  template <typename Dummy>
+  _CCCL_HOST_DEVICE void operator()(Dummy) const
+  {
+    Engine e = engine;
+
+    for (Size k = 0; k < n; ++k)
+    {
+      first[k] = e();
+    }
+  }
+};
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Engine>
+_CCCL_HOST_DEVICE void generate_random(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  Engine& g,
+  thrust::detail::true_type /* counter-based */)
+{
+  using Size = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  const Size n = thrust::distance(first, last);
+
+  if (n <= 0)
+  {
+    return;
+  }
+
+  // the results left in the current block come first, the rest starts at a
+  // block boundary
+  const Size buffered = static_cast<Size>(random_core_access::buffered(g));
+  const Size head     = buffered < n ? buffered : n;
+
+  const Size batch_size = static_cast<Size>(Engine::word_count * generate_random_lanes);
+  Size batches          = (n - head + batch_size - 1) / batch_size;
+  batches               = batches > 0 ? batches : 1;
+
+  thrust::for_each_n(exec,
+                     thrust::counting_iterator<Size>(0),
+                     batches,
+                     generate_random_blocks<Engine, RandomAccessIterator, Size>{g, first, head, n});
+
+  g.discard(static_cast<unsigned long long>(n));
+}
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Engine>
+_CCCL_HOST_DEVICE void generate_random(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  Engine& g,
+  thrust::detail::false_type /* counter-based */)
+{
+  using Size = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  const Size n = thrust::distance(first, last);
+
+  if (n <= 0)
+  {
+    return;
+  }
+
+  thrust::for_each_n(exec,
+                     thrust::counting_iterator<Size>(0),
+                     1,
+                     generate_random_sequentially<Engine, RandomAccessIterator, Size>{g, first, n});
+
+  g.discard(static_cast<unsigned long long>(n));
+}
+
+} // namespace detail
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename UniformRandomBitGenerator>
+_CCCL_HOST_DEVICE void generate_random(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                                       RandomAccessIterator first,
+                                       RandomAccessIterator last,
+                                       UniformRandomBitGenerator& g)
+{
+  detail::generate_random(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)),
+    first,
+    last,
+    g,
+    detail::is_counter_based_engine<UniformRandomBitGenerator>());
+} // end generate_random()
+
+template <typename RandomAccessIterator, typename UniformRandomBitGenerator>
+void generate_random(RandomAccessIterator first, RandomAccessIterator last, UniformRandomBitGenerator& g)
+{
+  using thrust::system::detail::generic::select_system;
+
+  using System = typename thrust::iterator_system<RandomAccessIterator>::type;
+
+  System system;
+
+  return thrust::random::generate_random(select_system(system), first, last, g);
+} // end generate_random()
+
+} // namespace random
+
+THRUST_NAMESPACE_END
@@ -0,0 +1,384 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/random/philox_engine.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// returns the low w bits of a * b and stores the high w bits to hi
+template <size_t w, typename UIntType>
+_CCCL_HOST_DEVICE UIntType philox_mulhilo(UIntType a, UIntType b, UIntType& hi, thrust::detail::true_type /* w <= 32 */)
+{
+  const std::uint64_t product = static_cast<std::uint64_t>(a) * static_cast<std::uint64_t>(b);
+
+  hi = static_cast<UIntType>(product >> w);
+  return static_cast<UIntType>(product) & counter_based_engine_wordmask<UIntType, w>::value;
+}
+
+template <size_t w, typename UIntType>
+_CCCL_HOST_DEVICE UIntType philox_mulhilo(UIntType a, UIntType b, UIntType& hi, thrust::detail::false_type /* w > 32 */)
+{
+#if !defined(_LIBCUDACXX_HAS_NO_INT128)
+  const __uint128_t product = static_cast<__uint128_t>(a) * static_cast<__uint128_t>(b);
+
+  hi = static_cast<UIntType>(product >> w);
+  return static_cast<UIntType>(product) & counter_based_engine_wordmask<UIntType, w>::value;
+#else // _LIBCUDACXX_HAS_NO_INT128
+  // schoolbook multiplication of the 32 bit halves
+  const std::uint64_t a_lo = static_cast<std::uint32_t>(a), a_hi = static_cast<std::uint64_t>(a) >> 32;
+  const std::uint64_t b_lo = static_cast<std::uint32_t>(b), b_hi = static_cast<std::uint64_t>(b) >> 32;
+
+  const std::uint64_t lo_lo = a_lo * b_lo;
+  const std::uint64_t hi_lo = a_hi * b_lo;
+  const std::uint64_t lo_hi = a_lo * b_hi;
+  const std::uint64_t hi_hi = a_hi * b_hi;
+
+  const std::uint64_t middle = (lo_lo >> 32) + static_cast<std::uint32_t>(hi_lo) + lo_hi;
+
+  const std::uint64_t product_hi = hi_hi + (hi_lo >> 32) + (middle >> 32);
+  const std::uint64_t product_lo = (middle << 32) | static_cast<std::uint32_t>(lo_lo);
+
+  hi = static_cast<UIntType>(w == 64 ? product_hi : (product_hi << (64 - w)) | (product_lo >> (w % 64)));
+  return static_cast<UIntType>(product_lo) & counter_based_engine_wordmask<UIntType, w>::value;
+#endif // _LIBCUDACXX_HAS_NO_INT128
+}
+
+} // namespace detail
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE philox_engine<UIntType, w, n, r, consts...>::philox_engine(result_type value)
+{
+  seed(value);
+} // end philox_engine::philox_engine()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE void philox_engine<UIntType, w, n, r, consts...>::seed(result_type value)
+{
+  for (size_t j = 0; j < n; ++j)
+  {
+    m_counter[j] = 0;
+    m_results[j] = 0;
+  }
+
+  for (size_t j = 0; j < n / 2; ++j)
+  {
+    m_key[j] = 0;
+  }
+
+  m_key[0] = value & max;
+
+  // the next invocation generates the first block
+  m_index = n - 1;
+} // end philox_engine::seed()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE void
+philox_engine<UIntType, w, n, r, consts...>::set_counter(const ::cuda::std::array<result_type, n>& counter)
+{
+  for (size_t j = 0; j < n; ++j)
+  {
+    m_counter[n - 1 - j] = counter[j] & max;
+  }
+
+  m_index = n - 1;
+} // end philox_engine::set_counter()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+template <size_t lanes>
+_CCCL_HOST_DEVICE void philox_engine<UIntType, w, n, r, consts...>::generate_blocks(
+  unsigned long long block, result_type (&results)[n][lanes]) const
+{
+  const result_type constants[n] = {consts...};
+
+  // the lanes are interleaved, so that each step of a round is applied to all
+  // of them at once
+  for (size_t l = 0; l < lanes; ++l)
+  {
+    result_type counter[n];
+
+    for (size_t j = 0; j < n; ++j)
+    {
+      counter[j] = m_counter[j];
+    }
+
+    detail::counter_based_engine_add<result_type, w>(counter, block + l);
+
+    for (size_t j = 0; j < n; ++j)
+    {
+      results[j][l] = counter[j];
+    }
+  }
+
+  result_type key[n / 2];
+
+  for (size_t j = 0; j < n / 2; ++j)
+  {
+    key[j] = m_key[j];
+  }
+
+  for (size_t round = 0; round < r; ++round)
+  {
+    if (round > 0)
+    {
+      for (size_t j = 0; j < n / 2; ++j)
+      {
+        key[j] = (key[j] + constants[2 * j + 1]) & max;
+      }
+    }
+
+    for (size_t l = 0; l < lanes; ++l)
+    {
+      result_type hi0;
+      const result_type lo0 =
+        detail::philox_mulhilo<w>(constants[0], results[0][l], hi0, thrust::detail::integral_constant<bool, w <= 32>());
+
+      if (n == 2)
+      {
+        results[0][l] = hi0 ^ key[0] ^ results[1][l];
+        results[1][l] = lo0;
+      }
+      else
+      {
+        result_type hi1;
+        const result_type lo1 = detail::philox_mulhilo<w>(
+          constants[2 % n], results[2 % n][l], hi1, thrust::detail::integral_constant<bool, w <= 32>());
+
+        results[0][l]     = hi1 ^ key[0] ^ results[1][l];
+        results[1][l]     = lo1;
+        results[2 % n][l] = hi0 ^ key[(n / 2) - 1] ^ results[3 % n][l];
+        results[3 % n][l] = lo0;
+      }
+    }
+  }
+} // end philox_engine::generate_blocks()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE size_t philox_engine<UIntType, w, n, r, consts...>::buffered() const
+{
+  return n - 1 - m_index;
+} // end philox_engine::buffered()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE typename philox_engine<UIntType, w, n, r, consts...>::result_type
+philox_engine<UIntType, w, n, r, consts...>::operator()(void)
+{
+  if (++m_index == n)
+  {
+    result_type block[n][1];
+    generate_blocks(0, block);
+
+    for (size_t j = 0; j < n; ++j)
+    {
+      m_results[j] = block[j][0];
+    }
+
+    detail::counter_based_engine_add<result_type, w>(m_counter, 1);
+    m_index = 0;
+  }
+
+  return m_results[m_index];
+} // end philox_engine::operator()()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE void philox_engine<UIntType, w, n, r, consts...>::discard(unsigned long long z)
+{
+  // first consume what is left of the current block
+  const unsigned long long buffered = n - 1 - m_index;
+
+  if (z <= buffered)
+  {
+    m_index += static_cast<size_t>(z);
+    return;
+  }
+
+  z -= buffered;
+
+  // then skip over all blocks but the last one that is touched
+  const unsigned long long blocks = (z - 1) / n + 1;
+  m_index                         = static_cast<size_t>((z - 1) % n);
+
+  detail::counter_based_engine_add<result_type, w>(m_counter, blocks - 1);
+
+  if (m_index != n - 1)
+  {
+    result_type block[n][1];
+    generate_blocks(0, block);
+
+    for (size_t j = 0; j < n; ++j)
+    {
+      m_results[j] = block[j][0];
+    }
+  }
+
+  detail::counter_based_engine_add<result_type, w>(m_counter, 1);
+} // end philox_engine::discard()
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+template <typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+philox_engine<UIntType, w, n, r, consts...>::stream_out(std::basic_ostream<CharT, Traits>& os) const
+{
+  using ostream_type = std::basic_ostream<CharT, Traits>;
+  using ios_base     = typename ostream_type::ios_base;
+
+  // save old flags & fill character
+  const typename ios_base::fmtflags flags = os.flags();
+  const CharT fill                        = os.fill();
+
+  const CharT space = os.widen(' ');
+  os.flags(ios_base::dec | ios_base::fixed | ios_base::left);
+  os.fill(space);
+
+  // output the counter, key, buffered block and position in the block
+  for (size_t j = 0; j < n; ++j)
+  {
+    os << m_counter[j] << space;
+  }
+
+  for (size_t j = 0; j < n / 2; ++j)
+  {
+    os << m_key[j] << space;
+  }
+
+  for (size_t j = 0; j < n; ++j)
+  {
+    os << m_results[j] << space;
+  }
+
+  os << m_index;
+
+  // restore flags & fill character
+  os.flags(flags);
+  os.fill(fill);
+
+  return os;
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+template <typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+philox_engine<UIntType, w, n, r, consts...>::stream_in(std::basic_istream<CharT, Traits>& is)
+{
+  using istream_type = std::basic_istream<CharT, Traits>;
+  using ios_base     = typename istream_type::ios_base;
+
+  // save old flags
+  const typename ios_base::fmtflags flags = is.flags();
+
+  is.flags(ios_base::skipws);
+
+  // input the counter, key, buffered block and position in the block
+  for (size_t j = 0; j < n; ++j)
+  {
+    is >> m_counter[j];
+  }
+
+  for (size_t j = 0; j < n / 2; ++j)
+  {
+    is >> m_key[j];
+  }
+
+  for (size_t j = 0; j < n; ++j)
+  {
+    is >> m_results[j];
+  }
+
+  is >> m_index;
+
+  // restore flags
+  is.flags(flags);
+
+  return is;
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE bool
+philox_engine<UIntType, w, n, r, consts...>::equal(const philox_engine<UIntType, w, n, r, consts...>& rhs) const
+{
+  // the buffered block follows from the key and the counter
+  bool result = m_index == rhs.m_index;
+
+  for (size_t j = 0; j < n; ++j)
+  {
+    result &= m_counter[j] == rhs.m_counter[j];
+  }
+
+  for (size_t j = 0; j < n / 2; ++j)
+  {
+    result &= m_key[j] == rhs.m_key[j];
+  }
+
+  return result;
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE bool operator==(const philox_engine<UIntType, w, n, r, consts...>& lhs,
+                                  const philox_engine<UIntType, w, n, r, consts...>& rhs)
+{
+  return thrust::random::detail::random_core_access::equal(lhs, rhs);
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+_CCCL_HOST_DEVICE bool operator!=(const philox_engine<UIntType, w, n, r, consts...>& lhs,
+                                  const philox_engine<UIntType, w, n, r, consts...>& rhs)
+{
+  return !(lhs == rhs);
+}
+
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_, typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+operator<<(std::basic_ostream<CharT, Traits>& os, const philox_engine<UIntType_, w_, n_, r_, consts_...>& e)
+{
+  return thrust::random::detail::random_core_access::stream_out(os, e);
+}
+
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_, typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+operator>>(std::basic_istream<CharT, Traits>& is, philox_engine<UIntType_, w_, n_, r_, consts_...>& e)
+{
+  return thrust::random::detail::random_core_access::stream_in(is, e);
+}
+
+namespace detail
+{
+
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+struct is_counter_based_engine<philox_engine<UIntType, w, n, r, consts...>> : thrust::detail::true_type
+{};
+
+} // namespace detail
+
+} // namespace random
+
+THRUST_NAMESPACE_END
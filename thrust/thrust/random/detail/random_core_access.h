@@ -26,6 +26,8 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cstddef>
+
 THRUST_NAMESPACE_BEGIN
 
 namespace random
@@ -54,6 +56,20 @@ struct random_core_access
     return lhs.equal(rhs);
   }
 
+  // counter-based engines
+
+  template <std::size_t lanes, typename Engine, typename Results>
+  _CCCL_HOST_DEVICE static void generate_blocks(const Engine& e, unsigned long long block, Results& results)
+  {
+    e.template generate_blocks<lanes>(block, results);
+  }
+
+  template <typename Engine>
+  _CCCL_HOST_DEVICE static std::size_t buffered(const Engine& e)
+  {
+    return e.buffered();
+  }
+
 }; // end random_core_access
 
 } // namespace detail
@@ -0,0 +1,423 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/random/threefry_engine.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+namespace detail
+{
+
+// the rotation distances of Threefry for n words of w bits, one byte per
+// round modulo 8, for each pair of words
+template <size_t w, size_t n>
+struct threefry_rotations;
+
+template <>
+struct threefry_rotations<32, 2>
+{
+  // 13, 15, 26, 6, 17, 29, 16, 24
+  static const std::uint64_t pair0 = 0x18101D11061A0F0D;
+  static const std::uint64_t pair1 = pair0;
+};
+
+template <>
+struct threefry_rotations<32, 4>
+{
+  // 10, 11, 13, 23, 6, 17, 25, 18
+  static const std::uint64_t pair0 = 0x12191106170D0B0A;
+  // 26, 21, 27, 5, 20, 11, 10, 20
+  static const std::uint64_t pair1 = 0x140A0B14051B151A;
+};
+
+template <>
+struct threefry_rotations<64, 2>
+{
+  // 16, 42, 12, 31, 16, 32, 24, 21
+  static const std::uint64_t pair0 = 0x151820101F0C2A10;
+  static const std::uint64_t pair1 = pair0;
+};
+
+template <>
+struct threefry_rotations<64, 4>
+{
+  // 14, 52, 23, 5, 25, 46, 58, 32
+  static const std::uint64_t pair0 = 0x203A2E190517340E;
+  // 16, 57, 40, 37, 33, 12, 22, 32
+  static const std::uint64_t pair1 = 0x20160C2125283910;
+};
+
+// the parity of the key schedule of Threefish
+template <typename UIntType, size_t w>
+struct threefry_parity;
+
+template <typename UIntType>
+struct threefry_parity<UIntType, 32>
+{
+  static const UIntType value = 0x1BD11BDA;
+};
+
+template <typename UIntType>
+struct threefry_parity<UIntType, 64>
+{
+  static const UIntType value = 0x1BD11BDAA9FC1A22;
+};
+
+// applies the rounds [round, r) to all lanes; unrolling them through the
+// template makes all rotation distances constant
+template <typename UIntType, size_t w, size_t n, size_t lanes, size_t round, size_t r>
+struct threefry_rounds
+{
+  static const UIntType max = counter_based_engine_wordmask<UIntType, w>::value;
+
+  static const unsigned int r0 = (threefry_rotations<w, n>::pair0 >> (8 * (round % 8))) & 0xFF;
+  static const unsigned int r1 = (threefry_rotations<w, n>::pair1 >> (8 * (round % 8))) & 0xFF;
+
+  // odd rounds mix the words of the pairs the other way around
+  static const size_t a = n == 2 || round % 2 == 0 ? 1 : 3;
+  static const size_t b = n == 2 ? 1 : round % 2 == 0 ? 3 : 1;
+
+  _CCCL_HOST_DEVICE static void apply(UIntType (&x)[n][lanes], const UIntType (&schedule)[n + 1])
+  {
+    for (size_t l = 0; l < lanes; ++l)
+    {
+      x[0][l] = (x[0][l] + x[a][l]) & max;
+      x[a][l] = counter_based_engine_rotl<UIntType, w>(x[a][l], r0) ^ x[0][l];
+
+      if (n == 4)
+      {
+        x[2 % n][l] = (x[2 % n][l] + x[b][l]) & max;
+        x[b][l]     = counter_based_engine_rotl<UIntType, w>(x[b][l], r1) ^ x[2 % n][l];
+      }
+    }
+
+    // inject the key after every fourth round
+    if (round % 4 == 3)
+    {
+      const size_t injection = round / 4 + 1;
+
+      for (size_t l = 0; l < lanes; ++l)
+      {
+        for (size_t j = 0; j < n; ++j)
+        {
+          x[j][l] = (x[j][l] + schedule[(injection + j) % (n + 1)]) & max;
+        }
+
+        x[n - 1][l] = (x[n - 1][l] + static_cast<UIntType>(injection)) & max;
+      }
+    }
+
+    threefry_rounds<UIntType, w, n, lanes, round + 1, r>::apply(x, schedule);
+  }
+};
+
+template <typename UIntType, size_t w, size_t n, size_t lanes, size_t r>
+struct threefry_rounds<UIntType, w, n, lanes, r, r>
+{
+  _CCCL_HOST_DEVICE static void apply(UIntType (&)[n][lanes], const UIntType (&)[n + 1]) {}
+};
+
+} // namespace detail
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE threefry_engine<UIntType, w, n, r>::threefry_engine(result_type value)
+{
+  seed(value);
+} // end threefry_engine::threefry_engine()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE void threefry_engine<UIntType, w, n, r>::seed(result_type value)
+{
+  for (size_t j = 0; j < n; ++j)
+  {
+    m_counter[j] = 0;
+    m_results[j] = 0;
+  }
+
+  for (size_t j = 0; j < n; ++j)
+  {
+    m_key[j] = 0;
+  }
+
+  m_key[0] = value & max;
+
+  // the next invocation generates the first block
+  m_index = n - 1;
+} // end threefry_engine::seed()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE void
+threefry_engine<UIntType, w, n, r>::set_counter(const ::cuda::std::array<result_type, n>& counter)
+{
+  for (size_t j = 0; j < n; ++j)
+  {
+    m_counter[n - 1 - j] = counter[j] & max;
+  }
+
+  m_index = n - 1;
+} // end threefry_engine::set_counter()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+template <size_t lanes>
+_CCCL_HOST_DEVICE void threefry_engine<UIntType, w, n, r>::generate_blocks(
+  unsigned long long block, result_type (&results)[n][lanes]) const
+{
+  // the key schedule appends the parity of the key words
+  result_type schedule[n + 1];
+  schedule[n] = detail::threefry_parity<result_type, w>::value;
+
+  for (size_t j = 0; j < n; ++j)
+  {
+    schedule[j] = m_key[j];
+    schedule[n] ^= m_key[j];
+  }
+
+  // the lanes are interleaved, so that each step of a round is applied to all
+  // of them at once
+  for (size_t l = 0; l < lanes; ++l)
+  {
+    result_type counter[n];
+
+    for (size_t j = 0; j < n; ++j)
+    {
+      counter[j] = m_counter[j];
+    }
+
+    detail::counter_based_engine_add<result_type, w>(counter, block + l);
+
+    for (size_t j = 0; j < n; ++j)
+    {
+      results[j][l] = (counter[j] + schedule[j]) & max;
+    }
+  }
+
+  detail::threefry_rounds<result_type, w, n, lanes, 0, r>::apply(results, schedule);
+} // end threefry_engine::generate_blocks()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE size_t threefry_engine<UIntType, w, n, r>::buffered() const
+{
+  return n - 1 - m_index;
+} // end threefry_engine::buffered()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE typename threefry_engine<UIntType, w, n, r>::result_type
+threefry_engine<UIntType, w, n, r>::operator()(void)
+{
+  if (++m_index == n)
+  {
+    result_type block[n][1];
+    generate_blocks(0, block);
+
+    for (size_t j = 0; j < n; ++j)
+    {
+      m_results[j] = block[j][0];
+    }
+
+    detail::counter_based_engine_add<result_type, w>(m_counter, 1);
+    m_index = 0;
+  }
+
+  return m_results[m_index];
+} // end threefry_engine::operator()()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE void threefry_engine<UIntType, w, n, r>::discard(unsigned long long z)
+{
+  // first consume what is left of the current block
+  const unsigned long long buffered = n - 1 - m_index;
+
+  if (z <= buffered)
+  {
+    m_index += static_cast<size_t>(z);
+    return;
+  }
+
+  z -= buffered;
+
+  // then skip over all blocks but the last one that is touched
+  const unsigned long long blocks = (z - 1) / n + 1;
+  m_index                         = static_cast<size_t>((z - 1) % n);
+
+  detail::counter_based_engine_add<result_type, w>(m_counter, blocks - 1);
+
+  if (m_index != n - 1)
+  {
+    result_type block[n][1];
+    generate_blocks(0, block);
+
+    for (size_t j = 0; j < n; ++j)
+    {
+      m_results[j] = block[j][0];
+    }
+  }
+
+  detail::counter_based_engine_add<result_type, w>(m_counter, 1);
+} // end threefry_engine::discard()
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+template <typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+threefry_engine<UIntType, w, n, r>::stream_out(std::basic_ostream<CharT, Traits>& os) const
+{
+  using ostream_type = std::basic_ostream<CharT, Traits>;
+  using ios_base     = typename ostream_type::ios_base;
+
+  // save old flags & fill character
+  const typename ios_base::fmtflags flags = os.flags();
+  const CharT fill                        = os.fill();
+
+  const CharT space = os.widen(' ');
+  os.flags(ios_base::dec | ios_base::fixed | ios_base::left);
+  os.fill(space);
+
+  // output the counter, key, buffered block and position in the block
+  for (size_t j = 0; j < n; ++j)
+  {
+    os << m_counter[j] << space;
+  }
+
+  for (size_t j = 0; j < n; ++j)
+  {
+    os << m_key[j] << space;
+  }
+
+  for (size_t j = 0; j < n; ++j)
+  {
+    os << m_results[j] << space;
+  }
+
+  os << m_index;
+
+  // restore flags & fill character
+  os.flags(flags);
+  os.fill(fill);
+
+  return os;
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+template <typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+threefry_engine<UIntType, w, n, r>::stream_in(std::basic_istream<CharT, Traits>& is)
+{
+  using istream_type = std::basic_istream<CharT, Traits>;
+  using ios_base     = typename istream_type::ios_base;
+
+  // save old flags
+  const typename ios_base::fmtflags flags = is.flags();
+
+  is.flags(ios_base::skipws);
+
+  // input the counter, key, buffered block and position in the block
+  for (size_t j = 0; j < n; ++j)
+  {
+    is >> m_counter[j];
+  }
+
+  for (size_t j = 0; j < n; ++j)
+  {
+    is >> m_key[j];
+  }
+
+  for (size_t j = 0; j < n; ++j)
+  {
+    is >> m_results[j];
+  }
+
+  is >> m_index;
+
+  // restore flags
+  is.flags(flags);
+
+  return is;
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE bool
+threefry_engine<UIntType, w, n, r>::equal(const threefry_engine<UIntType, w, n, r>& rhs) const
+{
+  // the buffered block follows from the key and the counter
+  bool result = m_index == rhs.m_index;
+
+  for (size_t j = 0; j < n; ++j)
+  {
+    result &= m_counter[j] == rhs.m_counter[j];
+  }
+
+  for (size_t j = 0; j < n; ++j)
+  {
+    result &= m_key[j] == rhs.m_key[j];
+  }
+
+  return result;
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE bool operator==(const threefry_engine<UIntType, w, n, r>& lhs,
+                                  const threefry_engine<UIntType, w, n, r>& rhs)
+{
+  return thrust::random::detail::random_core_access::equal(lhs, rhs);
+}
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+_CCCL_HOST_DEVICE bool operator!=(const threefry_engine<UIntType, w, n, r>& lhs,
+                                  const threefry_engine<UIntType, w, n, r>& rhs)
+{
+  return !(lhs == rhs);
+}
+
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+operator<<(std::basic_ostream<CharT, Traits>& os, const threefry_engine<UIntType_, w_, n_, r_>& e)
+{
+  return thrust::random::detail::random_core_access::stream_out(os, e);
+}
+
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+operator>>(std::basic_istream<CharT, Traits>& is, threefry_engine<UIntType_, w_, n_, r_>& e)
+{
+  return thrust::random::detail::random_core_access::stream_in(is, e);
+}
+
+namespace detail
+{
+
+template <typename UIntType, size_t w, size_t n, size_t r>
+struct is_counter_based_engine<threefry_engine<UIntType, w, n, r>> : thrust::detail::true_type
+{};
+
+} // namespace detail
+
+} // namespace random
+
+THRUST_NAMESPACE_END
@@ -0,0 +1,134 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file generate_random.h
+ *  \brief Fills a range with the results of a random number engine
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+/*! \addtogroup random
+ *  \{
+ */
+
+/*! \p generate_random assigns the results of consecutive invocations of a random number
+ *  engine to each element of the range <tt>[first,last)</tt>, and advances the engine
+ *  past them.
+ *
+ *  The results of counter-based engines like \p philox_engine and \p threefry_engine only
+ *  depend on their position in the sequence, so they are generated in parallel, several
+ *  blocks at a time per thread. Other engines are invoked sequentially.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The first element in the range of interest.
+ *  \param last The last element in the range of interest.
+ *  \param g The random number engine to invoke. It is advanced by <tt>last - first</tt>
+ *         invocations.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ * \p RandomAccessIterator is mutable, and \p UniformRandomBitGenerator's \c result_type is convertible to a type in
+ * \p RandomAccessIterator's set of \c value_types.
+ *  \tparam UniformRandomBitGenerator is a random number engine.
+ *
+ *  The following code snippet demonstrates how to fill a range with random values
+ *  in parallel using the \p thrust::omp::par execution policy:
+ *
+ *  \code
+ *  #include <thrust/random.h>
+ *  #include <thrust/system/omp/execution_policy.h>
+ *  #include <vector>
+ *  ...
+ *  std::vector<unsigned int> v(1 << 24);
+ *
+ *  thrust::philox4x32 rng(13);
+ *  thrust::random::generate_random(thrust::omp::par, v.begin(), v.end(), rng);
+ *
+ *  // v holds the first 1 << 24 results of thrust::philox4x32(13), and rng
+ *  // continues after them
+ *  \endcode
+ *
+ *  \see philox_engine
+ *  \see threefry_engine
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename UniformRandomBitGenerator>
+_CCCL_HOST_DEVICE void generate_random(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                                       RandomAccessIterator first,
+                                       RandomAccessIterator last,
+                                       UniformRandomBitGenerator& g);
+
+/*! \p generate_random assigns the results of consecutive invocations of a random number
+ *  engine to each element of the range <tt>[first,last)</tt>, and advances the engine
+ *  past them.
+ *
+ *  The results of counter-based engines like \p philox_engine and \p threefry_engine only
+ *  depend on their position in the sequence, so they are generated in parallel, several
+ *  blocks at a time per thread. Other engines are invoked sequentially.
+ *
+ *  \param first The first element in the range of interest.
+ *  \param last The last element in the range of interest.
+ *  \param g The random number engine to invoke. It is advanced by <tt>last - first</tt>
+ *         invocations.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, and
+ * \p RandomAccessIterator is mutable, and \p UniformRandomBitGenerator's \c result_type is convertible to a type in
+ * \p RandomAccessIterator's set of \c value_types.
+ *  \tparam UniformRandomBitGenerator is a random number engine.
+ *
+ *  \code
+ *  #include <thrust/random.h>
+ *  #include <thrust/device_vector.h>
+ *  ...
+ *  thrust::device_vector<unsigned long long> v(1 << 24);
+ *
+ *  thrust::threefry4x64 rng;
+ *  thrust::random::generate_random(v.begin(), v.end(), rng);
+ *  \endcode
+ *
+ *  \see philox_engine
+ *  \see threefry_engine
+ */
+template <typename RandomAccessIterator, typename UniformRandomBitGenerator>
+void generate_random(RandomAccessIterator first, RandomAccessIterator last, UniformRandomBitGenerator& g);
+
+/*! \} // end random
+ */
+
+} // namespace random
+
+THRUST_NAMESPACE_END
+
+#include <thrust/random/detail/generate_random.inl>
@@ -0,0 +1,300 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file philox_engine.h
+ *  \brief A counter-based pseudorandom number engine based on the Philox
+ *         block cipher of Salmon et al.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/random/detail/counter_based_engine.h>
+#include <thrust/random/detail/random_core_access.h>
+
+#include <cuda/std/array>
+
+#include <cstddef> // for size_t
+#include <cstdint>
+#include <iostream>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+/*! \addtogroup random_number_engine_templates
+ *  \{
+ */
+
+/*! \class philox_engine
+ *  \brief A \p philox_engine random number engine produces unsigned integer random numbers
+ *         by encrypting a counter with the Philox block cipher.
+ *
+ *         Its interface and results match those of \c std::philox_engine of C++26. As the
+ *         <tt>i</tt>-th block of \p n results only depends on the key and the counter <tt>i</tt>,
+ *         \p discard and \p set_counter take constant time, which makes it cheap to place
+ *         independent parallel invocations on disjoint subsequences, and
+ *         \p thrust::random::generate_random fills a range with its results in parallel.
+ *
+ *  \tparam UIntType The type of unsigned integer to produce.
+ *  \tparam w The word size of the produced values.
+ *  \tparam n The number of words per block, either \c 2 or \c 4.
+ *  \tparam r The number of rounds of the cipher.
+ *  \tparam consts The multipliers and round constants of the cipher, alternating.
+ *
+ *  \note Inexperienced users should not use this class template directly.  Instead, use
+ *  \p philox4x32 or \p philox4x64.
+ *
+ *  The following code snippet shows how to give each element its own subsequence:
+ *
+ *  \code
+ *  #include <thrust/random.h>
+ *  #include <thrust/transform.h>
+ *  #include <thrust/iterator/counting_iterator.h>
+ *  #include <thrust/device_vector.h>
+ *
+ *  struct estimate_pi
+ *  {
+ *    __host__ __device__ float operator()(unsigned int i) const
+ *    {
+ *      thrust::philox4x32 rng;
+ *      thrust::uniform_real_distribution<float> u01(0, 1);
+ *
+ *      // skip past the 1000 values of the elements in front of this one
+ *      rng.discard(1000ull * i);
+ *
+ *      unsigned int hits = 0;
+ *      for (int j = 0; j < 500; ++j)
+ *      {
+ *        const float x = u01(rng);
+ *        const float y = u01(rng);
+ *        hits += x * x + y * y <= 1.0f;
+ *      }
+ *
+ *      return 4.0f * hits / 500;
+ *    }
+ *  };
+ *  ...
+ *  thrust::device_vector<float> estimates(1 << 20);
+ *  thrust::transform(thrust::counting_iterator<unsigned int>(0),
+ *                    thrust::counting_iterator<unsigned int>(estimates.size()),
+ *                    estimates.begin(), estimate_pi());
+ *  \endcode
+ *
+ *  \see thrust::random::philox4x32
+ *  \see thrust::random::philox4x64
+ *  \see thrust::random::generate_random
+ */
+template <typename UIntType, size_t w, size_t n, size_t r, UIntType... consts>
+class philox_engine
+{
+  static_assert(n == 2 || n == 4, "philox_engine only supports 2 or 4 words per block.");
+  static_assert(sizeof...(consts) == n, "philox_engine requires a multiplier and a round constant per pair of words.");
+  static_assert(0 < w && w <= 64 && w <= sizeof(UIntType) * 8, "philox_engine requires 0 < w <= 64.");
+
+public:
+  // types
+
+  /*! \typedef result_type
+   *  \brief The type of the unsigned integer produced by this \p philox_engine.
+   */
+  using result_type = UIntType;
+
+  // engine characteristics
+
+  /*! The word size of the produced values.
+   */
+  static const size_t word_size = w;
+
+  /*! The number of words per block.
+   */
+  static const size_t word_count = n;
+
+  /*! The number of rounds of the cipher.
+   */
+  static const size_t round_count = r;
+
+  /*! The smallest value this \p philox_engine may potentially produce.
+   */
+  static const result_type min = 0;
+
+  /*! The largest value this \p philox_engine may potentially produce.
+   */
+  static const result_type max = detail::counter_based_engine_wordmask<result_type, w>::value;
+
+  /*! The default seed of this \p philox_engine.
+   */
+  static const result_type default_seed = 20111115u;
+
+  // constructors and seeding functions
+
+  /*! This constructor, which optionally accepts a seed, initializes a new
+   *  \p philox_engine.
+   *
+   *  \param value The seed used to intialize this \p philox_engine's key.
+   */
+  _CCCL_HOST_DEVICE explicit philox_engine(result_type value = default_seed);
+
+  /*! This method initializes this \p philox_engine's key, resets its counter
+   *  to zero, and optionally accepts a seed value.
+   *
+   *  \param value The seed used to initializes this \p philox_engine's key.
+   */
+  _CCCL_HOST_DEVICE void seed(result_type value = default_seed);
+
+  /*! This method sets this \p philox_engine's counter, which selects the block
+   *  of results the next invocation starts from.
+   *
+   *  \param counter The words of the counter, most significant first.
+   */
+  _CCCL_HOST_DEVICE void set_counter(const ::cuda::std::array<result_type, n>& counter);
+
+  // generating functions
+
+  /*! This member function produces a new random value and updates this \p philox_engine's state.
+   *  \return A new random number.
+   */
+  _CCCL_HOST_DEVICE result_type operator()(void);
+
+  /*! This member function advances this \p philox_engine's state a given number of times
+   *  and discards the results.
+   *
+   *  \param z The number of random values to discard.
+   *  \note This function takes constant time.
+   */
+  _CCCL_HOST_DEVICE void discard(unsigned long long z);
+
+  /*! \cond
+   */
+
+private:
+  // the counter and the buffered block of results are stored least
+  // significant word first
+  result_type m_counter[n];
+  result_type m_key[n / 2];
+  result_type m_results[n];
+  size_t m_index;
+
+  friend struct thrust::random::detail::random_core_access;
+
+  // encrypts lanes consecutive counters, the first of which is the counter
+  // of this philox_engine plus block
+  template <size_t lanes>
+  _CCCL_HOST_DEVICE void generate_blocks(unsigned long long block, result_type (&results)[n][lanes]) const;
+
+  // the number of results that are left in the buffered block
+  _CCCL_HOST_DEVICE size_t buffered() const;
+
+  _CCCL_HOST_DEVICE bool equal(const philox_engine& rhs) const;
+
+  template <typename CharT, typename Traits>
+  std::basic_ostream<CharT, Traits>& stream_out(std::basic_ostream<CharT, Traits>& os) const;
+
+  template <typename CharT, typename Traits>
+  std::basic_istream<CharT, Traits>& stream_in(std::basic_istream<CharT, Traits>& is);
+
+  /*! \endcond
+   */
+}; // end philox_engine
+
+/*! This function checks two \p philox_engines for equality.
+ *  \param lhs The first \p philox_engine to test.
+ *  \param rhs The second \p philox_engine to test.
+ *  \return \c true if \p lhs is equal to \p rhs; \c false, otherwise.
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_>
+_CCCL_HOST_DEVICE bool operator==(const philox_engine<UIntType_, w_, n_, r_, consts_...>& lhs,
+                                  const philox_engine<UIntType_, w_, n_, r_, consts_...>& rhs);
+
+/*! This function checks two \p philox_engines for inequality.
+ *  \param lhs The first \p philox_engine to test.
+ *  \param rhs The second \p philox_engine to test.
+ *  \return \c true if \p lhs is not equal to \p rhs; \c false, otherwise.
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_>
+_CCCL_HOST_DEVICE bool operator!=(const philox_engine<UIntType_, w_, n_, r_, consts_...>& lhs,
+                                  const philox_engine<UIntType_, w_, n_, r_, consts_...>& rhs);
+
+/*! This function streams a philox_engine to a \p std::basic_ostream.
+ *  \param os The \p basic_ostream to stream out to.
+ *  \param e The \p philox_engine to stream out.
+ *  \return \p os
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_, typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+operator<<(std::basic_ostream<CharT, Traits>& os, const philox_engine<UIntType_, w_, n_, r_, consts_...>& e);
+
+/*! This function streams a philox_engine in from a std::basic_istream.
+ *  \param is The \p basic_istream to stream from.
+ *  \param e The \p philox_engine to stream in.
+ *  \return \p is
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, UIntType_... consts_, typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+operator>>(std::basic_istream<CharT, Traits>& is, philox_engine<UIntType_, w_, n_, r_, consts_...>& e);
+
+/*! \} // end random_number_engine_templates
+ */
+
+/*! \addtogroup predefined_random
+ *  \{
+ */
+
+/*! \typedef philox4x32
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Philox4x32-10 counter-based random number generation algorithm.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p philox4x32
+ *        shall produce the value \c 1955073260 .
+ */
+using philox4x32 = philox_engine<std::uint32_t, 32, 4, 10, 0xD2511F53, 0x9E3779B9, 0xCD9E8D57, 0xBB67AE85>;
+
+/*! \typedef philox4x64
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Philox4x64-10 counter-based random number generation algorithm.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p philox4x64
+ *        shall produce the value \c 3409172418970261260 .
+ */
+using philox4x64 = philox_engine<std::uint64_t,
+                                 64,
+                                 4,
+                                 10,
+                                 0xD2E7470EE14C6C93,
+                                 0x9E3779B97F4A7C15,
+                                 0xCA5A826395121157,
+                                 0xBB67AE8584CAA73B>;
+
+/*! \} // predefined_random
+ */
+
+} // namespace random
+
+// import names into thrust::
+using random::philox4x32;
+using random::philox4x64;
+using random::philox_engine;
+
+THRUST_NAMESPACE_END
+
+#include <thrust/random/detail/philox_engine.inl>
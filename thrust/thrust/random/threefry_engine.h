@@ -0,0 +1,256 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file threefry_engine.h
+ *  \brief A counter-based pseudorandom number engine based on the Threefry
+ *         block cipher of Salmon et al.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/random/detail/counter_based_engine.h>
+#include <thrust/random/detail/random_core_access.h>
+
+#include <cuda/std/array>
+
+#include <cstddef> // for size_t
+#include <cstdint>
+#include <iostream>
+
+THRUST_NAMESPACE_BEGIN
+
+namespace random
+{
+
+/*! \addtogroup random_number_engine_templates
+ *  \{
+ */
+
+/*! \class threefry_engine
+ *  \brief A \p threefry_engine random number engine produces unsigned integer random numbers
+ *         by encrypting a counter with the Threefry block cipher, a variant of Threefish.
+ *
+ *         Like \p philox_engine, the <tt>i</tt>-th block of \p n results only depends on the key
+ *         and the counter <tt>i</tt>, so \p discard and \p set_counter take constant time and
+ *         \p thrust::random::generate_random fills a range with its results in parallel. Threefry
+ *         only uses additions, rotations and exclusive ors, which makes it the faster choice
+ *         where wide multiplications are expensive.
+ *
+ *  \tparam UIntType The type of unsigned integer to produce.
+ *  \tparam w The word size of the produced values, either \c 32 or \c 64.
+ *  \tparam n The number of words per block, either \c 2 or \c 4.
+ *  \tparam r The number of rounds of the cipher.
+ *
+ *  \note Inexperienced users should not use this class template directly.  Instead, use
+ *  \p threefry4x32 or \p threefry4x64.
+ *
+ *  \see thrust::random::threefry4x32
+ *  \see thrust::random::threefry4x64
+ *  \see thrust::random::philox_engine
+ *  \see thrust::random::generate_random
+ */
+template <typename UIntType, size_t w, size_t n, size_t r>
+class threefry_engine
+{
+  static_assert(n == 2 || n == 4, "threefry_engine only supports 2 or 4 words per block.");
+  static_assert((w == 32 || w == 64) && w <= sizeof(UIntType) * 8, "threefry_engine only supports 32 or 64 bit words.");
+
+public:
+  // types
+
+  /*! \typedef result_type
+   *  \brief The type of the unsigned integer produced by this \p threefry_engine.
+   */
+  using result_type = UIntType;
+
+  // engine characteristics
+
+  /*! The word size of the produced values.
+   */
+  static const size_t word_size = w;
+
+  /*! The number of words per block.
+   */
+  static const size_t word_count = n;
+
+  /*! The number of rounds of the cipher.
+   */
+  static const size_t round_count = r;
+
+  /*! The smallest value this \p threefry_engine may potentially produce.
+   */
+  static const result_type min = 0;
+
+  /*! The largest value this \p threefry_engine may potentially produce.
+   */
+  static const result_type max = detail::counter_based_engine_wordmask<result_type, w>::value;
+
+  /*! The default seed of this \p threefry_engine.
+   */
+  static const result_type default_seed = 20111115u;
+
+  // constructors and seeding functions
+
+  /*! This constructor, which optionally accepts a seed, initializes a new
+   *  \p threefry_engine.
+   *
+   *  \param value The seed used to intialize this \p threefry_engine's key.
+   */
+  _CCCL_HOST_DEVICE explicit threefry_engine(result_type value = default_seed);
+
+  /*! This method initializes this \p threefry_engine's key, resets its counter
+   *  to zero, and optionally accepts a seed value.
+   *
+   *  \param value The seed used to initializes this \p threefry_engine's key.
+   */
+  _CCCL_HOST_DEVICE void seed(result_type value = default_seed);
+
+  /*! This method sets this \p threefry_engine's counter, which selects the block
+   *  of results the next invocation starts from.
+   *
+   *  \param counter The words of the counter, most significant first.
+   */
+  _CCCL_HOST_DEVICE void set_counter(const ::cuda::std::array<result_type, n>& counter);
+
+  // generating functions
+
+  /*! This member function produces a new random value and updates this \p threefry_engine's state.
+   *  \return A new random number.
+   */
+  _CCCL_HOST_DEVICE result_type operator()(void);
+
+  /*! This member function advances this \p threefry_engine's state a given number of times
+   *  and discards the results.
+   *
+   *  \param z The number of random values to discard.
+   *  \note This function takes constant time.
+   */
+  _CCCL_HOST_DEVICE void discard(unsigned long long z);
+
+  /*! \cond
+   */
+
+private:
+  // the counter and the buffered block of results are stored least
+  // significant word first
+  result_type m_counter[n];
+  result_type m_key[n];
+  result_type m_results[n];
+  size_t m_index;
+
+  friend struct thrust::random::detail::random_core_access;
+
+  // encrypts lanes consecutive counters, the first of which is the counter
+  // of this threefry_engine plus block
+  template <size_t lanes>
+  _CCCL_HOST_DEVICE void generate_blocks(unsigned long long block, result_type (&results)[n][lanes]) const;
+
+  // the number of results that are left in the buffered block
+  _CCCL_HOST_DEVICE size_t buffered() const;
+
+  _CCCL_HOST_DEVICE bool equal(const threefry_engine& rhs) const;
+
+  template <typename CharT, typename Traits>
+  std::basic_ostream<CharT, Traits>& stream_out(std::basic_ostream<CharT, Traits>& os) const;
+
+  template <typename CharT, typename Traits>
+  std::basic_istream<CharT, Traits>& stream_in(std::basic_istream<CharT, Traits>& is);
+
+  /*! \endcond
+   */
+}; // end threefry_engine
+
+/*! This function checks two \p threefry_engines for equality.
+ *  \param lhs The first \p threefry_engine to test.
+ *  \param rhs The second \p threefry_engine to test.
+ *  \return \c true if \p lhs is equal to \p rhs; \c false, otherwise.
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_>
+_CCCL_HOST_DEVICE bool operator==(const threefry_engine<UIntType_, w_, n_, r_>& lhs,
+                                  const threefry_engine<UIntType_, w_, n_, r_>& rhs);
+
+/*! This function checks two \p threefry_engines for inequality.
+ *  \param lhs The first \p threefry_engine to test.
+ *  \param rhs The second \p threefry_engine to test.
+ *  \return \c true if \p lhs is not equal to \p rhs; \c false, otherwise.
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_>
+_CCCL_HOST_DEVICE bool operator!=(const threefry_engine<UIntType_, w_, n_, r_>& lhs,
+                                  const threefry_engine<UIntType_, w_, n_, r_>& rhs);
+
+/*! This function streams a threefry_engine to a \p std::basic_ostream.
+ *  \param os The \p basic_ostream to stream out to.
+ *  \param e The \p threefry_engine to stream out.
+ *  \return \p os
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, typename CharT, typename Traits>
+std::basic_ostream<CharT, Traits>&
+operator<<(std::basic_ostream<CharT, Traits>& os, const threefry_engine<UIntType_, w_, n_, r_>& e);
+
+/*! This function streams a threefry_engine in from a std::basic_istream.
+ *  \param is The \p basic_istream to stream from.
+ *  \param e The \p threefry_engine to stream in.
+ *  \return \p is
+ */
+template <typename UIntType_, size_t w_, size_t n_, size_t r_, typename CharT, typename Traits>
+std::basic_istream<CharT, Traits>&
+operator>>(std::basic_istream<CharT, Traits>& is, threefry_engine<UIntType_, w_, n_, r_>& e);
+
+/*! \} // end random_number_engine_templates
+ */
+
+/*! \addtogroup predefined_random
+ *  \{
+ */
+
+/*! \typedef threefry4x32
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Threefry4x32-20 counter-based random number generation algorithm.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p threefry4x32
+ *        shall produce the value \c 112810865 .
+ */
+using threefry4x32 = threefry_engine<std::uint32_t, 32, 4, 20>;
+
+/*! \typedef threefry4x64
+ *  \brief A random number engine with predefined parameters which implements the
+ *         Threefry4x64-20 counter-based random number generation algorithm.
+ *  \note The 10000th consecutive invocation of a default-constructed object of type \p threefry4x64
+ *        shall produce the value \c 9253438642465275567 .
+ */
+using threefry4x64 = threefry_engine<std::uint64_t, 64, 4, 20>;
+
+/*! \} // predefined_random
+ */
+
+} // namespace random
+
+// import names into thrust::
+using random::threefry4x32;
+using random::threefry4x64;
+using random::threefry_engine;
+
+THRUST_NAMESPACE_END
+
+#include <thrust/random/detail/threefry_engine.inl>
@@ -0,0 +1,1102 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file selection.h
+ *  \brief Finding the elements of a range which would come first if it were sorted
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+#include <thrust/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup algorithms
+ */
+
+/*! \addtogroup sorting
+ *  \ingroup algorithms
+ *  \{
+ */
+
+/*! \addtogroup selection
+ *  \ingroup sorting
+ *  \{
+ *
+ *  The selection algorithms find the elements which would come first if a
+ *  range were sorted, without sorting all of it. They narrow the range down
+ *  around splitters drawn from a sorted sample of it, which is linear work
+ *  instead of the <tt>O(N log N)</tt> of a sort.
+ */
+
+/*! \p nth_element rearranges the elements of <tt>[first, last)</tt> so that
+ *  \c *nth is the element which would be there if the range were sorted, no
+ *  element of <tt>[first, nth)</tt> is greater than \c *nth, and no element of
+ *  <tt>[nth, last)</tt> is less than it. The elements on either side of \p nth
+ *  are in no particular order.
+ *
+ *  This version of \p nth_element compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param nth The position of the element to find. If it is \p last, nothing is done.
+ *  \param last The end of the sequence.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>.
+ *
+ *  The following code snippet demonstrates how to use \p nth_element to find
+ *  the median of a sequence using the \p thrust::host execution policy for
+ *  parallelization:
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {5, 1, 4, 2, 7, 3, 6};
+ *  thrust::nth_element(thrust::host, A, A + N / 2, A + N);
+ *  // A[3] is now 4, A[0] through A[2] are {1, 2, 3} in some order,
+ *  // and A[4] through A[6] are {5, 6, 7} in some order
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/nth_element
+ *  \see \p partial_sort
+ *  \see \p sort
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void nth_element(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                                   RandomAccessIterator first,
+                                   RandomAccessIterator nth,
+                                   RandomAccessIterator last);
+
+/*! \p nth_element rearranges the elements of <tt>[first, last)</tt> so that
+ *  \c *nth is the element which would be there if the range were sorted, no
+ *  element of <tt>[first, nth)</tt> is greater than \c *nth, and no element of
+ *  <tt>[nth, last)</tt> is less than it. The elements on either side of \p nth
+ *  are in no particular order.
+ *
+ *  This version of \p nth_element compares objects using \c operator<.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param nth The position of the element to find. If it is \p last, nothing is done.
+ *  \param last The end of the sequence.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>.
+ *
+ *  The following code snippet demonstrates how to use \p nth_element to find
+ *  the median of a sequence.
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {5, 1, 4, 2, 7, 3, 6};
+ *  thrust::nth_element(A, A + N / 2, A + N);
+ *  // A[3] is now 4, A[0] through A[2] are {1, 2, 3} in some order,
+ *  // and A[4] through A[6] are {5, 6, 7} in some order
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/nth_element
+ *  \see \p partial_sort
+ *  \see \p sort
+ */
+template <typename RandomAccessIterator>
+void nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last);
+
+/*! \p nth_element rearranges the elements of <tt>[first, last)</tt> so that
+ *  \c *nth is the element which would be there if the range were sorted with
+ *  \p comp, no element \c x of <tt>[first, nth)</tt> has <tt>comp(*nth, x)</tt>,
+ *  and no element \c y of <tt>[nth, last)</tt> has <tt>comp(y, *nth)</tt>. The
+ *  elements on either side of \p nth are in no particular order.
+ *
+ *  This version of \p nth_element compares objects using a function object
+ *  \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param nth The position of the element to find. If it is \p last, nothing is done.
+ *  \param last The end of the sequence.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is convertible to \p
+ * StrictWeakOrdering's \c first_argument_type and \c second_argument_type. \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  The following code snippet demonstrates how to use \p nth_element to find
+ *  the second largest element of a sequence using the \p thrust::host
+ *  execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 4, 2, 8, 5, 7};
+ *  thrust::nth_element(thrust::host, A, A + 1, A + N, thrust::greater<int>());
+ *  // A[1] is now 7 and A[0] is 8
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/nth_element
+ *  \see \p partial_sort
+ *  \see \p sort
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void nth_element(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator nth,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp);
+
+/*! \p nth_element rearranges the elements of <tt>[first, last)</tt> so that
+ *  \c *nth is the element which would be there if the range were sorted with
+ *  \p comp, no element \c x of <tt>[first, nth)</tt> has <tt>comp(*nth, x)</tt>,
+ *  and no element \c y of <tt>[nth, last)</tt> has <tt>comp(y, *nth)</tt>. The
+ *  elements on either side of \p nth are in no particular order.
+ *
+ *  This version of \p nth_element compares objects using a function object
+ *  \p comp.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param nth The position of the element to find. If it is \p last, nothing is done.
+ *  \param last The end of the sequence.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is convertible to \p
+ * StrictWeakOrdering's \c first_argument_type and \c second_argument_type. \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  The following code snippet demonstrates how to use \p nth_element to find
+ *  the second largest element of a sequence.
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 4, 2, 8, 5, 7};
+ *  thrust::nth_element(A, A + 1, A + N, thrust::greater<int>());
+ *  // A[1] is now 7 and A[0] is 8
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/nth_element
+ *  \see \p partial_sort
+ *  \see \p sort
+ */
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+void nth_element(
+  RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last, StrictWeakOrdering comp);
+
+/*! \p partial_sort rearranges the elements of <tt>[first, last)</tt> so that
+ *  <tt>[first, middle)</tt> holds the <tt>middle - first</tt> smallest of them
+ *  in ascending order. The elements of <tt>[middle, last)</tt> are in no
+ *  particular order. Like \p sort, \p partial_sort is not stable.
+ *
+ *  This version of \p partial_sort compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param middle The end of the elements to sort.
+ *  \param last The end of the sequence.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort to sort
+ *  the three smallest elements of a sequence using the \p thrust::host
+ *  execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 4, 2, 8, 5, 7};
+ *  thrust::partial_sort(thrust::host, A, A + 3, A + N);
+ *  // A[0] through A[2] are now {1, 2, 4}
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/partial_sort
+ *  \see \p nth_element
+ *  \see \p partial_sort_copy
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void partial_sort(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+                                    RandomAccessIterator first,
+                                    RandomAccessIterator middle,
+                                    RandomAccessIterator last);
+
+/*! \p partial_sort rearranges the elements of <tt>[first, last)</tt> so that
+ *  <tt>[first, middle)</tt> holds the <tt>middle - first</tt> smallest of them
+ *  in ascending order. The elements of <tt>[middle, last)</tt> are in no
+ *  particular order. Like \p sort, \p partial_sort is not stable.
+ *
+ *  This version of \p partial_sort compares objects using \c operator<.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param middle The end of the elements to sort.
+ *  \param last The end of the sequence.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort to sort
+ *  the three smallest elements of a sequence.
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 4, 2, 8, 5, 7};
+ *  thrust::partial_sort(A, A + 3, A + N);
+ *  // A[0] through A[2] are now {1, 2, 4}
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/partial_sort
+ *  \see \p nth_element
+ *  \see \p partial_sort_copy
+ */
+template <typename RandomAccessIterator>
+void partial_sort(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last);
+
+/*! \p partial_sort rearranges the elements of <tt>[first, last)</tt> so that
+ *  <tt>[first, middle)</tt> holds the <tt>middle - first</tt> elements which
+ *  would come first if the range were sorted with \p comp, in that order. The
+ *  elements of <tt>[middle, last)</tt> are in no particular order. Like
+ *  \p sort, \p partial_sort is not stable.
+ *
+ *  This version of \p partial_sort compares objects using a function object
+ *  \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param middle The end of the elements to sort.
+ *  \param last The end of the sequence.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is convertible to \p
+ * StrictWeakOrdering's \c first_argument_type and \c second_argument_type. \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort to sort
+ *  the three largest elements of a sequence using the \p thrust::host
+ *  execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 4, 2, 8, 5, 7};
+ *  thrust::partial_sort(thrust::host, A, A + 3, A + N, thrust::greater<int>());
+ *  // A[0] through A[2] are now {8, 7, 5}
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/partial_sort
+ *  \see \p nth_element
+ *  \see \p partial_sort_copy
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void partial_sort(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator middle,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp);
+
+/*! \p partial_sort rearranges the elements of <tt>[first, last)</tt> so that
+ *  <tt>[first, middle)</tt> holds the <tt>middle - first</tt> elements which
+ *  would come first if the range were sorted with \p comp, in that order. The
+ *  elements of <tt>[middle, last)</tt> are in no particular order. Like
+ *  \p sort, \p partial_sort is not stable.
+ *
+ *  This version of \p partial_sort compares objects using a function object
+ *  \p comp.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param middle The end of the elements to sort.
+ *  \param last The end of the sequence.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>, \p
+ * RandomAccessIterator is mutable, and \p RandomAccessIterator's \c value_type is convertible to \p
+ * StrictWeakOrdering's \c first_argument_type and \c second_argument_type. \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort to sort
+ *  the three largest elements of a sequence.
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 4, 2, 8, 5, 7};
+ *  thrust::partial_sort(A, A + 3, A + N, thrust::greater<int>());
+ *  // A[0] through A[2] are now {8, 7, 5}
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/partial_sort
+ *  \see \p nth_element
+ *  \see \p partial_sort_copy
+ */
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+void partial_sort(
+  RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last, StrictWeakOrdering comp);
+
+/*! \p partial_sort_copy copies the smallest elements of <tt>[first, last)</tt>
+ *  to <tt>[result_first, result_last)</tt> in ascending order, as many as fit
+ *  or all of them if there are fewer. <tt>[first, last)</tt> is not modified.
+ *
+ *  This version of \p partial_sort_copy compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result_first The beginning of the output sequence.
+ *  \param result_last The end of the output sequence.
+ *  \return The end of the elements written, \p result_first plus the smaller of
+ *          <tt>last - first</tt> and <tt>result_last - result_first</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator1's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>. \tparam
+ * RandomAccessIterator2 is a mutable model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator1's \c value_type is convertible to \p RandomAccessIterator2's \c value_type.
+ *
+ *  \pre The ranges <tt>[first, last)</tt> and <tt>[result_first, result_last)</tt> shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort_copy to
+ *  copy the three smallest elements of a sequence using the \p thrust::host
+ *  execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 4, 2, 8, 5, 7};
+ *  int B[3];
+ *  thrust::partial_sort_copy(thrust::host, A, A + N, B, B + 3);
+ *  // B is now {1, 2, 4}
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/partial_sort_copy
+ *  \see \p partial_sort
+ *  \see \p top_k
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2>
+_CCCL_HOST_DEVICE RandomAccessIterator2 partial_sort_copy(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 result_first,
+  RandomAccessIterator2 result_last);
+
+/*! \p partial_sort_copy copies the smallest elements of <tt>[first, last)</tt>
+ *  to <tt>[result_first, result_last)</tt> in ascending order, as many as fit
+ *  or all of them if there are fewer. <tt>[first, last)</tt> is not modified.
+ *
+ *  This version of \p partial_sort_copy compares objects using \c operator<.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result_first The beginning of the output sequence.
+ *  \param result_last The end of the output sequence.
+ *  \return The end of the elements written, \p result_first plus the smaller of
+ *          <tt>last - first</tt> and <tt>result_last - result_first</tt>.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator1's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>. \tparam
+ * RandomAccessIterator2 is a mutable model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator1's \c value_type is convertible to \p RandomAccessIterator2's \c value_type.
+ *
+ *  \pre The ranges <tt>[first, last)</tt> and <tt>[result_first, result_last)</tt> shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort_copy to
+ *  copy the three smallest elements of a sequence.
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 4, 2, 8, 5, 7};
+ *  int B[3];
+ *  thrust::partial_sort_copy(A, A + N, B, B + 3);
+ *  // B is now {1, 2, 4}
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/partial_sort_copy
+ *  \see \p partial_sort
+ *  \see \p top_k
+ */
+template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+RandomAccessIterator2 partial_sort_copy(
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 result_first,
+  RandomAccessIterator2 result_last);
+
+/*! \p partial_sort_copy copies the elements of <tt>[first, last)</tt> which
+ *  would come first if it were sorted with \p comp to
+ *  <tt>[result_first, result_last)</tt>, in that order, as many as fit or all
+ *  of them if there are fewer. <tt>[first, last)</tt> is not modified.
+ *
+ *  This version of \p partial_sort_copy compares objects using a function
+ *  object \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result_first The beginning of the output sequence.
+ *  \param result_last The end of the output sequence.
+ *  \param comp Comparison operator.
+ *  \return The end of the elements written, \p result_first plus the smaller of
+ *          <tt>last - first</tt> and <tt>result_last - result_first</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator1's \c value_type is convertible to \p StrictWeakOrdering's \c first_argument_type and \c
+ * second_argument_type. \tparam RandomAccessIterator2 is a mutable model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator1's \c value_type is convertible to \p RandomAccessIterator2's \c value_type. \tparam
+ * StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak
+ * Ordering</a>.
+ *
+ *  \pre The ranges <tt>[first, last)</tt> and <tt>[result_first, result_last)</tt> shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort_copy to
+ *  copy the three largest elements of a sequence using the \p thrust::host
+ *  execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 4, 2, 8, 5, 7};
+ *  int B[3];
+ *  thrust::partial_sort_copy(thrust::host, A, A + N, B, B + 3, thrust::greater<int>());
+ *  // B is now {8, 7, 5}
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/partial_sort_copy
+ *  \see \p partial_sort
+ *  \see \p top_k
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE RandomAccessIterator2 partial_sort_copy(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 result_first,
+  RandomAccessIterator2 result_last,
+  StrictWeakOrdering comp);
+
+/*! \p partial_sort_copy copies the elements of <tt>[first, last)</tt> which
+ *  would come first if it were sorted with \p comp to
+ *  <tt>[result_first, result_last)</tt>, in that order, as many as fit or all
+ *  of them if there are fewer. <tt>[first, last)</tt> is not modified.
+ *
+ *  This version of \p partial_sort_copy compares objects using a function
+ *  object \p comp.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result_first The beginning of the output sequence.
+ *  \param result_last The end of the output sequence.
+ *  \param comp Comparison operator.
+ *  \return The end of the elements written, \p result_first plus the smaller of
+ *          <tt>last - first</tt> and <tt>result_last - result_first</tt>.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator1's \c value_type is convertible to \p StrictWeakOrdering's \c first_argument_type and \c
+ * second_argument_type. \tparam RandomAccessIterator2 is a mutable model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator1's \c value_type is convertible to \p RandomAccessIterator2's \c value_type. \tparam
+ * StrictWeakOrdering is a model of <a href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak
+ * Ordering</a>.
+ *
+ *  \pre The ranges <tt>[first, last)</tt> and <tt>[result_first, result_last)</tt> shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort_copy to
+ *  copy the three largest elements of a sequence.
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 4, 2, 8, 5, 7};
+ *  int B[3];
+ *  thrust::partial_sort_copy(A, A + N, B, B + 3, thrust::greater<int>());
+ *  // B is now {8, 7, 5}
+ *  \endcode
+ *
+ *  \see https://en.cppreference.com/w/cpp/algorithm/partial_sort_copy
+ *  \see \p partial_sort
+ *  \see \p top_k
+ */
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+RandomAccessIterator2 partial_sort_copy(
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 result_first,
+  RandomAccessIterator2 result_last,
+  StrictWeakOrdering comp);
+
+/*! \p top_k copies the \p k largest elements of <tt>[first, last)</tt> to
+ *  <tt>[result, result + k)</tt> in descending order, or all of them if there
+ *  are fewer. <tt>[first, last)</tt> is not modified.
+ *
+ *  This version of \p top_k compares objects using \c operator>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param k The number of elements to copy.
+ *  \param result The beginning of the output sequence.
+ *  \return The end of the elements written.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>. \tparam Size is an
+ * integral type. \tparam OutputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and \p RandomAccessIterator's
+ * \c value_type is convertible to \p OutputIterator's \c value_type.
+ *
+ *  \pre The ranges <tt>[first, last)</tt> and <tt>[result, result + k)</tt> shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p top_k to find the three
+ *  largest elements of a sequence using the \p thrust::host execution policy
+ *  for parallelization:
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 4, 2, 8, 5, 7};
+ *  int B[3];
+ *  thrust::top_k(thrust::host, A, A + N, 3, B);
+ *  // B is now {8, 7, 5}
+ *  \endcode
+ *
+ *  \see \p top_k_by_key
+ *  \see \p partial_sort_copy
+ */
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator
+top_k(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+      RandomAccessIterator first,
+      RandomAccessIterator last,
+      Size k,
+      OutputIterator result);
+
+/*! \p top_k copies the \p k largest elements of <tt>[first, last)</tt> to
+ *  <tt>[result, result + k)</tt> in descending order, or all of them if there
+ *  are fewer. <tt>[first, last)</tt> is not modified.
+ *
+ *  This version of \p top_k compares objects using \c operator>.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param k The number of elements to copy.
+ *  \param result The beginning of the output sequence.
+ *  \return The end of the elements written.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>. \tparam Size is an
+ * integral type. \tparam OutputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and \p RandomAccessIterator's
+ * \c value_type is convertible to \p OutputIterator's \c value_type.
+ *
+ *  \pre The ranges <tt>[first, last)</tt> and <tt>[result, result + k)</tt> shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p top_k to find the three
+ *  largest elements of a sequence.
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 4, 2, 8, 5, 7};
+ *  int B[3];
+ *  thrust::top_k(A, A + N, 3, B);
+ *  // B is now {8, 7, 5}
+ *  \endcode
+ *
+ *  \see \p top_k_by_key
+ *  \see \p partial_sort_copy
+ */
+template <typename RandomAccessIterator, typename Size, typename OutputIterator>
+OutputIterator top_k(RandomAccessIterator first, RandomAccessIterator last, Size k, OutputIterator result);
+
+/*! \p top_k copies the \p k elements of <tt>[first, last)</tt> which would come
+ *  first if it were sorted with \p comp to <tt>[result, result + k)</tt>, in
+ *  that order, or all of them if there are fewer. <tt>[first, last)</tt> is not
+ *  modified.
+ *
+ *  This version of \p top_k compares objects using a function object \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param k The number of elements to copy.
+ *  \param result The beginning of the output sequence.
+ *  \param comp Comparison operator.
+ *  \return The end of the elements written.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator's \c value_type is convertible to \p StrictWeakOrdering's \c first_argument_type and \c
+ * second_argument_type. \tparam Size is an integral type. \tparam OutputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and \p RandomAccessIterator's
+ * \c value_type is convertible to \p OutputIterator's \c value_type. \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The ranges <tt>[first, last)</tt> and <tt>[result, result + k)</tt> shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p top_k to find the three
+ *  smallest elements of a sequence using the \p thrust::host execution policy
+ *  for parallelization:
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 4, 2, 8, 5, 7};
+ *  int B[3];
+ *  thrust::top_k(thrust::host, A, A + N, 3, B, thrust::less<int>());
+ *  // B is now {1, 2, 4}
+ *  \endcode
+ *
+ *  \see \p top_k_by_key
+ *  \see \p partial_sort_copy
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename Size,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator
+top_k(const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+      RandomAccessIterator first,
+      RandomAccessIterator last,
+      Size k,
+      OutputIterator result,
+      StrictWeakOrdering comp);
+
+/*! \p top_k copies the \p k elements of <tt>[first, last)</tt> which would come
+ *  first if it were sorted with \p comp to <tt>[result, result + k)</tt>, in
+ *  that order, or all of them if there are fewer. <tt>[first, last)</tt> is not
+ *  modified.
+ *
+ *  This version of \p top_k compares objects using a function object \p comp.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param k The number of elements to copy.
+ *  \param result The beginning of the output sequence.
+ *  \param comp Comparison operator.
+ *  \return The end of the elements written.
+ *
+ *  \tparam RandomAccessIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator's \c value_type is convertible to \p StrictWeakOrdering's \c first_argument_type and \c
+ * second_argument_type. \tparam Size is an integral type. \tparam OutputIterator is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and \p RandomAccessIterator's
+ * \c value_type is convertible to \p OutputIterator's \c value_type. \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The ranges <tt>[first, last)</tt> and <tt>[result, result + k)</tt> shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p top_k to find the three
+ *  smallest elements of a sequence.
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 4, 2, 8, 5, 7};
+ *  int B[3];
+ *  thrust::top_k(A, A + N, 3, B, thrust::less<int>());
+ *  // B is now {1, 2, 4}
+ *  \endcode
+ *
+ *  \see \p top_k_by_key
+ *  \see \p partial_sort_copy
+ */
+template <typename RandomAccessIterator, typename Size, typename OutputIterator, typename StrictWeakOrdering>
+OutputIterator
+top_k(RandomAccessIterator first, RandomAccessIterator last, Size k, OutputIterator result, StrictWeakOrdering comp);
+
+/*! \p top_k_by_key copies the \p k largest keys of <tt>[keys_first, keys_last)</tt>
+ *  to <tt>[keys_result, keys_result + k)</tt> in descending order, or all of
+ *  them if there are fewer, and the values which go with them, those of
+ *  <tt>[values_first, values_first + (keys_last - keys_first))</tt>, to the
+ *  same positions of <tt>[values_result, values_result + k)</tt>. Of keys which
+ *  are equal, the ones which come first in the input are preferred and written
+ *  first. The inputs are not modified.
+ *
+ *  This version of \p top_k_by_key compares keys using \c operator>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the input keys.
+ *  \param keys_last The end of the input keys.
+ *  \param values_first The beginning of the input values.
+ *  \param k The number of keys and values to copy.
+ *  \param keys_result The beginning of the output keys.
+ *  \param values_result The beginning of the output values.
+ *  \return A \p pair of the ends of the keys and of the values written.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator1's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>. \tparam
+ * RandomAccessIterator2 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>. \tparam Size is
+ * an integral type. \tparam OutputIterator1 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and \p RandomAccessIterator1's
+ * \c value_type is convertible to \p OutputIterator1's \c value_type. \tparam OutputIterator2 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and \p RandomAccessIterator2's
+ * \c value_type is convertible to \p OutputIterator2's \c value_type.
+ *
+ *  \pre The output ranges shall not overlap either input range.
+ *
+ *  The following code snippet demonstrates how to use \p top_k_by_key to find
+ *  the two highest scores and their names using the \p thrust::host execution
+ *  policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 5;
+ *  int  scores[N] = {70, 95, 80, 95, 60};
+ *  char names[N]  = {'a', 'b', 'c', 'd', 'e'};
+ *  int  best_scores[2];
+ *  char best_names[2];
+ *  thrust::top_k_by_key(thrust::host, scores, scores + N, names, 2, best_scores, best_names);
+ *  // best_scores is now {95, 95} and best_names is {'b', 'd'}
+ *  \endcode
+ *
+ *  \see \p top_k
+ *  \see \p sort_by_key
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size,
+          typename OutputIterator1,
+          typename OutputIterator2>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> top_k_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  Size k,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result);
+
+/*! \p top_k_by_key copies the \p k largest keys of <tt>[keys_first, keys_last)</tt>
+ *  to <tt>[keys_result, keys_result + k)</tt> in descending order, or all of
+ *  them if there are fewer, and the values which go with them, those of
+ *  <tt>[values_first, values_first + (keys_last - keys_first))</tt>, to the
+ *  same positions of <tt>[values_result, values_result + k)</tt>. Of keys which
+ *  are equal, the ones which come first in the input are preferred and written
+ *  first. The inputs are not modified.
+ *
+ *  This version of \p top_k_by_key compares keys using \c operator>.
+ *
+ *  \param keys_first The beginning of the input keys.
+ *  \param keys_last The end of the input keys.
+ *  \param values_first The beginning of the input values.
+ *  \param k The number of keys and values to copy.
+ *  \param keys_result The beginning of the output keys.
+ *  \param values_result The beginning of the output values.
+ *  \return A \p pair of the ends of the keys and of the values written.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator1's \c value_type is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/totally_ordered">LessThan Comparable</a>. \tparam
+ * RandomAccessIterator2 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>. \tparam Size is
+ * an integral type. \tparam OutputIterator1 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and \p RandomAccessIterator1's
+ * \c value_type is convertible to \p OutputIterator1's \c value_type. \tparam OutputIterator2 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and \p RandomAccessIterator2's
+ * \c value_type is convertible to \p OutputIterator2's \c value_type.
+ *
+ *  \pre The output ranges shall not overlap either input range.
+ *
+ *  The following code snippet demonstrates how to use \p top_k_by_key to find
+ *  the two highest scores and their names.
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  ...
+ *  const int N = 5;
+ *  int  scores[N] = {70, 95, 80, 95, 60};
+ *  char names[N]  = {'a', 'b', 'c', 'd', 'e'};
+ *  int  best_scores[2];
+ *  char best_names[2];
+ *  thrust::top_k_by_key(scores, scores + N, names, 2, best_scores, best_names);
+ *  // best_scores is now {95, 95} and best_names is {'b', 'd'}
+ *  \endcode
+ *
+ *  \see \p top_k
+ *  \see \p sort_by_key
+ */
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size,
+          typename OutputIterator1,
+          typename OutputIterator2>
+thrust::pair<OutputIterator1, OutputIterator2> top_k_by_key(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  Size k,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result);
+
+/*! \p top_k_by_key copies the \p k keys of <tt>[keys_first, keys_last)</tt>
+ *  which would come first if they were sorted with \p comp to
+ *  <tt>[keys_result, keys_result + k)</tt>, in that order, or all of them if
+ *  there are fewer, and the values which go with them, those of
+ *  <tt>[values_first, values_first + (keys_last - keys_first))</tt>, to the
+ *  same positions of <tt>[values_result, values_result + k)</tt>. Of keys which
+ *  are equivalent, the ones which come first in the input are preferred and
+ *  written first. The inputs are not modified.
+ *
+ *  This version of \p top_k_by_key compares keys using a function object
+ *  \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the input keys.
+ *  \param keys_last The end of the input keys.
+ *  \param values_first The beginning of the input values.
+ *  \param k The number of keys and values to copy.
+ *  \param keys_result The beginning of the output keys.
+ *  \param values_result The beginning of the output values.
+ *  \param comp Comparison operator.
+ *  \return A \p pair of the ends of the keys and of the values written.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator1's \c value_type is convertible to \p StrictWeakOrdering's \c first_argument_type and \c
+ * second_argument_type. \tparam RandomAccessIterator2 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>. \tparam Size is
+ * an integral type. \tparam OutputIterator1 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and \p RandomAccessIterator1's
+ * \c value_type is convertible to \p OutputIterator1's \c value_type. \tparam OutputIterator2 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and \p RandomAccessIterator2's
+ * \c value_type is convertible to \p OutputIterator2's \c value_type. \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The output ranges shall not overlap either input range.
+ *
+ *  The following code snippet demonstrates how to use \p top_k_by_key to find
+ *  the two fastest times and their runners using the \p thrust::host execution
+ *  policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 4;
+ *  float times[N]   = {10.2f, 9.8f, 10.0f, 9.9f};
+ *  int   runners[N] = {1, 2, 3, 4};
+ *  float best_times[2];
+ *  int   best_runners[2];
+ *  thrust::top_k_by_key(thrust::host, times, times + N, runners, 2, best_times, best_runners, thrust::less<float>());
+ *  // best_times is now {9.8f, 9.9f} and best_runners is {2, 4}
+ *  \endcode
+ *
+ *  \see \p top_k
+ *  \see \p sort_by_key
+ */
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> top_k_by_key(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  Size k,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp);
+
+/*! \p top_k_by_key copies the \p k keys of <tt>[keys_first, keys_last)</tt>
+ *  which would come first if they were sorted with \p comp to
+ *  <tt>[keys_result, keys_result + k)</tt>, in that order, or all of them if
+ *  there are fewer, and the values which go with them, those of
+ *  <tt>[values_first, values_first + (keys_last - keys_first))</tt>, to the
+ *  same positions of <tt>[values_result, values_result + k)</tt>. Of keys which
+ *  are equivalent, the ones which come first in the input are preferred and
+ *  written first. The inputs are not modified.
+ *
+ *  This version of \p top_k_by_key compares keys using a function object
+ *  \p comp.
+ *
+ *  \param keys_first The beginning of the input keys.
+ *  \param keys_last The end of the input keys.
+ *  \param values_first The beginning of the input values.
+ *  \param k The number of keys and values to copy.
+ *  \param keys_result The beginning of the output keys.
+ *  \param values_result The beginning of the output values.
+ *  \param comp Comparison operator.
+ *  \return A \p pair of the ends of the keys and of the values written.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a> and \p
+ * RandomAccessIterator1's \c value_type is convertible to \p StrictWeakOrdering's \c first_argument_type and \c
+ * second_argument_type. \tparam RandomAccessIterator2 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>. \tparam Size is
+ * an integral type. \tparam OutputIterator1 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and \p RandomAccessIterator1's
+ * \c value_type is convertible to \p OutputIterator1's \c value_type. \tparam OutputIterator2 is a model of <a
+ * href="https://en.cppreference.com/w/cpp/iterator/output_iterator">Output Iterator</a> and \p RandomAccessIterator2's
+ * \c value_type is convertible to \p OutputIterator2's \c value_type. \tparam StrictWeakOrdering is a model of <a
+ * href="https://en.cppreference.com/w/cpp/concepts/strict_weak_order">Strict Weak Ordering</a>.
+ *
+ *  \pre The output ranges shall not overlap either input range.
+ *
+ *  The following code snippet demonstrates how to use \p top_k_by_key to find
+ *  the two fastest times and their runners.
+ *
+ *  \code
+ *  #include <thrust/selection.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 4;
+ *  float times[N]   = {10.2f, 9.8f, 10.0f, 9.9f};
+ *  int   runners[N] = {1, 2, 3, 4};
+ *  float best_times[2];
+ *  int   best_runners[2];
+ *  thrust::top_k_by_key(times, times + N, runners, 2, best_times, best_runners, thrust::less<float>());
+ *  // best_times is now {9.8f, 9.9f} and best_runners is {2, 4}
+ *  \endcode
+ *
+ *  \see \p top_k
+ *  \see \p sort_by_key
+ */
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+thrust::pair<OutputIterator1, OutputIterator2> top_k_by_key(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  Size k,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp);
+
+/*! \} // end selection
+ *  \} // end sorting
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/selection.inl>
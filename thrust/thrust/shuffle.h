@@ -45,7 +45,8 @@ THRUST_NAMESPACE_BEGIN
 /*! \p shuffle reorders the elements <tt>[first, last)</tt> by a uniform pseudorandom permutation, defined by
  *  random engine \p g.
  *
- *  The algorithm's execution is parallelized as determined by \p exec.
+ *  The algorithm's execution is parallelized as determined by \p exec. For a given state of \p g, all systems produce
+ *  the same permutation regardless of the number of threads they use.
  *
  *  \param exec The execution policy to use for parallelization.
  *  \param first The beginning of the sequence to shuffle.
@@ -108,7 +109,8 @@ _CCCL_HOST_DEVICE void shuffle(RandomIterator first, RandomIterator last, URBG&&
  *  \p shuffle_copy reorders the elements <tt>[first, last)</tt> by a uniform pseudorandom permutation, defined by
  *  random engine \p g.
  *
- *  The algorithm's execution is parallelized as determined by \p exec.
+ *  The algorithm's execution is parallelized as determined by \p exec. For a given state of \p g, all systems produce
+ *  the same permutation regardless of the number of threads they use.
 
  *  \param exec The execution policy to use for parallelization.
  *  \param first The beginning of the sequence to shuffle.
@@ -26,6 +26,7 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/cpp/detail/malloc_and_free.h>
+#include <thrust/system/cpp/detail/temporary_buffer.h>
 #include <thrust/system/cpp/memory.h>
 
 #include <limits>
@@ -55,6 +56,21 @@ void free(pointer<void> ptr)
   return thrust::system::detail::sequential::free(t, ptr);
 } // end free()
 
+void set_temporary_cache_limit(std::size_t bytes)
+{
+  detail::temporary_cache_limit().store(bytes, std::memory_order_relaxed);
+} // end set_temporary_cache_limit()
+
+std::size_t get_temporary_cache_limit()
+{
+  return detail::temporary_cache_limit().load(std::memory_order_relaxed);
+} // end get_temporary_cache_limit()
+
+void release_temporary_cache()
+{
+  detail::release_this_thread_temporary_cache();
+} // end release_temporary_cache()
+
 } // namespace cpp
 } // namespace system
 THRUST_NAMESPACE_END
@@ -25,5 +25,308 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/pointer.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/detail/type_traits/pointer_traits.h>
+#include <thrust/mr/new.h>
+#include <thrust/mr/pool_options.h>
+#include <thrust/pair.h>
+#include <thrust/system/cpp/detail/execution_policy.h>
+#include <thrust/system/detail/generic/temporary_buffer.h>
 
-// this system has no special temporary buffer functions
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+// the number of bytes of scratch memory a thread keeps for later algorithms once its algorithms have all returned
+#ifndef THRUST_CPP_TEMPORARY_CACHE_LIMIT
+#  define THRUST_CPP_TEMPORARY_CACHE_LIMIT (static_cast<std::size_t>(1) << 28)
+#endif
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+// the pool needs host_vector, and with it temporary_array; the headers that
+// get temporary buffers include it once those are complete
+template <typename Upstream, typename Bookkeeper>
+class disjoint_unsynchronized_pool_resource;
+
+} // namespace mr
+
+namespace system
+{
+namespace cpp
+{
+namespace detail
+{
+
+struct par_t;
+
+// whether the temporary storage of algorithms run with Policy comes from the cache of the calling thread; only the
+// policies of Thrust's host systems opt in, since a policy deriving from them may bring its own malloc and free
+template <typename Policy>
+struct caches_temporary_buffers : thrust::detail::false_type
+{};
+
+template <>
+struct caches_temporary_buffers<tag> : thrust::detail::true_type
+{};
+
+template <>
+struct caches_temporary_buffers<par_t> : thrust::detail::true_type
+{};
+
+// the scratch memory of a single thread: blocks returned to it are kept for the next algorithm the thread runs, and
+// trimmed to the cache limit whenever the thread has no temporary storage left outstanding
+//
+// get_temporary_buffer and return_temporary_buffer may be called from different threads, so every block records the
+// cache it came from in a header in front of it, and goes back to that cache under its lock. A cache outlives its
+// thread for as long as any of its blocks are outstanding.
+template <typename Upstream>
+class temporary_cache
+{
+  using pool_type = thrust::mr::disjoint_unsynchronized_pool_resource<Upstream, Upstream>;
+
+  struct block_header
+  {
+    temporary_cache* owner;
+  };
+
+  std::mutex m_mutex;
+  pool_type m_pool;
+  std::size_t m_outstanding;
+  bool m_orphaned;
+
+  static thrust::mr::pool_options options()
+  {
+    thrust::mr::pool_options ret = pool_type::get_default_options();
+
+    // carve only small blocks out of chunks, which hold at least 16 blocks and are only freed on release; anything
+    // bigger is cached block by block, and trimmed
+    ret.largest_block_size = static_cast<std::size_t>(1) << 16;
+
+    return ret;
+  }
+
+  // the header is padded to the alignment of the block behind it
+  static std::size_t header_size(std::size_t alignment)
+  {
+    return (sizeof(block_header) + alignment - 1) / alignment * alignment;
+  }
+
+  static block_header* header(void* p, std::size_t alignment)
+  {
+    return reinterpret_cast<block_header*>(static_cast<char*>(p) - header_size(alignment));
+  }
+
+  // returns whether the cache is to be deleted
+  bool deallocate_block(void* p, std::size_t bytes, std::size_t alignment, std::size_t limit)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_pool.deallocate(header(p, alignment), header_size(alignment) + bytes, alignment);
+
+    // the thread is idle as far as its algorithms are concerned
+    if (--m_outstanding == 0)
+    {
+      if (m_orphaned)
+      {
+        return true;
+      }
+
+      m_pool.trim(limit);
+    }
+
+    return false;
+  }
+
+public:
+  temporary_cache()
+      : m_pool(thrust::mr::get_global_resource<Upstream>(), thrust::mr::get_global_resource<Upstream>(), options())
+      , m_outstanding(0)
+      , m_orphaned(false)
+  {}
+
+  void* allocate(std::size_t bytes, std::size_t alignment)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    char* p = static_cast<char*>(m_pool.allocate(header_size(alignment) + bytes, alignment));
+    ++m_outstanding;
+
+    ::new (static_cast<void*>(p)) block_header{this};
+
+    return p + header_size(alignment);
+  }
+
+  // returns p to the cache of the thread which allocated it
+  static void deallocate(void* p, std::size_t bytes, std::size_t alignment, std::size_t limit)
+  {
+    temporary_cache* owner = header(p, alignment)->owner;
+
+    if (owner->deallocate_block(p, bytes, alignment, limit))
+    {
+      delete owner;
+    }
+  }
+
+  void release()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_outstanding == 0)
+    {
+      m_pool.release();
+    }
+    else
+    {
+      m_pool.trim(0);
+    }
+  }
+
+  // called as the thread exits: the cache is deleted now if none of its blocks are outstanding, and otherwise when the
+  // last of them is returned, since chunks in use can't be freed
+  static void orphan(temporary_cache* cache)
+  {
+    {
+      std::lock_guard<std::mutex> lock(cache->m_mutex);
+
+      if (cache->m_outstanding != 0)
+      {
+        cache->m_orphaned = true;
+        cache->m_pool.trim(0);
+        return;
+      }
+    }
+
+    delete cache;
+  }
+};
+
+template <typename Upstream>
+class thread_temporary_cache
+{
+  temporary_cache<Upstream>* m_cache;
+
+public:
+  thread_temporary_cache()
+      : m_cache(new temporary_cache<Upstream>())
+  {}
+
+  ~thread_temporary_cache()
+  {
+    temporary_cache<Upstream>::orphan(m_cache);
+  }
+
+  temporary_cache<Upstream>& get()
+  {
+    return *m_cache;
+  }
+};
+
+inline std::atomic<std::size_t>& temporary_cache_limit()
+{
+  static std::atomic<std::size_t> limit(THRUST_CPP_TEMPORARY_CACHE_LIMIT);
+  return limit;
+}
+
+template <typename Upstream = thrust::mr::new_delete_resource>
+temporary_cache<Upstream>& this_thread_temporary_cache()
+{
+  static thread_local thread_temporary_cache<Upstream> cache;
+  return cache.get();
+}
+
+template <typename Upstream = thrust::mr::new_delete_resource>
+void release_this_thread_temporary_cache()
+{
+  this_thread_temporary_cache<Upstream>().release();
+}
+
+namespace temporary_buffer_detail
+{
+
+template <typename T>
+constexpr std::size_t alignment()
+{
+  return alignof(T) > THRUST_MR_DEFAULT_ALIGNMENT ? alignof(T) : THRUST_MR_DEFAULT_ALIGNMENT;
+}
+
+template <typename T, typename DerivedPolicy>
+thrust::pair<thrust::pointer<T, DerivedPolicy>, typename thrust::pointer<T, DerivedPolicy>::difference_type>
+get_temporary_buffer(execution_policy<DerivedPolicy>& exec,
+                     typename thrust::pointer<T, DerivedPolicy>::difference_type n,
+                     thrust::detail::false_type) // caches_temporary_buffers
+{
+  return thrust::system::detail::generic::get_temporary_buffer<T>(exec, n);
+}
+
+template <typename T, typename DerivedPolicy, typename Upstream = thrust::mr::new_delete_resource>
+thrust::pair<thrust::pointer<T, DerivedPolicy>, typename thrust::pointer<T, DerivedPolicy>::difference_type>
+get_temporary_buffer(execution_policy<DerivedPolicy>&,
+                     typename thrust::pointer<T, DerivedPolicy>::difference_type n,
+                     thrust::detail::true_type) // caches_temporary_buffers
+{
+  T* ptr = nullptr;
+
+  // report a failed allocation the way malloc does
+  try
+  {
+    ptr = static_cast<T*>(this_thread_temporary_cache<Upstream>().allocate(sizeof(T) * n, alignment<T>()));
+  }
+  catch (const std::bad_alloc&)
+  {
+    n = 0;
+  }
+
+  return thrust::make_pair(thrust::pointer<T, DerivedPolicy>(ptr), n);
+}
+
+template <typename DerivedPolicy, typename Pointer>
+void return_temporary_buffer(execution_policy<DerivedPolicy>& exec,
+                             Pointer p,
+                             std::ptrdiff_t n,
+                             thrust::detail::false_type) // caches_temporary_buffers
+{
+  thrust::system::detail::generic::return_temporary_buffer(exec, p, n);
+}
+
+template <typename DerivedPolicy, typename Pointer, typename Upstream = thrust::mr::new_delete_resource>
+void return_temporary_buffer(
+  execution_policy<DerivedPolicy>&, Pointer p, std::ptrdiff_t n, thrust::detail::true_type) // caches_temporary_buffers
+{
+  using T = typename thrust::detail::pointer_traits<Pointer>::element_type;
+
+  void* ptr = thrust::raw_pointer_cast(p);
+
+  // a failed get_temporary_buffer is returned as well
+  if (ptr != nullptr)
+  {
+    temporary_cache<Upstream>::deallocate(
+      ptr, sizeof(T) * n, alignment<T>(), temporary_cache_limit().load(std::memory_order_relaxed));
+  }
+}
+
+} // namespace temporary_buffer_detail
+
+template <typename T, typename DerivedPolicy>
+thrust::pair<thrust::pointer<T, DerivedPolicy>, typename thrust::pointer<T, DerivedPolicy>::difference_type>
+get_temporary_buffer(execution_policy<DerivedPolicy>& exec,
+                     typename thrust::pointer<T, DerivedPolicy>::difference_type n)
+{
+  return temporary_buffer_detail::get_temporary_buffer<T>(exec, n, caches_temporary_buffers<DerivedPolicy>());
+}
+
+template <typename DerivedPolicy, typename Pointer>
+void return_temporary_buffer(execution_policy<DerivedPolicy>& exec, Pointer p, std::ptrdiff_t n)
+{
+  temporary_buffer_detail::return_temporary_buffer(exec, p, n, caches_temporary_buffers<DerivedPolicy>());
+}
+
+} // namespace detail
+} // namespace cpp
+} // namespace system
+THRUST_NAMESPACE_END
@@ -75,6 +75,39 @@ inline pointer<T> malloc(std::size_t n);
  */
 inline void free(pointer<void> ptr);
 
+/*! Algorithms of the <tt>cpp</tt>, <tt>omp</tt> and <tt>tbb</tt> systems take
+ *  their temporary storage from a cache private to the calling thread, so
+ *  that repeated calls don't allocate it anew. Once a thread's algorithms have
+ *  all returned their storage, the buffers of more than 64 KiB it keeps cached
+ *  are trimmed to this many bytes; smaller ones stay pooled until
+ *  \p release_temporary_cache. Passing \p 0 frees large buffers as soon as
+ *  the algorithm using them returns. The limit defaults to
+ *  \c THRUST_CPP_TEMPORARY_CACHE_LIMIT, 256 MiB unless defined otherwise.
+ *
+ *  A buffer may be returned on another thread than the one which got it, and
+ *  goes back to the cache of the latter, which outlives its thread until the
+ *  last of its buffers is returned.
+ *
+ *  Temporary storage obtained through an allocator, as with
+ *  <tt>thrust::cpp::par(alloc)</tt>, bypasses the cache.
+ *
+ *  \param bytes The number of bytes each thread may keep cached.
+ *  \note Other threads apply the new limit the next time they go idle.
+ *  \see release_temporary_cache
+ */
+inline void set_temporary_cache_limit(std::size_t bytes);
+
+/*! \return The number of bytes of temporary storage each thread may keep
+ *          cached once idle.
+ *  \see set_temporary_cache_limit
+ */
+inline std::size_t get_temporary_cache_limit();
+
+/*! Frees the cached temporary storage of the calling thread that isn't in use.
+ *  \see set_temporary_cache_limit
+ */
+inline void release_temporary_cache();
+
 /*! \p cpp::allocator is the default allocator used by the \p cpp system's
  *  containers such as <tt>cpp::vector</tt> if no user-specified allocator is
  *  provided. \p cpp::allocator allocates (deallocates) storage with \p
@@ -99,7 +132,10 @@ namespace cpp
 {
 using thrust::system::cpp::allocator;
 using thrust::system::cpp::free;
+using thrust::system::cpp::get_temporary_cache_limit;
 using thrust::system::cpp::malloc;
+using thrust::system::cpp::release_temporary_cache;
+using thrust::system::cpp::set_temporary_cache_limit;
 } // namespace cpp
 
 THRUST_NAMESPACE_END
@@ -0,0 +1,135 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/adjacent_difference.h>
+#include <thrust/binary_search.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/internal/histogram.h>
+#include <thrust/transform.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace histogram_detail
+{
+
+// Sorts the bins of the samples, then finds where each bin ends. Out of range
+// samples map to num_bins and sort behind all bins.
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator, typename BinIndex>
+_CCCL_HOST_DEVICE OutputIterator histogram_by_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator histogram,
+  int num_bins,
+  BinIndex bin_index)
+{
+  if (num_bins <= 0)
+  {
+    return histogram;
+  }
+
+  thrust::detail::temporary_array<int, DerivedPolicy> bins(exec, thrust::distance(first, last));
+
+  thrust::transform(exec, first, last, bins.begin(), bin_index);
+  thrust::sort(exec, bins.begin(), bins.end());
+
+  thrust::upper_bound(
+    exec,
+    bins.begin(),
+    bins.end(),
+    thrust::counting_iterator<int>(0),
+    thrust::counting_iterator<int>(num_bins),
+    histogram);
+  thrust::adjacent_difference(exec, histogram, histogram + num_bins, histogram);
+
+  return histogram + num_bins;
+}
+
+} // namespace histogram_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator, typename Level>
+_CCCL_HOST_DEVICE OutputIterator histogram_even(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  Level lower_level,
+  Level upper_level)
+{
+  const int num_bins = num_levels - 1;
+
+  if (num_bins <= 0)
+  {
+    return histogram;
+  }
+
+  return histogram_detail::histogram_by_sort(
+    exec,
+    first,
+    last,
+    histogram,
+    num_bins,
+    thrust::system::detail::internal::even_bin_index<Level>(lower_level, upper_level, num_bins));
+} // end histogram_even()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator histogram_range(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 levels_first,
+  RandomAccessIterator2 levels_last,
+  OutputIterator histogram)
+{
+  const int num_levels = static_cast<int>(thrust::distance(levels_first, levels_last));
+
+  return histogram_detail::histogram_by_sort(
+    exec,
+    first,
+    last,
+    histogram,
+    num_levels - 1,
+    thrust::system::detail::internal::range_bin_index<RandomAccessIterator2>{levels_first, num_levels});
+} // end histogram_range()
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
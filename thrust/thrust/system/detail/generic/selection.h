@@ -0,0 +1,145 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/pair.h>
+#include <thrust/system/detail/generic/tag.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+
+template <typename DerivedPolicy, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void nth_element(thrust::execution_policy<DerivedPolicy>& exec,
+                                   RandomAccessIterator first,
+                                   RandomAccessIterator nth,
+                                   RandomAccessIterator last);
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void nth_element(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator nth,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp);
+
+template <typename DerivedPolicy, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void partial_sort(thrust::execution_policy<DerivedPolicy>& exec,
+                                    RandomAccessIterator first,
+                                    RandomAccessIterator middle,
+                                    RandomAccessIterator last);
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void partial_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator middle,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp);
+
+template <typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2>
+_CCCL_HOST_DEVICE RandomAccessIterator2 partial_sort_copy(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 result_first,
+  RandomAccessIterator2 result_last);
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE RandomAccessIterator2 partial_sort_copy(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 result_first,
+  RandomAccessIterator2 result_last,
+  StrictWeakOrdering comp);
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator top_k(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  Size k,
+  OutputIterator result);
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename Size,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator top_k(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  Size k,
+  OutputIterator result,
+  StrictWeakOrdering comp);
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size,
+          typename OutputIterator1,
+          typename OutputIterator2>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> top_k_by_key(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  Size k,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result);
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> top_k_by_key(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  Size k,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp);
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
+#include <thrust/system/detail/generic/selection.inl>
@@ -0,0 +1,572 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/reverse_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/partition.h>
+#include <thrust/selection.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/generic/selection.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace selection_detail
+{
+
+// ranges this short are sorted rather than narrowed down further
+constexpr int sort_cutoff = 1 << 12;
+
+template <typename Size>
+_CCCL_HOST_DEVICE Size isqrt(Size n)
+{
+  Size x = n;
+  Size y = (x + 1) / 2;
+
+  while (y < x)
+  {
+    x = y;
+    y = (x + n / x) / 2;
+  }
+
+  return x;
+}
+
+// The position of the i-th sample, somewhere in the i-th stride of the range.
+// Where in its stride varies from sample to sample, so that inputs which
+// repeat with the period of the stride are not sampled at a single phase.
+template <typename Size>
+struct sample_position
+{
+  Size stride;
+
+  _CCCL_HOST_DEVICE Size operator()(Size i) const
+  {
+    unsigned long long h = static_cast<unsigned long long>(i) * 0x9E3779B97F4A7C15ull;
+    h ^= h >> 32;
+
+    return i * stride + static_cast<Size>(h % static_cast<unsigned long long>(stride));
+  }
+};
+
+// fills samples with elements from every stride of the range starting at
+// first, in order
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename Size,
+          typename SampleArray,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void sorted_samples(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  Size stride,
+  SampleArray& samples,
+  StrictWeakOrdering comp)
+{
+  const Size num_samples = static_cast<Size>(samples.size());
+
+  thrust::gather(
+    exec,
+    thrust::make_transform_iterator(thrust::counting_iterator<Size>(0), sample_position<Size>{stride}),
+    thrust::make_transform_iterator(thrust::counting_iterator<Size>(num_samples), sample_position<Size>{stride}),
+    first,
+    samples.begin());
+
+  thrust::sort(exec, samples.begin(), samples.end(), comp);
+}
+
+template <typename T, typename StrictWeakOrdering>
+struct below_splitter
+{
+  T splitter;
+  StrictWeakOrdering comp;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename U>
+  _CCCL_HOST_DEVICE bool operator()(const U& x)
+  {
+    return comp(x, splitter);
+  }
+};
+
+template <typename T, typename StrictWeakOrdering>
+struct not_above_splitter
+{
+  T splitter;
+  StrictWeakOrdering comp;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename U>
+  _CCCL_HOST_DEVICE bool operator()(const U& x)
+  {
+    return !comp(splitter, x);
+  }
+};
+
+// orders the positions of keys by the keys, and equivalent keys by position
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+struct compare_positions_by_key
+{
+  RandomAccessIterator keys;
+  StrictWeakOrdering comp;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename Index>
+  _CCCL_HOST_DEVICE bool operator()(Index a, Index b)
+  {
+    if (comp(keys[a], keys[b]))
+    {
+      return true;
+    }
+
+    if (comp(keys[b], keys[a]))
+    {
+      return false;
+    }
+
+    return a < b;
+  }
+};
+
+// Draws a splitter from a sorted sample of the n elements at first, a little
+// past where the count-th of them falls in it, so that most likely at least
+// count elements are not above it.
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE typename thrust::iterator_value<RandomAccessIterator>::type candidate_splitter(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  Size n,
+  Size count,
+  StrictWeakOrdering comp)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  const Size sqrt_n      = isqrt(n);
+  const Size num_samples = 8 * sqrt_n < n ? 8 * sqrt_n : n;
+  const Size stride      = n / num_samples;
+
+  thrust::detail::temporary_array<value_type, DerivedPolicy> samples(exec, num_samples);
+  sorted_samples(exec, first, stride, samples, comp);
+
+  // the count-th element's rank in the sample is within a few standard
+  // deviations, which are at most half the root of its size, of this
+  const Size center   = count / stride;
+  const Size margin   = 2 * isqrt(num_samples) + 1;
+  const Size position = center + margin < num_samples ? center + margin : num_samples - 1;
+
+  return samples[position];
+}
+
+// Copies the k elements of [first, last) which come first under comp, in that
+// order, to result. When k is small next to the range, only the elements not
+// above a splitter drawn from a sample, a little past where the kth element
+// falls in it, are copied and sorted. Should the splitter fall short of the
+// kth element, or leave too many behind, the whole range is copied instead.
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename Size,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator sorted_selection_copy(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  Size k,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  using value_type      = typename thrust::iterator_value<RandomAccessIterator>::type;
+  using difference_type = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  const difference_type n     = thrust::distance(first, last);
+  const difference_type count = static_cast<difference_type>(k) < n ? static_cast<difference_type>(k) : n;
+
+  if (count <= 0)
+  {
+    return result;
+  }
+
+  if (n > sort_cutoff && count <= n / 4)
+  {
+    const not_above_splitter<value_type, StrictWeakOrdering> is_candidate{
+      candidate_splitter(exec, first, n, count, comp), comp};
+
+    const difference_type num_candidates = thrust::count_if(exec, first, last, is_candidate);
+
+    if (num_candidates >= count && num_candidates <= n / 2)
+    {
+      thrust::detail::temporary_array<value_type, DerivedPolicy> candidates(exec, num_candidates);
+      thrust::copy_if(exec, first, last, candidates.begin(), is_candidate);
+
+      thrust::partial_sort(exec, candidates.begin(), candidates.begin() + count, candidates.end(), comp);
+
+      return thrust::copy(exec, candidates.begin(), candidates.begin() + count, result);
+    }
+  }
+
+  thrust::detail::temporary_array<value_type, DerivedPolicy> copies(exec, first, last);
+
+  thrust::partial_sort(exec, copies.begin(), copies.begin() + count, copies.end(), comp);
+
+  return thrust::copy(exec, copies.begin(), copies.begin() + count, result);
+}
+
+} // end namespace selection_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void nth_element(thrust::execution_policy<DerivedPolicy>& exec,
+                                   RandomAccessIterator first,
+                                   RandomAccessIterator nth,
+                                   RandomAccessIterator last)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+  thrust::nth_element(exec, first, nth, last, thrust::less<value_type>());
+} // end nth_element()
+
+// Narrows the range down to the elements between two splitters drawn from a
+// sorted sample, on either side of where the nth element falls in it, until
+// what is left is short enough to sort. Each round partitions what is left
+// of the range twice, through a buffer which all rounds share, and leaves a
+// part of it which shrinks with the square root of the size of the sample,
+// so the work is linear in the length of the range rather than that of a
+// sort.
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void nth_element(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator nth,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+  using Size       = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  Size n = thrust::distance(first, last);
+  Size k = thrust::distance(first, nth);
+
+  if (k >= n)
+  {
+    return;
+  }
+
+  if (n <= selection_detail::sort_cutoff)
+  {
+    thrust::sort(exec, first, first + n, comp);
+    return;
+  }
+
+  // holds the elements below the lower splitter, and behind them in reverse
+  // the others, while the latter are partitioned back into the range
+  thrust::detail::temporary_array<value_type, DerivedPolicy> buffer(exec, n);
+
+  // after a round which left the whole range between its splitters, the next
+  // one splits around a single element
+  bool single_splitter = false;
+
+  while (n > selection_detail::sort_cutoff)
+  {
+    const Size sqrt_n      = selection_detail::isqrt(n);
+    const Size num_samples = 8 * sqrt_n < n ? 8 * sqrt_n : n;
+    const Size stride      = n / num_samples;
+
+    thrust::detail::temporary_array<value_type, DerivedPolicy> samples(exec, num_samples);
+    selection_detail::sorted_samples(exec, first, stride, samples, comp);
+
+    // the nth element's rank in the sample is within a few standard
+    // deviations, which are at most half the root of its size, of this
+    const Size center = k / stride < num_samples ? k / stride : num_samples - 1;
+    const Size margin = single_splitter ? 0 : 2 * selection_detail::isqrt(num_samples) + 1;
+
+    const value_type lo = samples[center > margin ? center - margin : 0];
+    const value_type hi = samples[center + margin < num_samples ? center + margin : num_samples - 1];
+
+    const auto buffer_first = buffer.begin();
+    const auto buffer_last  = buffer.begin() + n;
+
+    const auto below_last =
+      thrust::partition_copy(
+        exec,
+        first,
+        first + n,
+        buffer_first,
+        thrust::make_reverse_iterator(buffer_last),
+        selection_detail::below_splitter<value_type, StrictWeakOrdering>{lo, comp})
+        .first;
+
+    const Size num_below = below_last - buffer_first;
+
+    const RandomAccessIterator middle_first = first + num_below;
+    const RandomAccessIterator middle_last =
+      thrust::partition_copy(
+        exec,
+        below_last,
+        buffer_last,
+        middle_first,
+        thrust::make_reverse_iterator(first + n),
+        selection_detail::not_above_splitter<value_type, StrictWeakOrdering>{hi, comp})
+        .first;
+
+    thrust::copy(exec, buffer_first, below_last, first);
+
+    const Size num_middle = middle_last - middle_first;
+
+    // the splitters are elements of the range between them, so the parts
+    // below and above them are always shorter than the range
+    if (k < num_below)
+    {
+      n               = num_below;
+      single_splitter = false;
+    }
+    else if (k >= num_below + num_middle)
+    {
+      first = middle_last;
+      k -= num_below + num_middle;
+      n -= num_below + num_middle;
+      single_splitter = false;
+    }
+    else if (single_splitter)
+    {
+      // the middle is every element equivalent to the splitter
+      return;
+    }
+    else
+    {
+      single_splitter = num_middle == n;
+      first           = middle_first;
+      k -= num_below;
+      n = num_middle;
+    }
+  }
+
+  thrust::sort(exec, first, first + n, comp);
+} // end nth_element()
+
+template <typename DerivedPolicy, typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void partial_sort(thrust::execution_policy<DerivedPolicy>& exec,
+                                    RandomAccessIterator first,
+                                    RandomAccessIterator middle,
+                                    RandomAccessIterator last)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+  thrust::partial_sort(exec, first, middle, last, thrust::less<value_type>());
+} // end partial_sort()
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void partial_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator middle,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp)
+{
+  if (first == middle)
+  {
+    return;
+  }
+
+  // the elements before the one which belongs at middle are those to sort
+  if (middle != last)
+  {
+    thrust::nth_element(exec, first, middle, last, comp);
+  }
+
+  thrust::sort(exec, first, middle, comp);
+} // end partial_sort()
+
+template <typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2>
+_CCCL_HOST_DEVICE RandomAccessIterator2 partial_sort_copy(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 result_first,
+  RandomAccessIterator2 result_last)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  return thrust::partial_sort_copy(exec, first, last, result_first, result_last, thrust::less<value_type>());
+} // end partial_sort_copy()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE RandomAccessIterator2 partial_sort_copy(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 result_first,
+  RandomAccessIterator2 result_last,
+  StrictWeakOrdering comp)
+{
+  return selection_detail::sorted_selection_copy(
+    exec, first, last, thrust::distance(result_first, result_last), result_first, comp);
+} // end partial_sort_copy()
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator top_k(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  Size k,
+  OutputIterator result)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+  return thrust::top_k(exec, first, last, k, result, thrust::greater<value_type>());
+} // end top_k()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename Size,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE OutputIterator top_k(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  Size k,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return selection_detail::sorted_selection_copy(exec, first, last, k, result, comp);
+} // end top_k()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size,
+          typename OutputIterator1,
+          typename OutputIterator2>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> top_k_by_key(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  Size k,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result)
+{
+  using key_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  return thrust::top_k_by_key(
+    exec, keys_first, keys_last, values_first, k, keys_result, values_result, thrust::greater<key_type>());
+} // end top_k_by_key()
+
+// Selects the positions of the keys, which go with both the keys and the
+// values, and breaks ties between equivalent keys by position so that the
+// earliest are preferred. When k is small next to the range, only the keys
+// not above a sampled splitter are copied along with their positions, as in
+// top_k, and sorted stably, which keeps equivalent keys in input order.
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE thrust::pair<OutputIterator1, OutputIterator2> top_k_by_key(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  Size k,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp)
+{
+  using key_type        = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using difference_type = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+
+  const difference_type n     = thrust::distance(keys_first, keys_last);
+  const difference_type count = static_cast<difference_type>(k) < n ? static_cast<difference_type>(k) : n;
+
+  if (count <= 0)
+  {
+    return thrust::make_pair(keys_result, values_result);
+  }
+
+  if (n > selection_detail::sort_cutoff && count <= n / 4)
+  {
+    const selection_detail::not_above_splitter<key_type, StrictWeakOrdering> is_candidate{
+      selection_detail::candidate_splitter(exec, keys_first, n, count, comp), comp};
+
+    const difference_type num_candidates = thrust::count_if(exec, keys_first, keys_last, is_candidate);
+
+    if (num_candidates >= count && num_candidates <= n / 2)
+    {
+      thrust::detail::temporary_array<key_type, DerivedPolicy> candidate_keys(exec, num_candidates);
+      thrust::detail::temporary_array<difference_type, DerivedPolicy> candidate_positions(exec, num_candidates);
+
+      thrust::copy_if(
+        exec,
+        thrust::make_zip_iterator(keys_first, thrust::counting_iterator<difference_type>(0)),
+        thrust::make_zip_iterator(keys_last, thrust::counting_iterator<difference_type>(n)),
+        keys_first,
+        thrust::make_zip_iterator(candidate_keys.begin(), candidate_positions.begin()),
+        is_candidate);
+
+      thrust::stable_sort_by_key(exec, candidate_keys.begin(), candidate_keys.end(), candidate_positions.begin(), comp);
+
+      keys_result = thrust::copy(exec, candidate_keys.begin(), candidate_keys.begin() + count, keys_result);
+      values_result = thrust::gather(
+        exec, candidate_positions.begin(), candidate_positions.begin() + count, values_first, values_result);
+
+      return thrust::make_pair(keys_result, values_result);
+    }
+  }
+
+  thrust::detail::temporary_array<difference_type, DerivedPolicy> positions(exec, n);
+  thrust::sequence(exec, positions.begin(), positions.end());
+
+  thrust::partial_sort(
+    exec,
+    positions.begin(),
+    positions.begin() + count,
+    positions.end(),
+    selection_detail::compare_positions_by_key<RandomAccessIterator1, StrictWeakOrdering>{keys_first, comp});
+
+  keys_result   = thrust::gather(exec, positions.begin(), positions.begin() + count, keys_first, keys_result);
+  values_result = thrust::gather(exec, positions.begin(), positions.begin() + count, values_first, values_result);
+
+  return thrust::make_pair(keys_result, values_result);
+} // end top_k_by_key()
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
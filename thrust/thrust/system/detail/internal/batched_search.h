@@ -0,0 +1,267 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// The searches batched_search performs. Each says which elements of the
+// haystack come before the boundary it looks for, and what it writes for a
+// query once the boundary is found.
+struct lower_bound_search
+{
+  template <typename Compare, typename T, typename U>
+  bool before(Compare& comp, const T& element, const U& query) const
+  {
+    return comp(element, query);
+  }
+
+  template <typename RandomAccessIterator, typename Size, typename Compare, typename U>
+  Size result(RandomAccessIterator, Size, Size pos, Compare&, const U&) const
+  {
+    return pos;
+  }
+};
+
+struct upper_bound_search
+{
+  template <typename Compare, typename T, typename U>
+  bool before(Compare& comp, const T& element, const U& query) const
+  {
+    return !comp(query, element);
+  }
+
+  template <typename RandomAccessIterator, typename Size, typename Compare, typename U>
+  Size result(RandomAccessIterator, Size, Size pos, Compare&, const U&) const
+  {
+    return pos;
+  }
+};
+
+struct binary_search_search
+{
+  template <typename Compare, typename T, typename U>
+  bool before(Compare& comp, const T& element, const U& query) const
+  {
+    return comp(element, query);
+  }
+
+  template <typename RandomAccessIterator, typename Size, typename Compare, typename U>
+  bool result(RandomAccessIterator first, Size n, Size pos, Compare& comp, const U& query) const
+  {
+    return pos != n && !comp(query, first[pos]);
+  }
+};
+
+// Hints that the element at p is about to be read. The haystack is only
+// unwrapped to a pointer when it is contiguous, so other iterators are left
+// alone.
+template <typename Iterator>
+void prefetch(Iterator)
+{}
+
+template <typename T>
+void prefetch(T* p)
+{
+#if defined(_CCCL_COMPILER_GCC) || defined(_CCCL_COMPILER_CLANG)
+  __builtin_prefetch(p);
+#else
+  (void) p;
+#endif
+}
+
+// Returns the number of the n elements at first that come before the
+// boundary of query. Every step keeps one half of the range or the other
+// without branching on the comparison, so the steps do not stall on
+// mispredictions.
+template <typename RandomAccessIterator, typename Size, typename T, typename Compare, typename Search>
+Size branchless_search(RandomAccessIterator first, Size n, const T& query, Compare& comp, Search search)
+{
+  if (n == 0)
+  {
+    return 0;
+  }
+
+  Size base = 0;
+
+  while (n > 1)
+  {
+    const Size half = n / 2;
+    base            = search.before(comp, first[base + half], query) ? base + half : base;
+    n -= half;
+  }
+
+  return base + (search.before(comp, first[base], query) ? 1 : 0);
+}
+
+// Searches for the count queries at values[begin] in lockstep. As they share
+// the length of the range left at every step, the loads of all of them, and
+// the prefetches of the elements either of their next steps reads, are in
+// flight at once.
+template <int GroupSize,
+          typename RandomAccessIterator1,
+          typename Size,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename Compare,
+          typename Search>
+void search_group(RandomAccessIterator1 first,
+                  Size n,
+                  RandomAccessIterator2 values,
+                  Size begin,
+                  Size count,
+                  RandomAccessIterator3 output,
+                  Compare& comp,
+                  Search search)
+{
+  Size base[GroupSize];
+
+  for (Size g = 0; g < count; ++g)
+  {
+    base[g] = 0;
+  }
+
+  for (Size len = n; len > 1;)
+  {
+    const Size half = len / 2;
+    const Size next = (len - half) / 2;
+
+    for (Size g = 0; g < count; ++g)
+    {
+      prefetch(first + (base[g] + next));
+      prefetch(first + (base[g] + half + next));
+    }
+
+    for (Size g = 0; g < count; ++g)
+    {
+      base[g] = search.before(comp, first[base[g] + half], values[begin + g]) ? base[g] + half : base[g];
+    }
+
+    len -= half;
+  }
+
+  for (Size g = 0; g < count; ++g)
+  {
+    const Size pos = n == 0 ? 0 : base[g] + (search.before(comp, first[base[g]], values[begin + g]) ? 1 : 0);
+
+    output[begin + g] = search.result(first, n, pos, comp, values[begin + g]);
+  }
+}
+
+// Searches for the queries at values[begin] onwards for as long as their
+// boundaries do not come earlier than those before them, galloping from each
+// boundary to the next, which merges sorted queries into the haystack in time
+// proportional to the gaps between them. Returns the first query it left out.
+template <typename RandomAccessIterator1,
+          typename Size,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename Compare,
+          typename Search>
+Size merge_search(RandomAccessIterator1 first,
+                  Size n,
+                  RandomAccessIterator2 values,
+                  Size begin,
+                  Size end,
+                  RandomAccessIterator3 output,
+                  Compare& comp,
+                  Search search)
+{
+  Size pos = 0;
+
+  for (Size i = begin; i < end; ++i)
+  {
+    // the boundary of the query is at pos or after it only if the element
+    // before pos still comes before it
+    if (pos > 0 && !search.before(comp, first[pos - 1], values[i]))
+    {
+      return i;
+    }
+
+    Size lo   = pos;
+    Size hi   = pos;
+    Size step = 1;
+
+    while (hi < n && search.before(comp, first[hi], values[i]))
+    {
+      lo = hi + 1;
+      hi += step;
+      step *= 2;
+    }
+
+    hi  = hi < n ? hi : n;
+    pos = lo + branchless_search(first + lo, hi - lo, values[i], comp, search);
+
+    output[i] = search.result(first, n, pos, comp, values[i]);
+  }
+
+  return end;
+}
+
+// Writes the result of search for each of the queries values[begin, end) in
+// the n sorted elements at first to the same position of output.
+template <typename RandomAccessIterator1,
+          typename Size,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename StrictWeakOrdering,
+          typename Search>
+void batched_search(RandomAccessIterator1 first,
+                    Size n,
+                    RandomAccessIterator2 values,
+                    Size begin,
+                    Size end,
+                    RandomAccessIterator3 output,
+                    StrictWeakOrdering comp,
+                    Search search)
+{
+  constexpr int group_size = 8;
+
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  // queries that arrive in order are merged, and the rest are searched for a
+  // group at a time
+  begin = internal::merge_search(first, n, values, begin, end, output, wrapped_comp, search);
+
+  for (; begin < end; begin += group_size)
+  {
+    const Size count = end - begin < group_size ? end - begin : Size(group_size);
+
+    internal::search_group<group_size>(first, n, values, begin, count, output, wrapped_comp, search);
+  }
+}
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
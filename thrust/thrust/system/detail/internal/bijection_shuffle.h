@@ -0,0 +1,133 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file bijection_shuffle.h
+ *  \brief The permutation of the generic shuffle, computed in tiles by the
+ *         host backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/shuffle.h>
+
+#include <cstddef>
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// The generic shuffle walks the indices [0, size()) of a Feistel bijection
+// over the next power of two of the input, and appends the element each index
+// maps to, unless it maps past the end. Walking a tile of the indices twice,
+// once to count the elements it appends and once to write them behind those
+// of the previous tiles, gives the same permutation, and thus the same result
+// on every system for a given state of the engine, without the scan over the
+// padded range.
+class bijection_shuffle
+{
+public:
+  template <typename URBG>
+  _CCCL_HOST_DEVICE bijection_shuffle(std::uint64_t n, URBG& g)
+      : m_n(n)
+      , m_bijection(n, g)
+  {}
+
+  // the number of indices to walk
+  _CCCL_HOST_DEVICE std::uint64_t size() const
+  {
+    return m_bijection.nearest_power_of_two();
+  }
+
+  // the number of elements the indices [begin, end) append
+  _CCCL_HOST_DEVICE std::uint64_t count_tile(std::uint64_t begin, std::uint64_t end) const
+  {
+    std::uint64_t count = 0;
+
+    for (std::uint64_t i = begin; i < end; ++i)
+    {
+      count += m_bijection(i) < m_n ? 1 : 0;
+    }
+
+    return count;
+  }
+
+  // appends the elements of first the indices [begin, end) map to at
+  // result + offset
+  //
+  // The indices are mapped a batch at a time before any element is gathered,
+  // so that the loads of a batch, which mostly miss the cache, overlap.
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename RandomAccessIterator, typename OutputIterator>
+  _CCCL_HOST_DEVICE void scatter_tile(
+    RandomAccessIterator first, std::uint64_t begin, std::uint64_t end, OutputIterator result, std::uint64_t offset)
+    const
+  {
+    using InputSize  = typename thrust::iterator_difference<RandomAccessIterator>::type;
+    using OutputSize = typename thrust::iterator_difference<OutputIterator>::type;
+
+    constexpr int batch_size = 64;
+    std::uint64_t batch[batch_size];
+
+    result += static_cast<OutputSize>(offset);
+
+    while (begin < end)
+    {
+      const std::uint64_t batch_end = end - begin < batch_size ? end : begin + batch_size;
+
+      int count = 0;
+      for (; begin < batch_end; ++begin)
+      {
+        const std::uint64_t j = m_bijection(begin);
+
+        if (j < m_n)
+        {
+          batch[count++] = j;
+        }
+      }
+
+      for (int k = 0; k < count; ++k)
+      {
+        *result = first[static_cast<InputSize>(batch[k])];
+        ++result;
+      }
+    }
+  }
+
+private:
+  std::uint64_t m_n;
+  thrust::system::detail::generic::feistel_bijection m_bijection;
+};
+
+} // namespace internal
+} // namespace detail
+} // namespace system
+THRUST_NAMESPACE_END
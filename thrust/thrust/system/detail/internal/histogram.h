@@ -0,0 +1,210 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file histogram.h
+ *  \brief Mapping of samples to histogram bins and sequential counting of a
+ *         single tile, shared by the histogram implementations.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/raw_reference_cast.h>
+
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// Bin mappings return the bin of a sample, or num_bins for samples outside of
+// the histogram, so that out of range samples sort behind all others.
+
+// num_bins evenly spaced bins covering [lower, upper). Integral levels compute
+// bins exactly as (sample - lower) * num_bins / (upper - lower), like
+// cub::DeviceHistogram::HistogramEven, unless the product overflows 64 bits.
+template <typename Level, bool = ::cuda::std::is_integral<Level>::value>
+struct even_bin_index
+{
+  using offset_type = unsigned long long;
+
+  Level lower;
+  Level upper;
+  int num_bins;
+  offset_type range;
+  bool exact;
+
+  _CCCL_HOST_DEVICE even_bin_index(Level lower_, Level upper_, int num_bins_)
+      : lower(lower_)
+      , upper(upper_)
+      , num_bins(num_bins_)
+      , range(static_cast<offset_type>(upper_) - static_cast<offset_type>(lower_))
+      , exact(true)
+  {
+    exact = range <= ::cuda::std::numeric_limits<offset_type>::max() / static_cast<offset_type>(num_bins);
+  }
+
+  template <typename Sample>
+  _CCCL_HOST_DEVICE int operator()(const Sample& sample) const
+  {
+    const Level s = static_cast<Level>(thrust::raw_reference_cast(sample));
+
+    if (!(lower <= s && s < upper))
+    {
+      return num_bins;
+    }
+
+    // unsigned arithmetic yields the exact distance even for signed levels
+    const offset_type offset = static_cast<offset_type>(s) - static_cast<offset_type>(lower);
+
+    if (exact)
+    {
+      return static_cast<int>(offset * static_cast<offset_type>(num_bins) / range);
+    }
+
+    const int bin = static_cast<int>(static_cast<double>(offset) / static_cast<double>(range) * num_bins);
+
+    return bin < num_bins ? bin : num_bins - 1;
+  }
+};
+
+// Floating point levels scale the offset of the sample by a precomputed
+// factor, which leaves a multiply and a conversion per sample.
+template <typename Level>
+struct even_bin_index<Level, false>
+{
+  Level lower;
+  Level upper;
+  int num_bins;
+  Level scale;
+
+  _CCCL_HOST_DEVICE even_bin_index(Level lower_, Level upper_, int num_bins_)
+      : lower(lower_)
+      , upper(upper_)
+      , num_bins(num_bins_)
+      , scale(static_cast<Level>(num_bins_) / (upper_ - lower_))
+  {}
+
+  template <typename Sample>
+  _CCCL_HOST_DEVICE int operator()(const Sample& sample) const
+  {
+    const Level s = static_cast<Level>(thrust::raw_reference_cast(sample));
+
+    // also rejects NaN
+    if (!(lower <= s && s < upper))
+    {
+      return num_bins;
+    }
+
+    const int bin = static_cast<int>((s - lower) * scale);
+
+    // rounding may push samples just below upper past the last bin
+    return bin < num_bins ? bin : num_bins - 1;
+  }
+};
+
+// Bins [levels[i], levels[i + 1]) for the num_levels increasing levels
+// starting at levels.
+template <typename RandomAccessIterator>
+struct range_bin_index
+{
+  RandomAccessIterator levels;
+  int num_levels;
+
+  template <typename Sample>
+  _CCCL_HOST_DEVICE int operator()(const Sample& sample) const
+  {
+    const int num_bins = num_levels - 1;
+
+    // find the first level greater than sample
+    int first = 0;
+    int count = num_levels;
+
+    while (count > 0)
+    {
+      const int half = count / 2;
+
+      if (!(sample < levels[first + half]))
+      {
+        first += half + 1;
+        count -= half + 1;
+      }
+      else
+      {
+        count = half;
+      }
+    }
+
+    // samples below the first level, at or above the last and NaN
+    if (first == 0 || first == num_levels)
+    {
+      return num_bins;
+    }
+
+    return first - 1;
+  }
+};
+
+// number of bins computed ahead of counting them, see histogram_tile
+const int histogram_tile_width = 64;
+
+// Adds the bins of the n samples starting at first to counts. The bins of a
+// whole batch of samples are computed before any of them is counted, so that
+// the computation doesn't wait on the read-modify-write of the previous count
+// and even bins vectorize.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename Size, typename BinIndex, typename CountIterator>
+_CCCL_HOST_DEVICE void
+histogram_tile(RandomAccessIterator first, Size n, BinIndex bin_index, int num_bins, CountIterator counts)
+{
+  int bins[histogram_tile_width];
+
+  for (Size i = 0; i < n; i += histogram_tile_width)
+  {
+    const int width = n - i < histogram_tile_width ? static_cast<int>(n - i) : histogram_tile_width;
+
+    for (int j = 0; j < width; ++j)
+    {
+      bins[j] = bin_index(first[i + j]);
+    }
+
+    for (int j = 0; j < width; ++j)
+    {
+      if (bins[j] < num_bins)
+      {
+        ++counts[bins[j]];
+      }
+    }
+  }
+}
+
+} // namespace internal
+} // namespace detail
+} // namespace system
+THRUST_NAMESPACE_END
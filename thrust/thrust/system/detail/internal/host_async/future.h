@@ -0,0 +1,564 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file future.h
+ *  \brief Events and futures of the parallel host backends, and the machinery
+ *         which runs asynchronous work once its dependencies are satisfied.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp14_required.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#  include <thrust/detail/event_error.h>
+#  include <thrust/detail/execute_with_dependencies.h>
+#  include <thrust/detail/static_assert.h>
+#  include <thrust/detail/tuple_algorithms.h>
+#  include <thrust/optional.h>
+#  include <thrust/type_traits/remove_cvref.h>
+
+#  include <atomic>
+#  include <condition_variable>
+#  include <exception>
+#  include <memory>
+#  include <mutex>
+#  include <tuple>
+#  include <type_traits>
+#  include <utility>
+#  include <vector>
+
+THRUST_NAMESPACE_BEGIN
+
+struct new_stream_t;
+
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace host_async
+{
+
+// A unit of work handed to a scheduler. Unlike std::function, tasks may own
+// move-only state, such as the events they were made to depend on.
+struct task
+{
+  virtual ~task() {}
+
+  virtual void run() = 0;
+};
+
+using task_ptr = std::unique_ptr<task>;
+
+template <typename F>
+struct task_impl final : task
+{
+  F f;
+
+  explicit task_impl(F&& f_)
+      : f(std::move(f_))
+  {}
+
+  void run() override
+  {
+    f();
+  }
+};
+
+template <typename F>
+task_ptr make_task(F&& f)
+{
+  return task_ptr(new task_impl<remove_cvref_t<F>>(remove_cvref_t<F>(THRUST_FWD(f))));
+}
+
+// The shared state of an event: completes exactly once, possibly with an
+// error, and runs the tasks registered with then() when it does.
+struct async_signal
+{
+  async_signal() = default;
+
+  async_signal(async_signal const&)            = delete;
+  async_signal& operator=(async_signal const&) = delete;
+
+  virtual ~async_signal() {}
+
+  void complete(std::exception_ptr error = nullptr)
+  {
+    std::vector<task_ptr> continuations;
+
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      done         = true;
+      error_       = error;
+      continuations.swap(continuations_);
+    }
+
+    cv.notify_all();
+
+    for (task_ptr& t : continuations)
+    {
+      t->run();
+    }
+  }
+
+  // runs t once the signal completes, immediately if it already has
+  void then(task_ptr t)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      if (!done)
+      {
+        continuations_.push_back(std::move(t));
+        return;
+      }
+    }
+
+    t->run();
+  }
+
+  bool ready() const
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    return done;
+  }
+
+  void wait() const
+  {
+    std::unique_lock<std::mutex> lock(mtx);
+    cv.wait(lock, [this] {
+      return done;
+    });
+  }
+
+  // Precondition: ready()
+  std::exception_ptr error() const
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    return error_;
+  }
+
+private:
+  mutable std::mutex mtx;
+  mutable std::condition_variable cv;
+  bool done = false;
+  std::exception_ptr error_;
+  std::vector<task_ptr> continuations_;
+};
+
+template <typename T>
+struct async_value final : async_signal
+{
+  using value_type = T;
+
+  thrust::optional<value_type> value;
+};
+
+template <typename System>
+struct unique_eager_event;
+
+template <typename System, typename T>
+struct unique_eager_future;
+
+struct access
+{
+  template <typename Handle>
+  static auto signal(Handle& h) -> decltype((h.async_signal_))
+  {
+    return h.async_signal_;
+  }
+
+  template <typename Handle, typename Signal>
+  static Handle make(std::shared_ptr<Signal> s)
+  {
+    return Handle(std::move(s));
+  }
+};
+
+template <typename System>
+struct unique_eager_event final
+{
+private:
+  std::shared_ptr<async_signal> async_signal_;
+
+  explicit unique_eager_event(std::shared_ptr<async_signal> s)
+      : async_signal_(std::move(s))
+  {}
+
+public:
+  unique_eager_event() = default;
+
+  unique_eager_event(unique_eager_event&&)                 = default;
+  unique_eager_event(unique_eager_event const&)            = delete;
+  unique_eager_event& operator=(unique_eager_event&&)      = default;
+  unique_eager_event& operator=(unique_eager_event const&) = delete;
+
+  // Any `unique_eager_future<T>` can be explicitly converted to an event.
+  template <typename U>
+  explicit unique_eager_event(unique_eager_future<System, U>&& other)
+      : async_signal_(std::move(access::signal(other)))
+  {}
+
+  // An event with no work behind it, which is ready right away.
+  // NOTE: We take `new_stream_t` by `const&` because it is incomplete here.
+  explicit unique_eager_event(new_stream_t const&)
+      : async_signal_(std::make_shared<async_signal>())
+  {
+    async_signal_->complete();
+  }
+
+  // Unlike the CUDA events, which only release their stream, outstanding work
+  // is waited for before the event goes away: host work runs on threads which
+  // may still refer to memory owned by the caller, and which nothing else
+  // would wait for.
+  ~unique_eager_event()
+  {
+    if (valid_stream())
+    {
+      async_signal_->wait();
+    }
+  }
+
+  // Mirrors the CUDA interface: true if the event refers to asynchronous work.
+  bool valid_stream() const noexcept
+  {
+    return bool(async_signal_);
+  }
+
+  bool ready() const noexcept
+  {
+    return valid_stream() && async_signal_->ready();
+  }
+
+  // Blocks, then rethrows the exception the work failed with, if any.
+  // Precondition: `true == valid_stream()`.
+  void wait()
+  {
+    if (!valid_stream())
+    {
+      throw thrust::event_error(event_errc::no_state);
+    }
+
+    async_signal_->wait();
+
+    if (std::exception_ptr error = async_signal_->error())
+    {
+      std::rethrow_exception(error);
+    }
+  }
+
+  friend struct access;
+};
+
+template <typename System, typename T>
+struct unique_eager_future final
+{
+  THRUST_STATIC_ASSERT_MSG((!std::is_same<T, remove_cvref_t<void>>::value),
+                           "`thrust::event` should be used to express valueless futures");
+
+  using value_type = T;
+
+private:
+  std::shared_ptr<async_value<value_type>> async_signal_;
+
+  explicit unique_eager_future(std::shared_ptr<async_value<value_type>> s)
+      : async_signal_(std::move(s))
+  {}
+
+  // Blocks, then rethrows the exception the work failed with, if any.
+  async_value<value_type>& completed_content()
+  {
+    if (!valid_content())
+    {
+      throw thrust::event_error(event_errc::no_content);
+    }
+
+    async_signal_->wait();
+
+    if (std::exception_ptr error = async_signal_->error())
+    {
+      std::rethrow_exception(error);
+    }
+
+    return *async_signal_;
+  }
+
+public:
+  unique_eager_future() = default;
+
+  unique_eager_future(unique_eager_future&&)                 = default;
+  unique_eager_future(unique_eager_future const&)            = delete;
+  unique_eager_future& operator=(unique_eager_future&&)      = default;
+  unique_eager_future& operator=(unique_eager_future const&) = delete;
+
+  // A future with no work and no content behind it.
+  // NOTE: We take `new_stream_t` by `const&` because it is incomplete here.
+  explicit unique_eager_future(new_stream_t const&)
+      : async_signal_(std::make_shared<async_value<value_type>>())
+  {
+    async_signal_->complete();
+  }
+
+  // Waits for outstanding work, as the events do.
+  ~unique_eager_future()
+  {
+    if (valid_stream())
+    {
+      async_signal_->wait();
+    }
+  }
+
+  // Mirrors the CUDA interface: true if the future refers to asynchronous work.
+  bool valid_stream() const noexcept
+  {
+    return bool(async_signal_);
+  }
+
+  // True unless the future was default constructed, constructed from
+  // `new_stream`, or its content was extracted. A future whose work failed
+  // still has valid content; retrieving it rethrows the failure.
+  bool valid_content() const noexcept
+  {
+    if (!valid_stream())
+    {
+      return false;
+    }
+
+    return !async_signal_->ready() || async_signal_->value.has_value() || async_signal_->error();
+  }
+
+  bool ready() const noexcept
+  {
+    return valid_stream() && async_signal_->ready();
+  }
+
+  // Blocks, then rethrows the exception the work failed with, if any.
+  // Precondition: `true == valid_stream()`.
+  void wait()
+  {
+    if (!valid_stream())
+    {
+      throw thrust::event_error(event_errc::no_state);
+    }
+
+    async_signal_->wait();
+
+    if (std::exception_ptr error = async_signal_->error())
+    {
+      std::rethrow_exception(error);
+    }
+  }
+
+  // Blocks.
+  // Precondition: `true == valid_content()`.
+  value_type get()
+  {
+    return *completed_content().value;
+  }
+
+  // Blocks.
+  // Precondition: `true == valid_content()`.
+  _CCCL_NODISCARD value_type extract()
+  {
+    value_type tmp(std::move(*completed_content().value));
+    async_signal_.reset();
+    return tmp;
+  }
+
+  friend struct access;
+  friend struct unique_eager_event<System>;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Gathers the signals the handles of any host system in a dependency tuple
+// complete with. Other dependencies, such as `std::unique_ptr`s, are only kept
+// alive until the dependent work has run.
+struct collect_signals_fn
+{
+  std::vector<std::shared_ptr<async_signal>>& signals;
+
+  template <typename System>
+  void operator()(unique_eager_event<System>& e) const
+  {
+    if (e.valid_stream())
+    {
+      signals.push_back(access::signal(e));
+    }
+  }
+
+  template <typename System, typename T>
+  void operator()(unique_eager_future<System, T>& f) const
+  {
+    if (f.valid_stream())
+    {
+      signals.push_back(access::signal(f));
+    }
+  }
+
+  template <typename T, typename Deleter>
+  void operator()(std::unique_ptr<T, Deleter>&) const
+  {}
+};
+
+template <typename Signal, typename Work, typename Dependencies>
+struct dependent_job
+{
+  std::shared_ptr<Signal> result;
+  Work work;
+  Dependencies dependencies;
+  std::vector<std::shared_ptr<async_signal>> signals;
+
+  void operator()()
+  {
+    std::exception_ptr error;
+
+    // a failed dependency fails everything that depends on it
+    for (std::shared_ptr<async_signal> const& s : signals)
+    {
+      if ((error = s->error()))
+      {
+        break;
+      }
+    }
+
+    if (!error)
+    {
+      try
+      {
+        work(*result);
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+      }
+    }
+
+    signals.clear();
+    result->complete(error);
+  }
+};
+
+// Runs `work(*result)` through `submit` once every dependency has completed,
+// and completes `result` afterwards. Never blocks: the last dependency to
+// complete submits the work from whichever thread completed it.
+template <typename Signal, typename Submit, typename Work, typename... Dependencies>
+void launch_after(std::shared_ptr<Signal> result, Submit submit, Work&& work, std::tuple<Dependencies...>&& deps)
+{
+  using job_t = dependent_job<Signal, remove_cvref_t<Work>, std::tuple<Dependencies...>>;
+
+  std::shared_ptr<job_t> job(
+    new job_t{std::move(result), remove_cvref_t<Work>(THRUST_FWD(work)), std::move(deps), {}});
+
+  thrust::tuple_for_each(job->dependencies, collect_signals_fn{job->signals});
+
+  std::shared_ptr<std::atomic<std::size_t>> pending =
+    std::make_shared<std::atomic<std::size_t>>(job->signals.size() + 1);
+
+  auto arrive = [job, pending, submit]() mutable {
+    if (--*pending == 0)
+    {
+      submit(make_task([job] {
+        (*job)();
+      }));
+    }
+  };
+
+  // copy the signals, as the job may already run, and clear them, while
+  // continuations are still being registered
+  std::vector<std::shared_ptr<async_signal>> signals = job->signals;
+
+  for (std::shared_ptr<async_signal> const& s : signals)
+  {
+    s->then(make_task(arrive));
+  }
+
+  arrive();
+}
+
+// runs tasks right away, on the thread that completed the last dependency
+struct inline_submit
+{
+  void operator()(task_ptr t) const
+  {
+    t->run();
+  }
+};
+
+template <typename System, typename Submit, typename Work, typename... Dependencies>
+unique_eager_event<System> make_dependent_event(Submit submit, Work&& work, std::tuple<Dependencies...>&& deps)
+{
+  std::shared_ptr<async_signal> result = std::make_shared<async_signal>();
+
+  launch_after(
+    result,
+    std::move(submit),
+    [work = remove_cvref_t<Work>(THRUST_FWD(work))](async_signal&) mutable {
+      work();
+    },
+    std::move(deps));
+
+  return access::make<unique_eager_event<System>>(std::move(result));
+}
+
+template <typename System, typename T, typename Submit, typename Work, typename... Dependencies>
+unique_eager_future<System, T> make_dependent_future(Submit submit, Work&& work, std::tuple<Dependencies...>&& deps)
+{
+  std::shared_ptr<async_value<T>> result = std::make_shared<async_value<T>>();
+
+  launch_after(
+    result,
+    std::move(submit),
+    [work = remove_cvref_t<Work>(THRUST_FWD(work))](async_value<T>& v) mutable {
+      v.value.emplace(work());
+    },
+    std::move(deps));
+
+  return access::make<unique_eager_future<System, T>>(std::move(result));
+}
+
+template <typename System, typename... Events>
+unique_eager_event<System> when_all(Events&&... evs)
+{
+  return make_dependent_event<System>(inline_submit{}, [] {}, std::make_tuple(std::move(evs)...));
+}
+
+// ADL hook for transparent `.after` move support.
+template <typename System>
+auto capture_as_dependency(unique_eager_event<System>& dependency) THRUST_DECLTYPE_RETURNS(std::move(dependency))
+
+  // ADL hook for transparent `.after` move support.
+  template <typename System, typename T>
+  auto capture_as_dependency(unique_eager_future<System, T>& dependency) THRUST_DECLTYPE_RETURNS(std::move(dependency))
+
+} // namespace host_async
+} // namespace internal
+} // namespace detail
+} // namespace system
+THRUST_NAMESPACE_END
+
+#endif // C++14
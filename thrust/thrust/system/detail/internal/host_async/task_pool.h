@@ -0,0 +1,145 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file task_pool.h
+ *  \brief A small pool of threads which runs asynchronous host work for
+ *         backends without a task scheduler of their own.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp14_required.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#  include <thrust/system/detail/internal/host_async/future.h>
+
+#  include <algorithm>
+#  include <condition_variable>
+#  include <deque>
+#  include <mutex>
+#  include <thread>
+#  include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace host_async
+{
+
+// Every task runs a whole algorithm, which parallelizes itself, so the pool
+// only needs enough threads to let a few independent chains of work overlap.
+class task_pool
+{
+public:
+  explicit task_pool(unsigned num_threads)
+  {
+    for (unsigned i = 0; i < num_threads; ++i)
+    {
+      threads.emplace_back([this] {
+        work();
+      });
+    }
+  }
+
+  task_pool(task_pool const&)            = delete;
+  task_pool& operator=(task_pool const&) = delete;
+
+  // runs the tasks still queued before joining the threads
+  ~task_pool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      stopping = true;
+    }
+
+    cv.notify_all();
+
+    for (std::thread& t : threads)
+    {
+      t.join();
+    }
+  }
+
+  void submit(task_ptr t)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      queue.push_back(std::move(t));
+    }
+
+    cv.notify_one();
+  }
+
+  static task_pool& instance()
+  {
+    static task_pool pool((std::min)((std::max)(std::thread::hardware_concurrency(), 2u), 4u));
+    return pool;
+  }
+
+private:
+  void work()
+  {
+    for (;;)
+    {
+      task_ptr t;
+
+      {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [this] {
+          return stopping || !queue.empty();
+        });
+
+        if (queue.empty())
+        {
+          return;
+        }
+
+        t = std::move(queue.front());
+        queue.pop_front();
+      }
+
+      t->run();
+    }
+  }
+
+  std::mutex mtx;
+  std::condition_variable cv;
+  bool stopping = false;
+  std::deque<task_ptr> queue;
+  std::vector<std::thread> threads;
+};
+
+} // namespace host_async
+} // namespace internal
+} // namespace detail
+} // namespace system
+THRUST_NAMESPACE_END
+
+#endif // C++14
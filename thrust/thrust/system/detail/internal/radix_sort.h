@@ -0,0 +1,194 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file radix_sort.h
+ *  \brief Per-tile building blocks of the LSD radix sort shared by the
+ *         parallel host backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/type_traits.h>
+#include <thrust/functional.h>
+#include <thrust/system/detail/sequential/sort.h>
+#include <thrust/system/detail/sequential/stable_radix_sort.h>
+
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace radix_sort_detail
+{
+
+const unsigned int radix_bits  = 8;
+const unsigned int num_buckets = 1u << radix_bits;
+
+// the parallel radix sort handles the same keys and comparisons as the
+// sequential primitive sort, except bool, which is sorted by partitioning
+template <typename KeyType, typename Compare>
+struct use_radix_sort
+    : ::cuda::std::_And<thrust::system::detail::sequential::sort_detail::use_primitive_sort<KeyType, Compare>,
+                        ::cuda::std::_Not<::cuda::std::is_same<KeyType, bool>>>
+{};
+
+template <typename KeyType, typename Compare>
+struct is_descending : ::cuda::std::is_same<Compare, thrust::greater<KeyType>>
+{};
+
+// extracts one radix digit of a key's order-preserving encoding; sorting by
+// the complement of the encoding sorts in descending order and stays stable
+template <typename KeyType, bool Descending>
+struct digit_extractor
+{
+  using Encoder     = thrust::system::detail::sequential::radix_sort_detail::RadixEncoder<KeyType>;
+  using EncodedType = decltype(::cuda::std::declval<Encoder>()(::cuda::std::declval<KeyType>()));
+
+  static const unsigned int num_passes = (8 * sizeof(EncodedType) + (radix_bits - 1)) / radix_bits;
+
+  Encoder encode;
+  unsigned int bit_shift;
+
+  explicit digit_extractor(unsigned int pass)
+      : encode()
+      , bit_shift(pass * radix_bits)
+  {}
+
+  std::size_t operator()(KeyType key) const
+  {
+    EncodedType x = encode(key);
+
+    if (Descending)
+    {
+      x = static_cast<EncodedType>(~x);
+    }
+
+    return static_cast<std::size_t>((x >> bit_shift) & (num_buckets - 1));
+  }
+};
+
+// counts the digits of the keys in [first, last) into histogram[0, num_buckets)
+template <typename RandomAccessIterator, typename DigitExtractor>
+void histogram_tile(RandomAccessIterator first, RandomAccessIterator last, DigitExtractor digit, std::size_t* histogram)
+{
+  for (unsigned int i = 0; i < num_buckets; ++i)
+  {
+    histogram[i] = 0;
+  }
+
+  for (; first != last; ++first)
+  {
+    ++histogram[digit(*first)];
+  }
+}
+
+// turns the histograms of num_tiles consecutive tiles, stored back to back,
+// into the position at which each tile scatters its first key of each bucket;
+// returns false when every key lands in the same bucket and the pass is a no-op
+inline bool scan_histograms(std::size_t* histograms, std::size_t num_tiles, std::size_t n)
+{
+  std::size_t sum = 0;
+
+  for (unsigned int bucket = 0; bucket < num_buckets; ++bucket)
+  {
+    const std::size_t bucket_first = sum;
+
+    for (std::size_t tile = 0; tile < num_tiles; ++tile)
+    {
+      std::size_t& count    = histograms[tile * num_buckets + bucket];
+      const std::size_t tmp = count;
+      count                 = sum;
+      sum += tmp;
+    }
+
+    if (sum - bucket_first == n)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// stably scatters the keys of one tile to the offsets computed by scan_histograms
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename DigitExtractor>
+void scatter_tile(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2,
+  RandomAccessIterator3 keys_result,
+  RandomAccessIterator4,
+  DigitExtractor digit,
+  std::size_t* offsets,
+  thrust::detail::false_type)
+{
+  for (; keys_first != keys_last; ++keys_first)
+  {
+    keys_result[offsets[digit(*keys_first)]++] = *keys_first;
+  }
+}
+
+// stably scatters the keys and values of one tile to the offsets computed by scan_histograms
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename DigitExtractor>
+void scatter_tile(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  RandomAccessIterator3 keys_result,
+  RandomAccessIterator4 values_result,
+  DigitExtractor digit,
+  std::size_t* offsets,
+  thrust::detail::true_type)
+{
+  for (; keys_first != keys_last; ++keys_first, ++values_first)
+  {
+    const std::size_t i = offsets[digit(*keys_first)]++;
+
+    keys_result[i]   = *keys_first;
+    values_result[i] = *values_first;
+  }
+}
+
+} // end namespace radix_sort_detail
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
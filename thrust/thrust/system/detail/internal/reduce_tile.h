@@ -0,0 +1,135 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file reduce_tile.h
+ *  \brief Sequential reduction of a single tile shared by the parallel host
+ *         backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_reference_cast.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/detail/type_traits/is_commutative.h>
+
+#include <cuda/std/type_traits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace reduce_detail
+{
+
+// number of independent partial results kept by the unrolled kernel
+const int num_accumulators = 8;
+
+// splitting a tile into interleaved partial results reorders the operands, so
+// it is only done for commutative operators on arithmetic types
+template <typename OutputType, typename BinaryFunction>
+struct use_multiple_accumulators
+    : ::cuda::std::_And<::cuda::std::is_arithmetic<OutputType>, thrust::detail::is_commutative<BinaryFunction>>
+{};
+
+template <typename OutputType, typename RandomAccessIterator, typename Size, typename BinaryFunction>
+OutputType reduce_tile(RandomAccessIterator first, Size n, BinaryFunction binary_op, thrust::detail::false_type)
+{
+  thrust::detail::wrapped_function<BinaryFunction, OutputType> wrapped_binary_op{binary_op};
+
+  OutputType sum = thrust::raw_reference_cast(*first);
+
+  for (Size i = 1; i < n; ++i)
+  {
+    sum = wrapped_binary_op(sum, first[i]);
+  }
+
+  return sum;
+}
+
+// Keeps num_accumulators partial results, so that consecutive applications of
+// binary_op don't depend on each other and the compiler can vectorize the
+// inner loop. The partial results are combined in a fixed order, so integer
+// results don't depend on the unrolling.
+template <typename OutputType, typename RandomAccessIterator, typename Size, typename BinaryFunction>
+OutputType reduce_tile(RandomAccessIterator first, Size n, BinaryFunction binary_op, thrust::detail::true_type)
+{
+  if (n < 2 * num_accumulators)
+  {
+    return reduce_tile<OutputType>(first, n, binary_op, thrust::detail::false_type());
+  }
+
+  thrust::detail::wrapped_function<BinaryFunction, OutputType> wrapped_binary_op{binary_op};
+
+  OutputType sums[num_accumulators];
+
+  for (int j = 0; j < num_accumulators; ++j)
+  {
+    sums[j] = thrust::raw_reference_cast(first[j]);
+  }
+
+  Size i = num_accumulators;
+
+  for (; i + num_accumulators <= n; i += num_accumulators)
+  {
+    for (int j = 0; j < num_accumulators; ++j)
+    {
+      sums[j] = wrapped_binary_op(sums[j], first[i + j]);
+    }
+  }
+
+  for (int width = num_accumulators / 2; width > 0; width /= 2)
+  {
+    for (int j = 0; j < width; ++j)
+    {
+      sums[j] = wrapped_binary_op(sums[j], sums[j + width]);
+    }
+  }
+
+  for (; i < n; ++i)
+  {
+    sums[0] = wrapped_binary_op(sums[0], first[i]);
+  }
+
+  return sums[0];
+}
+
+} // namespace reduce_detail
+
+// reduces the n > 0 elements starting at first to a single OutputType
+template <typename OutputType, typename RandomAccessIterator, typename Size, typename BinaryFunction>
+OutputType reduce_tile(RandomAccessIterator first, Size n, BinaryFunction binary_op)
+{
+  return reduce_detail::reduce_tile<OutputType>(
+    first, n, binary_op, reduce_detail::use_multiple_accumulators<OutputType, BinaryFunction>());
+}
+
+} // namespace internal
+} // namespace detail
+} // namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,104 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file tile_compaction.h
+ *  \brief Helpers for compacting ranges split into tiles, shared by the
+ *         parallel host backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/copy.h>
+
+#include <cuda/std/type_traits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// The tiles of the parallel algorithms index their iterators directly, so
+// they take the sequential path for anything less than random access.
+template <typename... Iterators>
+struct is_tileable : ::cuda::std::true_type
+{};
+
+template <typename Iterator, typename... Iterators>
+struct is_tileable<Iterator, Iterators...>
+    : ::cuda::std::integral_constant<
+        bool,
+        ::cuda::std::is_convertible<typename thrust::iterator_traversal<Iterator>::type,
+                                    thrust::random_access_traversal_tag>::value
+          && is_tileable<Iterators...>::value>
+{};
+
+// Turns the counts of num_tiles tiles into the positions their elements end
+// up at, in place, and returns the total. counts has room for num_tiles + 1.
+template <typename Size>
+Size tile_offsets(Size* counts, Size num_tiles)
+{
+  Size sum = 0;
+
+  for (Size i = 0; i < num_tiles; ++i)
+  {
+    const Size count = counts[i];
+    counts[i]        = sum;
+    sum += count;
+  }
+
+  counts[num_tiles] = sum;
+
+  return sum;
+}
+
+// After each tile kept some of its elements at its front, moves them next to
+// those of its predecessor. Moving to the left only ever overwrites elements
+// that were already moved, but the later tiles overwrite the sources of the
+// earlier ones, so the tiles are moved in order.
+template <typename DerivedPolicy, typename RandomAccessIterator, typename Decomposition, typename Size>
+void close_tile_gaps(sequential::execution_policy<DerivedPolicy>& exec,
+                     RandomAccessIterator first,
+                     const Decomposition& decomp,
+                     const Size* offsets)
+{
+  for (Size i = 1; i < static_cast<Size>(decomp.size()); ++i)
+  {
+    const Size begin = static_cast<Size>(decomp[i].begin());
+
+    if (offsets[i] != begin)
+    {
+      sequential::copy(exec, first + begin, first + begin + (offsets[i + 1] - offsets[i]), first + offsets[i]);
+    }
+  }
+}
+
+} // namespace internal
+} // namespace detail
+} // namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,284 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file trivial_copy.h
+ *  \brief Partitioning and per-thread kernels for copying and filling
+ *         trivially copyable data, shared by the parallel host backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/system/detail/internal/tuning_profile.h>
+
+#include <cuda/std/type_traits>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// streaming stores are only used by the host compilation pass
+#if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && !defined(__CUDA_ARCH__)
+#  define THRUST_TRIVIAL_COPY_HAS_STREAMING_STORES
+#  include <emmintrin.h>
+#endif
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// Interior boundaries of a partition fall on pages of the destination, so
+// that no two threads write to the same page.
+const std::size_t trivial_copy_page_size = 4096;
+
+// Transfers smaller than this per thread are not worth waking up a thread for,
+// unless a tuning profile says otherwise.
+const std::size_t trivial_copy_min_bytes_per_thread = std::size_t(1) << 16;
+
+// Transfers at least this large don't fit into the cache anyway, so their
+// stores bypass it instead of evicting everything else.
+const std::size_t trivial_copy_streaming_threshold = std::size_t(1) << 24;
+
+// Splits the n elements of the given size starting at first into at most
+// max_chunks chunks of whole pages of first, each at least as large as
+// cutoffs prescribes.
+class trivial_copy_partition
+{
+public:
+  trivial_copy_partition(const void* first,
+                         std::size_t n,
+                         std::size_t element_size,
+                         std::size_t max_chunks,
+                         const tuning_cutoffs& cutoffs)
+      : m_n(n)
+      , m_element_size(element_size)
+      , m_head(0)
+      , m_chunk_bytes(0)
+      , m_num_chunks(1)
+  {
+    const std::size_t bytes = n * element_size;
+
+    if (bytes < cutoffs.serial_cutoff)
+    {
+      return;
+    }
+
+    std::size_t chunks = bytes / (cutoffs.tile_bytes > 0 ? cutoffs.tile_bytes : 1);
+    chunks             = chunks < max_chunks ? chunks : max_chunks;
+
+    if (chunks < 2)
+    {
+      return;
+    }
+
+    // the partial page in front of the first page boundary goes to the first chunk
+    const std::size_t misalignment = reinterpret_cast<std::uintptr_t>(first) % trivial_copy_page_size;
+    m_head                         = misalignment == 0 ? 0 : trivial_copy_page_size - misalignment;
+    m_head                         = m_head < bytes ? m_head : bytes;
+
+    const std::size_t pages           = (bytes - m_head + trivial_copy_page_size - 1) / trivial_copy_page_size;
+    const std::size_t pages_per_chunk = (pages + chunks - 1) / chunks;
+
+    m_chunk_bytes = pages_per_chunk * trivial_copy_page_size;
+    m_num_chunks  = pages_per_chunk == 0 ? 1 : (pages + pages_per_chunk - 1) / pages_per_chunk;
+  }
+
+  std::size_t size() const
+  {
+    return m_num_chunks;
+  }
+
+  // the first element of chunk i; chunk i ends where chunk i + 1 begins
+  std::size_t begin(std::size_t i) const
+  {
+    if (i == 0)
+    {
+      return 0;
+    }
+
+    if (i >= m_num_chunks)
+    {
+      return m_n;
+    }
+
+    // elements straddling a page boundary belong to the chunk they start in
+    const std::size_t byte = m_head + i * m_chunk_bytes;
+    const std::size_t elem = (byte + m_element_size - 1) / m_element_size;
+    return elem < m_n ? elem : m_n;
+  }
+
+  std::size_t end(std::size_t i) const
+  {
+    return begin(i + 1);
+  }
+
+private:
+  std::size_t m_n;
+  std::size_t m_element_size;
+  std::size_t m_head;
+  std::size_t m_chunk_bytes;
+  std::size_t m_num_chunks;
+};
+
+inline bool use_streaming_stores(std::size_t bytes)
+{
+  return bytes >= trivial_copy_streaming_threshold;
+}
+
+// true if the bytes of [first, first + bytes) and [result, result + bytes)
+// overlap, in which case they can't be copied in parallel
+inline bool trivial_copy_overlaps(const void* first, const void* result, std::size_t bytes)
+{
+  const std::uintptr_t src = reinterpret_cast<std::uintptr_t>(first);
+  const std::uintptr_t dst = reinterpret_cast<std::uintptr_t>(result);
+
+  return src < dst ? dst - src < bytes : src - dst < bytes;
+}
+
+inline void copy_bytes(void* result, const void* first, std::size_t bytes, bool streaming)
+{
+#if defined(THRUST_TRIVIAL_COPY_HAS_STREAMING_STORES)
+  if (streaming)
+  {
+    char* dst       = static_cast<char*>(result);
+    const char* src = static_cast<const char*>(first);
+
+    // copy up to the first 16 byte boundary of the destination normally
+    std::size_t head = (16 - reinterpret_cast<std::uintptr_t>(dst) % 16) % 16;
+    head             = head < bytes ? head : bytes;
+    std::memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    bytes -= head;
+
+    for (; bytes >= 64; bytes -= 64, dst += 64, src += 64)
+    {
+      const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+      const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16));
+      const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 32));
+      const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 48));
+      _mm_stream_si128(reinterpret_cast<__m128i*>(dst), a);
+      _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 16), b);
+      _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 32), c);
+      _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 48), d);
+    }
+
+    std::memcpy(dst, src, bytes);
+
+    // make the streaming stores visible before the thread joins the others
+    _mm_sfence();
+    return;
+  }
+#endif // THRUST_TRIVIAL_COPY_HAS_STREAMING_STORES
+  (void) streaming;
+
+  std::memcpy(result, first, bytes);
+}
+
+inline void fill_bytes(void* result, unsigned char value, std::size_t bytes, bool streaming)
+{
+#if defined(THRUST_TRIVIAL_COPY_HAS_STREAMING_STORES)
+  if (streaming)
+  {
+    char* dst = static_cast<char*>(result);
+
+    std::size_t head = (16 - reinterpret_cast<std::uintptr_t>(dst) % 16) % 16;
+    head             = head < bytes ? head : bytes;
+    std::memset(dst, value, head);
+    dst += head;
+    bytes -= head;
+
+    const __m128i pattern = _mm_set1_epi8(static_cast<char>(value));
+
+    for (; bytes >= 16; bytes -= 16, dst += 16)
+    {
+      _mm_stream_si128(reinterpret_cast<__m128i*>(dst), pattern);
+    }
+
+    std::memset(dst, value, bytes);
+
+    _mm_sfence();
+    return;
+  }
+#endif // THRUST_TRIVIAL_COPY_HAS_STREAMING_STORES
+  (void) streaming;
+
+  std::memset(result, value, bytes);
+}
+
+// If every byte of value is the same, e.g. for zero, stores that byte to
+// byte and returns true.
+template <typename T>
+bool is_byte_pattern(const T& value, unsigned char& byte)
+{
+  unsigned char bytes[sizeof(T)];
+  std::memcpy(bytes, &value, sizeof(T));
+
+  for (std::size_t i = 1; i < sizeof(T); ++i)
+  {
+    if (bytes[i] != bytes[0])
+    {
+      return false;
+    }
+  }
+
+  byte = bytes[0];
+  return true;
+}
+
+template <typename T>
+void fill_elements(T* first, std::size_t n, const T& value, bool streaming)
+{
+  unsigned char byte;
+
+  if (is_byte_pattern(value, byte))
+  {
+    fill_bytes(first, byte, n * sizeof(T), streaming);
+    return;
+  }
+
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    first[i] = value;
+  }
+}
+
+// true if filling Elements with a Value may copy the bytes of a single
+// converted Value instead of assigning each element
+template <typename Element, typename Value>
+using is_trivially_fillable = ::cuda::std::integral_constant<
+  bool,
+  ::cuda::std::is_trivially_copyable<Element>::value
+    && (::cuda::std::is_same<Element, Value>::value
+        || (::cuda::std::is_arithmetic<Element>::value && ::cuda::std::is_arithmetic<Value>::value))>;
+
+} // namespace internal
+} // namespace detail
+} // namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,300 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file tuning_calibration.h
+ *  \brief Derives a tuning profile for a parallel host backend from timing
+ *         its algorithms against their serial versions on this machine.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/copy.h>
+#include <thrust/detail/seq.h>
+#include <thrust/for_each.h>
+#include <thrust/merge.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/internal/tuning_profile.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace tuning_calibration_detail
+{
+
+// the inputs are ints; sizes are counted in elements
+const std::size_t min_log_size = 4;
+const std::size_t max_log_size = 20;
+
+// each measurement processes at least this many elements, so that small
+// inputs aren't lost in the resolution of the clock
+const std::size_t min_work = std::size_t(1) << 16;
+
+const int repetitions = 5;
+
+struct buffers
+{
+  // i / 4, so that keys come in runs of four and the halves of every prefix are sorted
+  std::vector<int> sorted;
+  std::vector<int> random;
+  std::vector<int> output;
+  std::vector<int> scratch;
+
+  explicit buffers(std::size_t n)
+      : sorted(n)
+      , random(n)
+      , output(n)
+      , scratch(n)
+  {
+    std::uint32_t state = 12345;
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      state     = state * 1664525u + 1013904223u;
+      sorted[i] = static_cast<int>(i / 4);
+      random[i] = static_cast<int>(state >> 8);
+    }
+  }
+};
+
+struct increment
+{
+  _CCCL_HOST_DEVICE void operator()(int& x) const
+  {
+    ++x;
+  }
+};
+
+struct for_each_kernel
+{
+  template <typename Policy>
+  void operator()(Policy& policy, buffers& b, std::size_t n) const
+  {
+    thrust::for_each(policy, b.output.data(), b.output.data() + n, increment());
+  }
+};
+
+struct reduce_kernel
+{
+  // keeps the result alive
+  int* sink;
+
+  template <typename Policy>
+  void operator()(Policy& policy, buffers& b, std::size_t n) const
+  {
+    *sink += thrust::reduce(policy, b.random.data(), b.random.data() + n);
+  }
+};
+
+struct scan_kernel
+{
+  template <typename Policy>
+  void operator()(Policy& policy, buffers& b, std::size_t n) const
+  {
+    thrust::inclusive_scan(policy, b.random.data(), b.random.data() + n, b.output.data());
+  }
+};
+
+struct sort_kernel
+{
+  template <typename Policy>
+  void operator()(Policy& policy, buffers& b, std::size_t n) const
+  {
+    thrust::copy(thrust::seq, b.random.data(), b.random.data() + n, b.output.data());
+    thrust::sort(policy, b.output.data(), b.output.data() + n);
+  }
+};
+
+struct merge_kernel
+{
+  template <typename Policy>
+  void operator()(Policy& policy, buffers& b, std::size_t n) const
+  {
+    const int* first  = b.sorted.data();
+    const int* middle = first + n / 2;
+
+    thrust::merge(policy, first, middle, middle, first + n, b.output.data());
+  }
+};
+
+struct reduce_by_key_kernel
+{
+  template <typename Policy>
+  void operator()(Policy& policy, buffers& b, std::size_t n) const
+  {
+    thrust::reduce_by_key(
+      policy, b.sorted.data(), b.sorted.data() + n, b.random.data(), b.scratch.data(), b.output.data());
+  }
+};
+
+struct copy_kernel
+{
+  template <typename Policy>
+  void operator()(Policy& policy, buffers& b, std::size_t n) const
+  {
+    thrust::copy(policy, b.random.data(), b.random.data() + n, b.output.data());
+  }
+};
+
+// the best of several runs of kernel on n elements, in seconds per element
+template <typename Policy, typename Kernel>
+double time_per_element(Policy& policy, Kernel kernel, buffers& b, std::size_t n)
+{
+  const std::size_t iterations = n < min_work ? min_work / n : 1;
+
+  double best = 0;
+
+  for (int r = 0; r < repetitions; ++r)
+  {
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+      kernel(policy, b, n);
+    }
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (r == 0 || seconds < best)
+    {
+      best = seconds;
+    }
+  }
+
+  return best / static_cast<double>(iterations * n);
+}
+
+// The smallest input in bytes from which the parallel version of kernel beats
+// the serial one at every measured size, or twice the largest size if it
+// never does. The parallel version runs under the profile in effect.
+template <typename ParallelPolicy, typename Kernel>
+std::size_t measure_serial_cutoff(ParallelPolicy& par, Kernel kernel, buffers& b)
+{
+  std::size_t result = sizeof(int) << (max_log_size + 1);
+
+  for (std::size_t log_size = max_log_size + 1; log_size-- > min_log_size;)
+  {
+    const std::size_t n = std::size_t(1) << log_size;
+
+    const double serial   = time_per_element(thrust::seq, kernel, b, n);
+    const double parallel = time_per_element(par, kernel, b, n);
+
+    if (parallel >= serial)
+    {
+      break;
+    }
+
+    result = n * sizeof(int);
+  }
+
+  return result;
+}
+
+// puts a profile back when it goes out of scope, even if a kernel threw
+struct restore_profile
+{
+  tuning_profile& storage;
+  const tuning_profile saved;
+
+  ~restore_profile()
+  {
+    storage = saved;
+  }
+};
+
+} // namespace tuning_calibration_detail
+
+// Measures where the algorithms of a backend start to profit from running in
+// parallel on fan_out threads. Algorithms dispatched through par consult
+// storage, which is replaced by defaults without serial cutoffs while
+// measuring and restored afterwards, even if a measurement throws. The result
+// keeps the thread limit of storage and splits inputs at the cutoff into
+// fan_out tiles.
+template <typename ParallelPolicy>
+tuning_profile calibrate_tuning_profile(
+  ParallelPolicy& par, tuning_profile& storage, const tuning_profile& defaults, unsigned int fan_out)
+{
+  namespace calibration = tuning_calibration_detail;
+
+  calibration::buffers b(std::size_t(1) << calibration::max_log_size);
+  int sink = 0;
+
+  const calibration::restore_profile restore{storage, storage};
+
+  tuning_profile measuring = defaults;
+  measuring.max_threads    = restore.saved.max_threads;
+
+  for (std::size_t i = 0; i < num_tuning_families; ++i)
+  {
+    measuring.families[i].serial_cutoff = 0;
+  }
+
+  storage = measuring;
+
+  std::size_t cutoffs[num_tuning_families];
+  cutoffs[static_cast<std::size_t>(tuning_family::for_each)] =
+    calibration::measure_serial_cutoff(par, calibration::for_each_kernel(), b);
+  cutoffs[static_cast<std::size_t>(tuning_family::reduce)] =
+    calibration::measure_serial_cutoff(par, calibration::reduce_kernel{&sink}, b);
+  cutoffs[static_cast<std::size_t>(tuning_family::scan)] =
+    calibration::measure_serial_cutoff(par, calibration::scan_kernel(), b);
+  cutoffs[static_cast<std::size_t>(tuning_family::sort)] =
+    calibration::measure_serial_cutoff(par, calibration::sort_kernel(), b);
+  cutoffs[static_cast<std::size_t>(tuning_family::merge)] =
+    calibration::measure_serial_cutoff(par, calibration::merge_kernel(), b);
+  cutoffs[static_cast<std::size_t>(tuning_family::reduce_by_key)] =
+    calibration::measure_serial_cutoff(par, calibration::reduce_by_key_kernel(), b);
+  cutoffs[static_cast<std::size_t>(tuning_family::copy)] =
+    calibration::measure_serial_cutoff(par, calibration::copy_kernel(), b);
+
+  tuning_profile result;
+  result.max_threads = restore.saved.max_threads;
+
+  const std::size_t tiles = fan_out > 0 ? fan_out : 1;
+
+  for (std::size_t i = 0; i < num_tuning_families; ++i)
+  {
+    result.families[i].serial_cutoff = cutoffs[i];
+    result.families[i].tile_bytes    = cutoffs[i] / tiles > 0 ? cutoffs[i] / tiles : 1;
+  }
+
+  return result;
+}
+
+} // namespace internal
+} // namespace detail
+} // namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,237 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file tuning_profile.h
+ *  \brief Cutoffs that decide how the parallel host backends split up an
+ *         algorithm, and their textual form.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/iterator/iterator_traits.h>
+
+#include <cuda/std/type_traits>
+
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// the groups of algorithms whose cutoffs are tuned together
+enum class tuning_family
+{
+  for_each,
+  reduce,
+  scan,
+  sort,
+  merge,
+  reduce_by_key,
+  copy
+};
+
+const std::size_t num_tuning_families = 7;
+
+inline const char* tuning_family_name(tuning_family family)
+{
+  static const char* const names[num_tuning_families] = {
+    "for_each", "reduce", "scan", "sort", "merge", "reduce_by_key", "copy"};
+
+  return names[static_cast<std::size_t>(family)];
+}
+
+// The cutoffs of a family are in bytes of input, so that a single profile
+// serves all element types.
+struct tuning_cutoffs
+{
+  // inputs smaller than this run serially
+  std::size_t serial_cutoff;
+
+  // larger inputs are split into tiles of at least this size
+  std::size_t tile_bytes;
+};
+
+struct tuning_profile
+{
+  tuning_cutoffs families[num_tuning_families];
+
+  // the most threads an algorithm fans out to, 0 for the system's default
+  int max_threads;
+
+  tuning_profile()
+      : max_threads(0)
+  {
+    for (std::size_t i = 0; i < num_tuning_families; ++i)
+    {
+      families[i].serial_cutoff = 0;
+      families[i].tile_bytes    = 1;
+    }
+  }
+
+  tuning_cutoffs& operator[](tuning_family family)
+  {
+    return families[static_cast<std::size_t>(family)];
+  }
+
+  const tuning_cutoffs& operator[](tuning_family family) const
+  {
+    return families[static_cast<std::size_t>(family)];
+  }
+
+  // the number of elements below which family runs serially
+  std::size_t serial_cutoff(tuning_family family, std::size_t element_size) const
+  {
+    return (*this)[family].serial_cutoff / (element_size > 0 ? element_size : 1);
+  }
+
+  // the smallest number of elements family hands to a tile, at least one
+  std::size_t tile_size(tuning_family family, std::size_t element_size) const
+  {
+    const std::size_t result = (*this)[family].tile_bytes / (element_size > 0 ? element_size : 1);
+
+    return result > 0 ? result : 1;
+  }
+};
+
+// the size of the elements Iterator refers to, as the cutoffs count it
+template <typename Iterator, typename T = typename thrust::iterator_value<Iterator>::type>
+struct tuning_element_size : ::cuda::std::integral_constant<std::size_t, sizeof(T)>
+{};
+
+template <typename Iterator>
+struct tuning_element_size<Iterator, void> : ::cuda::std::integral_constant<std::size_t, 1>
+{};
+
+// A profile is written as one line per setting:
+//
+//   max_threads <threads>
+//   <family> <serial cutoff in bytes> <tile size in bytes>
+//
+// Blank lines and lines starting with # are ignored, as are unknown families,
+// so that profiles remain readable by versions with different families.
+inline std::ostream& operator<<(std::ostream& os, const tuning_profile& profile)
+{
+  os << "# family serial_cutoff_bytes tile_bytes\n";
+  os << "max_threads " << profile.max_threads << '\n';
+
+  for (std::size_t i = 0; i < num_tuning_families; ++i)
+  {
+    os << tuning_family_name(static_cast<tuning_family>(i)) << ' ' << profile.families[i].serial_cutoff << ' '
+       << profile.families[i].tile_bytes << '\n';
+  }
+
+  return os;
+}
+
+// reads settings until the end of the stream and sets failbit on a malformed
+// line, leaving the settings read so far in profile
+inline std::istream& operator>>(std::istream& is, tuning_profile& profile)
+{
+  std::string line;
+
+  while (std::getline(is, line))
+  {
+    std::istringstream fields(line);
+    std::string key;
+
+    if (!(fields >> key) || key[0] == '#')
+    {
+      continue;
+    }
+
+    if (key == "max_threads")
+    {
+      int threads;
+
+      if (!(fields >> threads) || threads < 0)
+      {
+        is.setstate(std::ios_base::failbit);
+        return is;
+      }
+
+      profile.max_threads = threads;
+      continue;
+    }
+
+    for (std::size_t i = 0; i < num_tuning_families; ++i)
+    {
+      if (key == tuning_family_name(static_cast<tuning_family>(i)))
+      {
+        tuning_cutoffs cutoffs;
+
+        if (!(fields >> cutoffs.serial_cutoff >> cutoffs.tile_bytes))
+        {
+          is.setstate(std::ios_base::failbit);
+          return is;
+        }
+
+        profile.families[i] = cutoffs;
+      }
+    }
+  }
+
+  // running out of lines is how a profile ends
+  is.clear(is.rdstate() & ~std::ios_base::failbit);
+
+  return is;
+}
+
+// Applies the profile named by the environment variable variable, if any, on
+// top of defaults. A profile that can't be read leaves the defaults alone.
+inline tuning_profile tuning_profile_from_environment(const char* variable, const tuning_profile& defaults)
+{
+  const char* path = std::getenv(variable);
+
+  if (path == nullptr || *path == '\0')
+  {
+    return defaults;
+  }
+
+  std::ifstream file(path);
+  tuning_profile result = defaults;
+
+  if (!file || !(file >> result))
+  {
+    return defaults;
+  }
+
+  return result;
+}
+
+} // namespace internal
+} // namespace detail
+} // namespace system
+THRUST_NAMESPACE_END
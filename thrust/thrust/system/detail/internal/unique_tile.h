@@ -0,0 +1,165 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file unique_tile.h
+ *  \brief Sequential kernels over a single tile of the unique family of
+ *         algorithms, shared by the parallel host backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/raw_reference_cast.h>
+#include <thrust/system/detail/internal/tile_compaction.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+// true if element i of first begins a group of consecutive equivalent
+// elements: it is the first one, or binary_pred rejects it and its predecessor
+template <typename RandomAccessIterator, typename Size, typename BinaryPredicate>
+bool is_unique_head(RandomAccessIterator first, Size i, BinaryPredicate& binary_pred)
+{
+  return i == 0 || !binary_pred(thrust::raw_reference_cast(first[i - 1]), thrust::raw_reference_cast(first[i]));
+}
+
+// the number of groups beginning in [begin, end)
+template <typename RandomAccessIterator, typename Size, typename BinaryPredicate>
+Size count_unique_heads(RandomAccessIterator first, Size begin, Size end, BinaryPredicate binary_pred)
+{
+  Size result = 0;
+
+  for (Size i = begin; i < end; ++i)
+  {
+    result += is_unique_head(first, i, binary_pred) ? 1 : 0;
+  }
+
+  return result;
+}
+
+// copies the first element of each group beginning in [begin, end) to result
+template <typename RandomAccessIterator, typename Size, typename OutputIterator, typename BinaryPredicate>
+void copy_unique_heads(
+  RandomAccessIterator first, Size begin, Size end, OutputIterator result, BinaryPredicate binary_pred)
+{
+  for (Size i = begin; i < end; ++i)
+  {
+    if (is_unique_head(first, i, binary_pred))
+    {
+      *result = first[i];
+      ++result;
+    }
+  }
+}
+
+// copies the first key of each group beginning in [begin, end) and its value
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+void copy_unique_heads_by_key(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  Size begin,
+  Size end,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  BinaryPredicate binary_pred)
+{
+  for (Size i = begin; i < end; ++i)
+  {
+    if (is_unique_head(keys_first, i, binary_pred))
+    {
+      *keys_result   = keys_first[i];
+      *values_result = values_first[i];
+      ++keys_result;
+      ++values_result;
+    }
+  }
+}
+
+// Moves the first element of each group beginning in [begin, end) to the
+// front of that range and returns their number. The element at end - 1 is
+// only ever assigned to itself, which is skipped, so that the tile following
+// this one may read it concurrently to find its own first group.
+template <typename RandomAccessIterator, typename Size, typename BinaryPredicate>
+Size compact_unique_heads(RandomAccessIterator first, Size begin, Size end, BinaryPredicate binary_pred)
+{
+  Size result = begin;
+
+  for (Size i = begin; i < end; ++i)
+  {
+    // first[i - 1] is intact, as nothing was moved to i - 1 but itself
+    if (is_unique_head(first, i, binary_pred))
+    {
+      if (result != i)
+      {
+        first[result] = first[i];
+      }
+
+      ++result;
+    }
+  }
+
+  return result - begin;
+}
+
+// like compact_unique_heads, moving the values along with the keys
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename BinaryPredicate>
+Size compact_unique_heads_by_key(RandomAccessIterator1 keys_first,
+                                 RandomAccessIterator2 values_first,
+                                 Size begin,
+                                 Size end,
+                                 BinaryPredicate binary_pred)
+{
+  Size result = begin;
+
+  for (Size i = begin; i < end; ++i)
+  {
+    if (is_unique_head(keys_first, i, binary_pred))
+    {
+      if (result != i)
+      {
+        keys_first[result]   = keys_first[i];
+        values_first[result] = values_first[i];
+      }
+
+      ++result;
+    }
+  }
+
+  return result - begin;
+}
+
+} // namespace internal
+} // namespace detail
+} // namespace system
+THRUST_NAMESPACE_END
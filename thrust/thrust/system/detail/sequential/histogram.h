@@ -0,0 +1,125 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file histogram.h
+ *  \brief Sequential implementation of histogram.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/histogram.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace histogram_detail
+{
+
+// counts directly into the output
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename OutputIterator, typename BinIndex>
+_CCCL_HOST_DEVICE OutputIterator count_into(
+  RandomAccessIterator first, RandomAccessIterator last, OutputIterator histogram, int num_bins, BinIndex bin_index)
+{
+  using CountType = typename thrust::iterator_value<OutputIterator>::type;
+
+  if (num_bins <= 0)
+  {
+    return histogram;
+  }
+
+  for (int i = 0; i < num_bins; ++i)
+  {
+    histogram[i] = CountType(0);
+  }
+
+  thrust::system::detail::internal::histogram_tile(
+    first, thrust::distance(first, last), bin_index, num_bins, histogram);
+
+  return histogram + num_bins;
+}
+
+} // namespace histogram_detail
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator, typename Level>
+_CCCL_HOST_DEVICE OutputIterator histogram_even(
+  sequential::execution_policy<DerivedPolicy>&,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  Level lower_level,
+  Level upper_level)
+{
+  const int num_bins = num_levels - 1;
+
+  if (num_bins <= 0)
+  {
+    return histogram;
+  }
+
+  return histogram_detail::count_into(
+    first,
+    last,
+    histogram,
+    num_bins,
+    thrust::system::detail::internal::even_bin_index<Level>(lower_level, upper_level, num_bins));
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator>
+_CCCL_HOST_DEVICE OutputIterator histogram_range(
+  sequential::execution_policy<DerivedPolicy>&,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 levels_first,
+  RandomAccessIterator2 levels_last,
+  OutputIterator histogram)
+{
+  const int num_levels = static_cast<int>(thrust::distance(levels_first, levels_last));
+
+  return histogram_detail::count_into(
+    first,
+    last,
+    histogram,
+    num_levels - 1,
+    thrust::system::detail::internal::range_bin_index<RandomAccessIterator2>{levels_first, num_levels});
+}
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
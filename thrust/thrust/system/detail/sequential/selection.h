@@ -0,0 +1,163 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file selection.h
+ *  \brief Sequential implementation of nth_element.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/detail/sequential/insertion_sort.h>
+#include <thrust/system/detail/sequential/partition.h>
+#include <thrust/system/detail/sequential/sort.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace selection_detail
+{
+
+// Orders first[a], first[b] and first[c], and returns a copy of the one in
+// the middle.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename Size, typename Compare>
+_CCCL_HOST_DEVICE typename thrust::iterator_value<RandomAccessIterator>::type
+median_of_three(RandomAccessIterator first, Size a, Size b, Size c, Compare& comp)
+{
+  if (comp(first[b], first[a]))
+  {
+    sequential::iter_swap(first + a, first + b);
+  }
+
+  if (comp(first[c], first[b]))
+  {
+    sequential::iter_swap(first + b, first + c);
+
+    if (comp(first[b], first[a]))
+    {
+      sequential::iter_swap(first + a, first + b);
+    }
+  }
+
+  return first[b];
+}
+
+} // end namespace selection_detail
+
+// Quickselect around the median of the first, middle and last elements, which
+// only ever keeps the side of the nth element. Ranges which are still long
+// after twice the expected number of steps are sorted instead, which bounds
+// the work on inputs built to defeat the median of three.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void nth_element(
+  sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator nth,
+  RandomAccessIterator last,
+  StrictWeakOrdering comp)
+{
+  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+  using Size       = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  Size lo = 0;
+  Size hi = thrust::distance(first, last);
+
+  const Size k = thrust::distance(first, nth);
+
+  if (k >= hi)
+  {
+    return;
+  }
+
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  int steps_left = 0;
+  for (Size n = hi; n > 1; n /= 2)
+  {
+    steps_left += 2;
+  }
+
+  while (hi - lo > 16)
+  {
+    if (steps_left-- == 0)
+    {
+      sequential::stable_sort(exec, first + lo, first + hi, comp);
+      return;
+    }
+
+    // first[lo] and first[hi - 1] bound the scans below from either side
+    const value_type pivot =
+      selection_detail::median_of_three(first, lo, lo + (hi - lo) / 2, hi - 1, wrapped_comp);
+
+    Size i = lo - 1;
+    Size j = hi;
+
+    while (true)
+    {
+      do
+      {
+        ++i;
+      } while (wrapped_comp(first[i], pivot));
+
+      do
+      {
+        --j;
+      } while (wrapped_comp(pivot, first[j]));
+
+      if (i >= j)
+      {
+        break;
+      }
+
+      sequential::iter_swap(first + i, first + j);
+    }
+
+    // nothing in [lo, j] is above the pivot and nothing in [j + 1, hi) below it
+    if (k <= j)
+    {
+      hi = j + 1;
+    }
+    else
+    {
+      lo = j + 1;
+    }
+  }
+
+  sequential::insertion_sort(first + lo, first + hi, comp);
+} // end nth_element()
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
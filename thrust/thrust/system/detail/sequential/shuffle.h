@@ -0,0 +1,80 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file shuffle.h
+ *  \brief Sequential implementation of shuffle.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/bijection_shuffle.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+
+// computes the permutation of the generic shuffle in a single pass, so that
+// every system agrees on the result for a given seed
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename URBG>
+_CCCL_HOST_DEVICE void shuffle_copy(
+  sequential::execution_policy<DerivedPolicy>&,
+  RandomIterator first,
+  RandomIterator last,
+  OutputIterator result,
+  URBG&& g)
+{
+  const std::uint64_t n = static_cast<std::uint64_t>(thrust::distance(first, last));
+
+  const thrust::system::detail::internal::bijection_shuffle plan(n, g);
+  plan.scatter_tile(first, 0, plan.size(), result, 0);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename RandomIterator, typename URBG>
+_CCCL_HOST_DEVICE void
+shuffle(sequential::execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, URBG&& g)
+{
+  using InputType = typename thrust::iterator_value<RandomIterator>::type;
+
+  // the elements are gathered in a random order, which can't be done in place
+  thrust::detail::temporary_array<InputType, DerivedPolicy> temp(exec, first, last);
+  sequential::shuffle_copy(exec, temp.begin(), temp.end(), first, g);
+}
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
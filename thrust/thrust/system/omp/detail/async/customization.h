@@ -0,0 +1,100 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp14_required.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#  include <thrust/detail/execute_with_dependencies.h>
+#  include <thrust/system/detail/internal/host_async/task_pool.h>
+#  include <thrust/system/omp/detail/execution_policy.h>
+#  include <thrust/system/omp/future.h>
+
+#  include <tuple>
+#  include <utility>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace async_detail
+{
+
+struct submit_to_pool
+{
+  void operator()(thrust::system::detail::internal::host_async::task_ptr t) const
+  {
+    thrust::system::detail::internal::host_async::task_pool::instance().submit(std::move(t));
+  }
+};
+
+// Takes over the dependencies of policy, then runs f(policy) on the task pool
+// once they have completed. The policy itself moves along with the work, so
+// that per-call controls and allocators still apply.
+template <typename DerivedPolicy, typename F, typename... Dependencies>
+unique_eager_event invoke(DerivedPolicy& policy, F&& f, std::tuple<Dependencies...>&& extra_deps)
+{
+  auto deps = std::tuple_cat(thrust::detail::extract_dependencies(std::move(policy)), std::move(extra_deps));
+
+  return thrust::system::detail::internal::host_async::make_dependent_event<tag>(
+    submit_to_pool{},
+    [policy = std::move(policy), f = std::forward<F>(f)]() mutable {
+      f(policy);
+    },
+    std::move(deps));
+}
+
+template <typename DerivedPolicy, typename F>
+unique_eager_event invoke(DerivedPolicy& policy, F&& f)
+{
+  return async_detail::invoke(policy, std::forward<F>(f), std::tuple<>{});
+}
+
+// Like invoke, but the result of f(policy) becomes the content of a future.
+template <typename T, typename DerivedPolicy, typename F>
+unique_eager_future<T> invoke_future(DerivedPolicy& policy, F&& f)
+{
+  auto deps = thrust::detail::extract_dependencies(std::move(policy));
+
+  return thrust::system::detail::internal::host_async::make_dependent_future<tag, T>(
+    submit_to_pool{},
+    [policy = std::move(policy), f = std::forward<F>(f)]() mutable {
+      return f(policy);
+    },
+    std::move(deps));
+}
+
+} // namespace async_detail
+} // namespace detail
+} // namespace omp
+} // namespace system
+THRUST_NAMESPACE_END
+
+#endif // C++14
@@ -0,0 +1,78 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp14_required.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#  include <thrust/scan.h>
+#  include <thrust/system/omp/detail/async/customization.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+// ADL entry point.
+template <typename DerivedPolicy, typename ForwardIt, typename Sentinel, typename OutputIt, typename BinaryOp>
+unique_eager_event
+async_inclusive_scan(execution_policy<DerivedPolicy>& policy, ForwardIt first, Sentinel last, OutputIt out, BinaryOp op)
+{
+  return async_detail::invoke(thrust::detail::derived_cast(policy), [=](DerivedPolicy& p) {
+    thrust::inclusive_scan(p, first, last, out, op);
+  });
+}
+
+// ADL entry point.
+template <typename DerivedPolicy,
+          typename ForwardIt,
+          typename Sentinel,
+          typename OutputIt,
+          typename InitialValueType,
+          typename BinaryOp>
+unique_eager_event async_exclusive_scan(
+  execution_policy<DerivedPolicy>& policy,
+  ForwardIt first,
+  Sentinel last,
+  OutputIt out,
+  InitialValueType init,
+  BinaryOp op)
+{
+  return async_detail::invoke(thrust::detail::derived_cast(policy), [=](DerivedPolicy& p) {
+    thrust::exclusive_scan(p, first, last, out, init, op);
+  });
+}
+
+} // namespace detail
+} // namespace omp
+} // namespace system
+THRUST_NAMESPACE_END
+
+#endif // C++14
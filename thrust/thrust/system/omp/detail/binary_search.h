@@ -25,8 +25,17 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/static_assert.h>
 #include <thrust/system/detail/generic/binary_search.h>
+#include <thrust/system/detail/internal/batched_search.h>
+#include <thrust/system/detail/internal/tile_compaction.h>
+#include <thrust/system/detail/internal/tuning_profile.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+#include <cstdint>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -35,6 +44,94 @@ namespace omp
 {
 namespace detail
 {
+namespace binary_search_detail
+{
+
+// every thread searches for a tile of the queries, in groups or merging
+// them into the haystack if they are sorted
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename StrictWeakOrdering,
+          typename Search,
+          typename BinarySearchFunction>
+RandomAccessIterator3 batched_search(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 begin,
+  RandomAccessIterator1 end,
+  RandomAccessIterator2 values_begin,
+  RandomAccessIterator2 values_end,
+  RandomAccessIterator3 output,
+  StrictWeakOrdering comp,
+  Search search,
+  BinarySearchFunction,
+  thrust::detail::true_type) // is_tileable
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<RandomAccessIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using index_type = std::intptr_t;
+
+  const index_type n          = static_cast<index_type>(end - begin);
+  const index_type num_values = static_cast<index_type>(values_end - values_begin);
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  // the prefetches only apply to pointers
+  auto first = thrust::try_unwrap_contiguous_iterator(begin);
+
+  const thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+    thrust::system::omp::detail::default_decomposition(
+      exec,
+      num_values,
+      thrust::system::detail::internal::tuning_family::for_each,
+      thrust::system::detail::internal::tuning_element_size<RandomAccessIterator2>::value);
+
+  const int threads          = thrust::system::omp::detail::thread_count(exec);
+  const index_type num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    thrust::system::detail::internal::batched_search(
+      first, n, values_begin, decomp[i].begin(), decomp[i].end(), output, comp, search);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return output + num_values;
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename Search,
+          typename BinarySearchFunction>
+OutputIterator batched_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp,
+  Search,
+  BinarySearchFunction func,
+  thrust::detail::false_type) // is_tileable
+{
+  return thrust::system::detail::generic::detail::binary_search(
+    exec, begin, end, values_begin, values_end, output, comp, func);
+}
+
+} // namespace binary_search_detail
 
 template <typename DerivedPolicy, typename ForwardIterator, typename T, typename StrictWeakOrdering>
 ForwardIterator lower_bound(
@@ -71,6 +168,87 @@ bool binary_search(execution_policy<DerivedPolicy>& exec,
   return thrust::system::detail::generic::binary_search(exec, begin, end, value, comp);
 }
 
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator lower_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::batched_search(
+    exec,
+    begin,
+    end,
+    values_begin,
+    values_end,
+    output,
+    comp,
+    thrust::system::detail::internal::lower_bound_search(),
+    thrust::system::detail::generic::detail::lbf(),
+    thrust::system::detail::internal::is_tileable<ForwardIterator, InputIterator, OutputIterator>());
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator upper_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::batched_search(
+    exec,
+    begin,
+    end,
+    values_begin,
+    values_end,
+    output,
+    comp,
+    thrust::system::detail::internal::upper_bound_search(),
+    thrust::system::detail::generic::detail::ubf(),
+    thrust::system::detail::internal::is_tileable<ForwardIterator, InputIterator, OutputIterator>());
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator binary_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::batched_search(
+    exec,
+    begin,
+    end,
+    values_begin,
+    values_end,
+    output,
+    comp,
+    thrust::system::detail::internal::binary_search_search(),
+    thrust::system::detail::generic::detail::bsf(),
+    thrust::system::detail::internal::is_tileable<ForwardIterator, InputIterator, OutputIterator>());
+}
+
 } // namespace detail
 } // namespace omp
 } // namespace system
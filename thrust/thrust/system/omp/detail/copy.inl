@@ -25,10 +25,20 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/static_assert.h>
 #include <thrust/detail/type_traits/minimum_type.h>
 #include <thrust/system/detail/generic/copy.h>
+#include <thrust/system/detail/internal/trivial_copy.h>
 #include <thrust/system/detail/sequential/copy.h>
+#include <thrust/system/detail/sequential/trivial_copy.h>
 #include <thrust/system/omp/detail/copy.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/tuning.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
+
+#include <cstdint>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -37,6 +47,54 @@ namespace omp
 {
 namespace detail
 {
+
+// copies trivially relocatable data with one memcpy per thread over whole
+// pages of the destination
+template <typename DerivedPolicy, typename T, typename Size>
+T* trivial_copy_n(execution_policy<DerivedPolicy>& exec, const T* first, Size n, T* result)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<T, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  namespace internal = thrust::system::detail::internal;
+  using index_type   = std::intptr_t;
+
+  if (n <= 0)
+  {
+    return result;
+  }
+
+  const std::size_t bytes                 = static_cast<std::size_t>(n) * sizeof(T);
+  const internal::tuning_cutoffs& cutoffs = tuning_profile_storage()[internal::tuning_family::copy];
+  const internal::trivial_copy_partition partition(
+    result, static_cast<std::size_t>(n), sizeof(T), thread_count(exec), cutoffs);
+
+  if (partition.size() < 2 || internal::trivial_copy_overlaps(first, result, bytes))
+  {
+    return thrust::system::detail::sequential::trivial_copy_n(first, n, result);
+  }
+
+  const bool streaming    = internal::use_streaming_stores(bytes);
+  const index_type chunks = static_cast<index_type>(partition.size());
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(static_cast<int>(chunks)) schedule(static, 1))
+  for (index_type i = 0; i < chunks; ++i)
+  {
+    const std::size_t begin = partition.begin(i);
+    const std::size_t end   = partition.end(i);
+
+    internal::copy_bytes(result + begin, first + begin, (end - begin) * sizeof(T), streaming);
+  }
+
+  return result + n;
+} // end trivial_copy_n()
+
 namespace dispatch
 {
 
@@ -51,6 +109,32 @@ copy(execution_policy<DerivedPolicy>& exec,
   return thrust::system::detail::sequential::copy(exec, first, last, result);
 } // end copy()
 
+template <typename DerivedPolicy, typename InputIterator, typename Size, typename OutputIterator>
+OutputIterator
+copy_n(execution_policy<DerivedPolicy>& exec,
+       InputIterator first,
+       Size n,
+       OutputIterator result,
+       thrust::random_access_traversal_tag,
+       thrust::detail::true_type) // is_indirectly_trivially_relocatable_to
+{
+  omp::detail::trivial_copy_n(
+    exec, thrust::unwrap_contiguous_iterator(first), n, thrust::unwrap_contiguous_iterator(result));
+  return result + n;
+} // end copy_n()
+
+template <typename DerivedPolicy, typename InputIterator, typename Size, typename OutputIterator>
+OutputIterator
+copy_n(execution_policy<DerivedPolicy>& exec,
+       InputIterator first,
+       Size n,
+       OutputIterator result,
+       thrust::random_access_traversal_tag,
+       thrust::detail::false_type) // is_indirectly_trivially_relocatable_to
+{
+  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+} // end copy_n()
+
 template <typename DerivedPolicy, typename InputIterator, typename OutputIterator>
 OutputIterator
 copy(execution_policy<DerivedPolicy>& exec,
@@ -59,7 +143,13 @@ copy(execution_policy<DerivedPolicy>& exec,
      OutputIterator result,
      thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy(exec, first, last, result);
+  return dispatch::copy_n(
+    exec,
+    first,
+    last - first,
+    result,
+    thrust::random_access_traversal_tag(),
+    typename thrust::is_indirectly_trivially_relocatable_to<InputIterator, OutputIterator>::type());
 } // end copy()
 
 template <typename DerivedPolicy, typename InputIterator, typename Size, typename OutputIterator>
@@ -81,7 +171,13 @@ copy_n(execution_policy<DerivedPolicy>& exec,
        OutputIterator result,
        thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+  return dispatch::copy_n(
+    exec,
+    first,
+    n,
+    result,
+    thrust::random_access_traversal_tag(),
+    typename thrust::is_indirectly_trivially_relocatable_to<InputIterator, OutputIterator>::type());
 } // end copy_n()
 
 } // namespace dispatch
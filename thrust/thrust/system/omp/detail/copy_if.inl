@@ -25,8 +25,17 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
 #include <thrust/system/detail/generic/copy_if.h>
+#include <thrust/system/detail/internal/tile_compaction.h>
+#include <thrust/system/detail/sequential/copy_if.h>
+#include <thrust/system/omp/detail/compact_tiles.h>
 #include <thrust/system/omp/detail/copy_if.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cstdint>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -35,6 +44,60 @@ namespace omp
 {
 namespace detail
 {
+namespace copy_if_detail
+{
+
+// counts the selected elements of every tile, then copies each tile's
+// selected elements to where the counts of its predecessors say
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessOutputIterator,
+          typename Predicate>
+RandomAccessOutputIterator copy_if(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 stencil,
+  RandomAccessOutputIterator result,
+  Predicate pred,
+  thrust::detail::true_type) // is_tileable
+{
+  namespace internal = thrust::system::detail::internal;
+  using index_type   = std::intptr_t;
+
+  const internal::uniform_decomposition<index_type> decomp = compact_detail::decompose(exec, first, last);
+
+  if (decomp.size() < 2)
+  {
+    return thrust::system::detail::sequential::copy_if(exec, first, last, stencil, result, pred);
+  }
+
+  const index_type num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<index_type, DerivedPolicy> offsets(exec, num_tiles + 1);
+  index_type* tile_offsets = thrust::raw_pointer_cast(offsets.data());
+
+  compact_detail::count_tiles(exec, stencil, decomp, tile_offsets, pred);
+
+  const index_type num_selected = internal::tile_offsets(tile_offsets, num_tiles);
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const int threads = thrust::system::omp::detail::thread_count(exec);
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    const index_type begin = decomp[i].begin();
+    const index_type end   = decomp[i].end();
+
+    thrust::system::detail::sequential::copy_if(
+      exec, first + begin, first + end, stencil + begin, result + tile_offsets[i], pred);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return result + num_selected;
+} // end copy_if()
 
 template <typename DerivedPolicy,
           typename InputIterator1,
@@ -47,12 +110,37 @@ OutputIterator copy_if(
   InputIterator1 last,
   InputIterator2 stencil,
   OutputIterator result,
-  Predicate pred)
+  Predicate pred,
+  thrust::detail::false_type) // is_tileable
 {
-  // omp prefers generic::copy_if to cpp::copy_if
   return thrust::system::detail::generic::copy_if(exec, first, last, stencil, result, pred);
 } // end copy_if()
 
+} // end namespace copy_if_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename Predicate>
+OutputIterator copy_if(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first,
+  InputIterator1 last,
+  InputIterator2 stencil,
+  OutputIterator result,
+  Predicate pred)
+{
+  return copy_if_detail::copy_if(
+    exec,
+    first,
+    last,
+    stencil,
+    result,
+    pred,
+    typename thrust::system::detail::internal::is_tileable<InputIterator1, InputIterator2, OutputIterator>::type());
+} // end copy_if()
+
 } // namespace detail
 } // namespace omp
 } // namespace system
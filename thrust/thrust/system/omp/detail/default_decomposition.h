@@ -30,6 +30,10 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/tuning_profile.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+
+#include <cstddef>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -39,8 +43,40 @@ namespace omp
 namespace detail
 {
 
-template <typename IndexType>
-thrust::system::detail::internal::uniform_decomposition<IndexType> default_decomposition(IndexType n);
+// policies without per-call controls leave both to the defaults below
+template <typename DerivedPolicy>
+int get_num_threads(const execution_policy<DerivedPolicy>&)
+{
+  return 0;
+}
+
+template <typename DerivedPolicy>
+std::size_t get_grain_size(const execution_policy<DerivedPolicy>&)
+{
+  return 0;
+}
+
+// the team size of parallel regions run on behalf of exec: the policy's
+// thread count if it has one, otherwise OpenMP's default capped by the
+// tuning profile
+template <typename DerivedPolicy>
+int thread_count(execution_policy<DerivedPolicy>& exec);
+
+// splits [0, n) into at most one tile per thread of exec (one per processor by
+// default), each at least the policy's grain size long
+template <typename DerivedPolicy, typename IndexType>
+thrust::system::detail::internal::uniform_decomposition<IndexType>
+default_decomposition(execution_policy<DerivedPolicy>& exec, IndexType n);
+
+// like above, but unless exec has a thread count or grain size, runs inputs
+// of n elements of element_size bytes serially or splits them into tiles as
+// the tuning profile prescribes for family
+template <typename DerivedPolicy, typename IndexType>
+thrust::system::detail::internal::uniform_decomposition<IndexType> default_decomposition(
+  execution_policy<DerivedPolicy>& exec,
+  IndexType n,
+  thrust::system::detail::internal::tuning_family family,
+  std::size_t element_size);
 
 } // end namespace detail
 } // end namespace omp
@@ -25,7 +25,9 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/instrumentation.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/tuning.h>
 
 // don't attempt to #include this file without omp support
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
@@ -40,23 +42,113 @@ namespace omp
 namespace detail
 {
 
-template <typename IndexType>
-thrust::system::detail::internal::uniform_decomposition<IndexType> default_decomposition(IndexType n)
+template <typename DerivedPolicy>
+int thread_count(execution_policy<DerivedPolicy>& exec)
 {
   // we're attempting to launch an omp kernel, assert we're compiling with omp support
   // ========================================================================
   // X Note to the user: If you've found this line due to a compiler error, X
-  // X you need to OpenMP support in your compiler.                         X
+  // X you need to enable OpenMP support in your compiler.                  X
   // ========================================================================
   THRUST_STATIC_ASSERT_MSG(
-    (thrust::detail::depend_on_instantiation<IndexType, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    (thrust::detail::depend_on_instantiation<DerivedPolicy,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
     "OpenMP compiler support is not enabled");
 
+  const int num_threads = get_num_threads(thrust::detail::derived_cast(exec));
+
+  if (num_threads > 0)
+  {
+    THRUST_DETAIL_INSTRUMENT_THREADS(num_threads);
+    return num_threads;
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const int default_threads = omp_get_max_threads();
+#else
+  const int default_threads = 1;
+#endif
+
+  const int max_threads = tuning_profile_storage().max_threads;
+  const int result      = max_threads > 0 && max_threads < default_threads ? max_threads : default_threads;
+
+  THRUST_DETAIL_INSTRUMENT_THREADS(result);
+
+  return result;
+}
+
+namespace decomposition_detail
+{
+
+// one tile per thread of exec, or per processor by default
+template <typename DerivedPolicy>
+int max_tiles(execution_policy<DerivedPolicy>& exec)
+{
+  const int num_threads = get_num_threads(thrust::detail::derived_cast(exec));
+
+  if (num_threads > 0)
+  {
+    return num_threads;
+  }
+
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, omp_get_num_procs());
+  const int default_tiles = omp_get_num_procs();
 #else
-  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, 1);
+  const int default_tiles = 1;
 #endif
+
+  const int max_threads = tuning_profile_storage().max_threads;
+
+  return max_threads > 0 && max_threads < default_tiles ? max_threads : default_tiles;
+}
+
+} // namespace decomposition_detail
+
+template <typename DerivedPolicy, typename IndexType>
+thrust::system::detail::internal::uniform_decomposition<IndexType>
+default_decomposition(execution_policy<DerivedPolicy>& exec, IndexType n)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to OpenMP support in your compiler.                         X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<IndexType, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  const std::size_t grain_size = get_grain_size(thrust::detail::derived_cast(exec));
+
+  const IndexType granularity = grain_size > 0 ? static_cast<IndexType>(grain_size) : IndexType(1);
+
+  return thrust::system::detail::internal::uniform_decomposition<IndexType>(
+    n, granularity, static_cast<IndexType>(decomposition_detail::max_tiles(exec)));
+}
+
+template <typename DerivedPolicy, typename IndexType>
+thrust::system::detail::internal::uniform_decomposition<IndexType> default_decomposition(
+  execution_policy<DerivedPolicy>& exec,
+  IndexType n,
+  thrust::system::detail::internal::tuning_family family,
+  std::size_t element_size)
+{
+  // the per-call controls of the policy take precedence over the profile
+  if (get_num_threads(thrust::detail::derived_cast(exec)) > 0 || get_grain_size(thrust::detail::derived_cast(exec)) > 0)
+  {
+    return thrust::system::omp::detail::default_decomposition(exec, n);
+  }
+
+  const thrust::system::detail::internal::tuning_profile& profile = tuning_profile_storage();
+
+  if (n <= 0 || static_cast<std::size_t>(n) < profile.serial_cutoff(family, element_size))
+  {
+    return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, n > 0 ? n : IndexType(1), 1);
+  }
+
+  return thrust::system::detail::internal::uniform_decomposition<IndexType>(
+    n,
+    static_cast<IndexType>(profile.tile_size(family, element_size)),
+    static_cast<IndexType>(decomposition_detail::max_tiles(exec)));
 }
 
 } // end namespace detail
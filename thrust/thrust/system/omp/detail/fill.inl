@@ -0,0 +1,164 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/static_assert.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/fill.h>
+#include <thrust/system/detail/internal/trivial_copy.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/fill.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/tuning.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace fill_detail
+{
+
+template <typename OutputIterator, typename T>
+using is_trivial_fill =
+  thrust::detail::integral_constant<bool,
+                                    thrust::is_contiguous_iterator<OutputIterator>::value
+                                      && thrust::system::detail::internal::is_trivially_fillable<
+                                        typename thrust::iterator_value<OutputIterator>::type,
+                                        T>::value>;
+
+// fills trivially copyable data with one memset, or store loop, per thread
+// over whole pages of the destination
+template <typename DerivedPolicy, typename T>
+void trivial_fill_n(execution_policy<DerivedPolicy>& exec, T* first, std::size_t n, const T& value)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<T, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  namespace internal = thrust::system::detail::internal;
+  using index_type   = std::intptr_t;
+
+  const bool streaming                    = internal::use_streaming_stores(n * sizeof(T));
+  const internal::tuning_cutoffs& cutoffs = tuning_profile_storage()[internal::tuning_family::copy];
+  const internal::trivial_copy_partition partition(first, n, sizeof(T), thread_count(exec), cutoffs);
+
+  if (partition.size() < 2)
+  {
+    internal::fill_elements(first, n, value, streaming);
+    return;
+  }
+
+  const index_type chunks = static_cast<index_type>(partition.size());
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(static_cast<int>(chunks)) schedule(static, 1))
+  for (index_type i = 0; i < chunks; ++i)
+  {
+    const std::size_t begin = partition.begin(i);
+    const std::size_t end   = partition.end(i);
+
+    internal::fill_elements(first + begin, end - begin, value, streaming);
+  }
+} // end trivial_fill_n()
+
+template <typename DerivedPolicy, typename OutputIterator, typename Size, typename T>
+OutputIterator fill_n(execution_policy<DerivedPolicy>& exec,
+                      OutputIterator first,
+                      Size n,
+                      const T& value,
+                      thrust::detail::true_type) // is_trivial_fill
+{
+  using value_type = typename thrust::iterator_value<OutputIterator>::type;
+
+  if (n <= 0)
+  {
+    return first;
+  }
+
+  fill_detail::trivial_fill_n(
+    exec, thrust::unwrap_contiguous_iterator(first), static_cast<std::size_t>(n), static_cast<value_type>(value));
+
+  return first + n;
+} // end fill_n()
+
+template <typename DerivedPolicy, typename OutputIterator, typename Size, typename T>
+OutputIterator fill_n(execution_policy<DerivedPolicy>& exec,
+                      OutputIterator first,
+                      Size n,
+                      const T& value,
+                      thrust::detail::false_type) // is_trivial_fill
+{
+  return thrust::system::detail::generic::fill_n(exec, first, n, value);
+} // end fill_n()
+
+template <typename DerivedPolicy, typename ForwardIterator, typename T>
+void fill(execution_policy<DerivedPolicy>& exec,
+          ForwardIterator first,
+          ForwardIterator last,
+          const T& value,
+          thrust::detail::true_type) // is_trivial_fill
+{
+  fill_detail::fill_n(exec, first, last - first, value, thrust::detail::true_type());
+} // end fill()
+
+template <typename DerivedPolicy, typename ForwardIterator, typename T>
+void fill(execution_policy<DerivedPolicy>& exec,
+          ForwardIterator first,
+          ForwardIterator last,
+          const T& value,
+          thrust::detail::false_type) // is_trivial_fill
+{
+  thrust::system::detail::generic::fill(exec, first, last, value);
+} // end fill()
+
+} // namespace fill_detail
+
+template <typename DerivedPolicy, typename OutputIterator, typename Size, typename T>
+OutputIterator fill_n(execution_policy<DerivedPolicy>& exec, OutputIterator first, Size n, const T& value)
+{
+  return fill_detail::fill_n(exec, first, n, value, typename fill_detail::is_trivial_fill<OutputIterator, T>::type());
+} // end fill_n()
+
+template <typename DerivedPolicy, typename ForwardIterator, typename T>
+void fill(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, const T& value)
+{
+  fill_detail::fill(exec, first, last, value, typename fill_detail::is_trivial_fill<ForwardIterator, T>::type());
+} // end fill()
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
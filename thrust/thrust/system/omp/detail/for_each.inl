@@ -30,6 +30,7 @@
 #include <thrust/distance.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/pragma_omp.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -41,7 +42,8 @@ namespace detail
 {
 
 template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename UnaryFunction>
-RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIterator first, Size n, UnaryFunction f)
+RandomAccessIterator
+for_each_n(execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, Size n, UnaryFunction f)
 {
   // we're attempting to launch an omp kernel, assert we're compiling with omp support
   // ========================================================================
@@ -65,11 +67,38 @@ RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIt
   using DifferenceType    = typename thrust::iterator_difference<RandomAccessIterator>::type;
   DifferenceType signed_n = n;
 
-  THRUST_PRAGMA_OMP(parallel for)
-  for (DifferenceType i = 0; i < signed_n; ++i)
+  // hand out the iterations in one contiguous tile per thread, each at least
+  // the policy's grain size long
+  thrust::system::detail::internal::uniform_decomposition<DifferenceType> decomp =
+    thrust::system::omp::detail::default_decomposition(
+      exec,
+      signed_n,
+      thrust::system::detail::internal::tuning_family::for_each,
+      thrust::system::detail::internal::tuning_element_size<RandomAccessIterator>::value);
+
+  // too little work to repay starting a parallel region
+  if (decomp.size() < 2)
+  {
+    for (DifferenceType i = 0; i < signed_n; ++i)
+    {
+      RandomAccessIterator temp = first + i;
+      wrapped_f(*temp);
+    }
+
+    return first + n;
+  }
+
+  const DifferenceType num_tiles = decomp.size();
+  const int threads              = thrust::system::omp::detail::thread_count(exec);
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads) schedule(static, 1))
+  for (DifferenceType tile = 0; tile < num_tiles; ++tile)
   {
-    RandomAccessIterator temp = first + i;
-    wrapped_f(*temp);
+    for (DifferenceType i = decomp[tile].begin(); i < decomp[tile].end(); ++i)
+    {
+      RandomAccessIterator temp = first + i;
+      wrapped_f(*temp);
+    }
   }
 
   return first + n;
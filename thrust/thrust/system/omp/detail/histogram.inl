@@ -0,0 +1,196 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/histogram.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/histogram.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace histogram_detail
+{
+
+// Every tile counts into bins of its own, which are summed afterwards, so
+// that threads never contend for a count.
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator, typename BinIndex>
+OutputIterator privatized_histogram(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator histogram,
+  int num_bins,
+  BinIndex bin_index)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<RandomAccessIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using CountType  = typename thrust::iterator_value<OutputIterator>::type;
+  using index_type = std::intptr_t;
+
+  if (num_bins <= 0)
+  {
+    return histogram;
+  }
+
+  const index_type n = static_cast<index_type>(thrust::distance(first, last));
+
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, n);
+
+  // a single tile counts directly into the output
+  if (decomp.size() < 2)
+  {
+    for (int b = 0; b < num_bins; ++b)
+    {
+      histogram[b] = CountType(0);
+    }
+
+    thrust::system::detail::internal::histogram_tile(first, n, bin_index, num_bins, histogram);
+
+    return histogram + num_bins;
+  }
+
+  const index_type num_tiles = decomp.size();
+
+  // pad the bins of every tile to whole cache lines
+  const index_type counts_per_line = 64 / sizeof(CountType) > 0 ? 64 / sizeof(CountType) : 1;
+  const index_type stride          = (num_bins + counts_per_line - 1) / counts_per_line * counts_per_line;
+
+  thrust::detail::temporary_array<CountType, DerivedPolicy> private_counts(exec, num_tiles * stride);
+
+  CountType* counts = thrust::raw_pointer_cast(private_counts.data());
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const int threads = thrust::system::omp::detail::thread_count(exec);
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; i++)
+  {
+    CountType* tile_counts = counts + i * stride;
+
+    // zeroed by the thread using them, so they are local to it
+    for (index_type b = 0; b < num_bins; ++b)
+    {
+      tile_counts[b] = CountType(0);
+    }
+
+    thrust::system::detail::internal::histogram_tile(
+      first + decomp[i].begin(), decomp[i].size(), bin_index, num_bins, tile_counts);
+  }
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type b = 0; b < num_bins; b++)
+  {
+    CountType sum = counts[b];
+
+    for (index_type i = 1; i < num_tiles; ++i)
+    {
+      sum += counts[i * stride + b];
+    }
+
+    histogram[b] = sum;
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return histogram + num_bins;
+}
+
+} // namespace histogram_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator, typename Level>
+OutputIterator histogram_even(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  Level lower_level,
+  Level upper_level)
+{
+  const int num_bins = num_levels - 1;
+
+  if (num_bins <= 0)
+  {
+    return histogram;
+  }
+
+  return histogram_detail::privatized_histogram(
+    exec,
+    first,
+    last,
+    histogram,
+    num_bins,
+    thrust::system::detail::internal::even_bin_index<Level>(lower_level, upper_level, num_bins));
+} // end histogram_even()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator>
+OutputIterator histogram_range(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 levels_first,
+  RandomAccessIterator2 levels_last,
+  OutputIterator histogram)
+{
+  const int num_levels = static_cast<int>(thrust::distance(levels_first, levels_last));
+
+  return histogram_detail::privatized_histogram(
+    exec,
+    first,
+    last,
+    histogram,
+    num_levels - 1,
+    thrust::system::detail::internal::range_bin_index<RandomAccessIterator2>{levels_first, num_levels});
+} // end histogram_range()
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
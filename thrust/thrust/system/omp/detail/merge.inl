@@ -0,0 +1,244 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/distance.h>
+#include <thrust/merge.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/merge.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace merge_detail
+{
+
+// returns the number of elements the merge of [first1, first1 + n1) and
+// [first2, first2 + n2) consumes from the first range before emitting
+// diag elements; ties are taken from the first range, as thrust::merge does
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename StrictWeakOrdering>
+Size merge_path_search(
+  RandomAccessIterator1 first1, Size n1, RandomAccessIterator2 first2, Size n2, Size diag, StrictWeakOrdering comp)
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  Size lo = diag > n2 ? diag - n2 : Size(0);
+  Size hi = diag < n1 ? diag : n1;
+
+  while (lo < hi)
+  {
+    Size mid = lo + (hi - lo) / 2;
+
+    if (wrapped_comp(first2[diag - mid - 1], first1[mid]))
+    {
+      hi = mid;
+    }
+    else
+    {
+      lo = mid + 1;
+    }
+  }
+
+  return lo;
+}
+
+} // end namespace merge_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator
+merge(execution_policy<DerivedPolicy>& exec,
+      InputIterator1 first1,
+      InputIterator1 last1,
+      InputIterator2 first2,
+      InputIterator2 last2,
+      OutputIterator result,
+      StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using index_type = std::intptr_t;
+
+  const index_type n1 = static_cast<index_type>(thrust::distance(first1, last1));
+  const index_type n2 = static_cast<index_type>(thrust::distance(first2, last2));
+
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+    thrust::system::omp::detail::default_decomposition(
+      exec,
+      n1 + n2,
+      thrust::system::detail::internal::tuning_family::merge,
+      thrust::system::detail::internal::tuning_element_size<InputIterator1>::value);
+
+  if (decomp.size() < 2)
+  {
+    return thrust::merge(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const int threads = thrust::system::omp::detail::thread_count(exec);
+
+  const index_type num_tiles = decomp.size();
+
+  // every tile finds its own starting and ending points on the merge path,
+  // so the tiles merge disjoint slices of the inputs into disjoint slices of the output
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; i++)
+  {
+    const index_type diag_first = decomp[i].begin();
+    const index_type diag_last  = decomp[i].end();
+
+    const index_type a_first = merge_detail::merge_path_search(first1, n1, first2, n2, diag_first, comp);
+    const index_type a_last  = merge_detail::merge_path_search(first1, n1, first2, n2, diag_last, comp);
+
+    thrust::merge(thrust::seq,
+                  first1 + a_first,
+                  first1 + a_last,
+                  first2 + (diag_first - a_first),
+                  first2 + (diag_last - a_last),
+                  result + diag_first,
+                  comp);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return result + (n1 + n2);
+} // end merge()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename InputIterator3,
+          typename InputIterator4,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+thrust::pair<OutputIterator1, OutputIterator2> merge_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 keys_first1,
+  InputIterator1 keys_last1,
+  InputIterator2 keys_first2,
+  InputIterator2 keys_last2,
+  InputIterator3 values_first3,
+  InputIterator4 values_first4,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using index_type = std::intptr_t;
+
+  const index_type n1 = static_cast<index_type>(thrust::distance(keys_first1, keys_last1));
+  const index_type n2 = static_cast<index_type>(thrust::distance(keys_first2, keys_last2));
+
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+    thrust::system::omp::detail::default_decomposition(
+      exec,
+      n1 + n2,
+      thrust::system::detail::internal::tuning_family::merge,
+      thrust::system::detail::internal::tuning_element_size<InputIterator1>::value);
+
+  if (decomp.size() < 2)
+  {
+    return thrust::merge_by_key(
+      thrust::seq,
+      keys_first1,
+      keys_last1,
+      keys_first2,
+      keys_last2,
+      values_first3,
+      values_first4,
+      keys_result,
+      values_result,
+      comp);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const int threads = thrust::system::omp::detail::thread_count(exec);
+
+  const index_type num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; i++)
+  {
+    const index_type diag_first = decomp[i].begin();
+    const index_type diag_last  = decomp[i].end();
+
+    const index_type a_first = merge_detail::merge_path_search(keys_first1, n1, keys_first2, n2, diag_first, comp);
+    const index_type a_last  = merge_detail::merge_path_search(keys_first1, n1, keys_first2, n2, diag_last, comp);
+    const index_type b_first = diag_first - a_first;
+    const index_type b_last  = diag_last - a_last;
+
+    thrust::merge_by_key(
+      thrust::seq,
+      keys_first1 + a_first,
+      keys_first1 + a_last,
+      keys_first2 + b_first,
+      keys_first2 + b_last,
+      values_first3 + a_first,
+      values_first4 + b_first,
+      keys_result + diag_first,
+      values_result + diag_first,
+      comp);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return thrust::make_pair(keys_result + (n1 + n2), values_result + (n1 + n2));
+} // end merge_by_key()
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -26,8 +26,11 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/allocator_aware_execution_policy.h>
+#include <thrust/detail/dependencies_aware_execution_policy.h>
 #include <thrust/system/omp/detail/execution_policy.h>
 
+#include <cstddef>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -36,13 +39,77 @@ namespace omp
 namespace detail
 {
 
+// carries the per-call controls of omp::par: the number of threads parallel
+// regions use and the smallest amount of work handed to a single thread
+template <typename Derived>
+struct execute_with_threads_base : thrust::system::omp::detail::execution_policy<Derived>
+{
+private:
+  int num_threads;
+  std::size_t grain_size;
+
+public:
+  execute_with_threads_base(int num_threads_ = 0, std::size_t grain_size_ = 0)
+      : num_threads(num_threads_)
+      , grain_size(grain_size_)
+  {}
+
+  Derived with_threads(int n) const
+  {
+    Derived result     = thrust::detail::derived_cast(*this);
+    result.num_threads = n;
+    return result;
+  }
+
+  Derived with_grain(std::size_t g) const
+  {
+    Derived result    = thrust::detail::derived_cast(*this);
+    result.grain_size = g;
+    return result;
+  }
+
+private:
+  friend int get_num_threads(const execute_with_threads_base& exec)
+  {
+    return exec.num_threads;
+  }
+
+  friend std::size_t get_grain_size(const execute_with_threads_base& exec)
+  {
+    return exec.grain_size;
+  }
+};
+
+struct execute_with_threads : execute_with_threads_base<execute_with_threads>
+{
+  using base_t = execute_with_threads_base<execute_with_threads>;
+
+  execute_with_threads(int num_threads, std::size_t grain_size)
+      : base_t(num_threads, grain_size)
+  {}
+};
+
 struct par_t
     : thrust::system::omp::detail::execution_policy<par_t>
-    , thrust::detail::allocator_aware_execution_policy<thrust::system::omp::detail::execution_policy>
+    , thrust::detail::allocator_aware_execution_policy<execute_with_threads_base>
+    , thrust::detail::dependencies_aware_execution_policy<execute_with_threads_base>
 {
   _CCCL_HOST_DEVICE constexpr par_t()
       : thrust::system::omp::detail::execution_policy<par_t>()
   {}
+
+  // runs the parallel regions of an algorithm on n threads, which also
+  // bounds the number of tiles its input is split into
+  execute_with_threads with_threads(int n) const
+  {
+    return execute_with_threads(n, 0);
+  }
+
+  // never splits off tiles of fewer than g elements
+  execute_with_threads with_grain(std::size_t g) const
+  {
+    return execute_with_threads(0, g);
+  }
 };
 
 } // namespace detail
@@ -29,8 +29,18 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/pair.h>
 #include <thrust/system/detail/generic/partition.h>
+#include <thrust/system/detail/internal/tile_compaction.h>
+#include <thrust/system/detail/sequential/partition.h>
+#include <thrust/system/omp/detail/compact_tiles.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/partition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cstdint>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -60,6 +70,91 @@ ForwardIterator stable_partition(
   return thrust::system::detail::generic::stable_partition(exec, first, last, stencil, pred);
 } // end stable_partition()
 
+namespace partition_detail
+{
+
+// counts the elements of every tile that go to out_true; the rest of each
+// tile goes to out_false, so every tile is written in a single pass
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessOutputIterator1,
+          typename RandomAccessOutputIterator2,
+          typename Predicate>
+thrust::pair<RandomAccessOutputIterator1, RandomAccessOutputIterator2> stable_partition_copy(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 stencil,
+  RandomAccessOutputIterator1 out_true,
+  RandomAccessOutputIterator2 out_false,
+  Predicate pred,
+  thrust::detail::true_type) // is_tileable
+{
+  namespace internal = thrust::system::detail::internal;
+  using index_type   = std::intptr_t;
+
+  const internal::uniform_decomposition<index_type> decomp = compact_detail::decompose(exec, first, last);
+
+  if (decomp.size() < 2)
+  {
+    return thrust::system::detail::sequential::stable_partition_copy(
+      exec, first, last, stencil, out_true, out_false, pred);
+  }
+
+  const index_type num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<index_type, DerivedPolicy> offsets(exec, num_tiles + 1);
+  index_type* tile_offsets = thrust::raw_pointer_cast(offsets.data());
+
+  compact_detail::count_tiles(exec, stencil, decomp, tile_offsets, pred);
+
+  const index_type num_true = internal::tile_offsets(tile_offsets, num_tiles);
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const int threads = thrust::system::omp::detail::thread_count(exec);
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    const index_type begin = decomp[i].begin();
+    const index_type end   = decomp[i].end();
+
+    thrust::system::detail::sequential::stable_partition_copy(
+      exec,
+      first + begin,
+      first + end,
+      stencil + begin,
+      out_true + tile_offsets[i],
+      out_false + (begin - tile_offsets[i]),
+      pred);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return thrust::make_pair(out_true + num_true, out_false + ((last - first) - num_true));
+} // end stable_partition_copy()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Predicate>
+thrust::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first,
+  InputIterator1 last,
+  InputIterator2 stencil,
+  OutputIterator1 out_true,
+  OutputIterator2 out_false,
+  Predicate pred,
+  thrust::detail::false_type) // is_tileable
+{
+  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
+} // end stable_partition_copy()
+
+} // end namespace partition_detail
+
 template <typename DerivedPolicy,
           typename InputIterator,
           typename OutputIterator1,
@@ -73,8 +168,16 @@ thrust::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, out_true, out_false, pred);
+  // the elements are their own stencil
+  return partition_detail::stable_partition_copy(
+    exec,
+    first,
+    last,
+    first,
+    out_true,
+    out_false,
+    pred,
+    typename thrust::system::detail::internal::is_tileable<InputIterator, OutputIterator1, OutputIterator2>::type());
 } // end stable_partition_copy()
 
 template <typename DerivedPolicy,
@@ -92,8 +195,18 @@ thrust::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
+  return partition_detail::stable_partition_copy(
+    exec,
+    first,
+    last,
+    stencil,
+    out_true,
+    out_false,
+    pred,
+    typename thrust::system::detail::internal::is_tileable<InputIterator1,
+                                                           InputIterator2,
+                                                           OutputIterator1,
+                                                           OutputIterator2>::type());
 } // end stable_partition_copy()
 
 } // end namespace detail
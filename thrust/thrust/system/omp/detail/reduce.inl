@@ -25,9 +25,11 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/reduce.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/reduce.h>
 #include <thrust/system/omp/detail/reduce_intervals.h>
@@ -53,7 +55,18 @@ OutputType reduce(execution_policy<DerivedPolicy>& exec,
 
   // determine first and second level decomposition
   thrust::system::detail::internal::uniform_decomposition<difference_type> decomp1 =
-    thrust::system::omp::detail::default_decomposition(n);
+    thrust::system::omp::detail::default_decomposition(
+      exec,
+      n,
+      thrust::system::detail::internal::tuning_family::reduce,
+      thrust::system::detail::internal::tuning_element_size<InputIterator>::value);
+
+  // too little work to repay starting a parallel region
+  if (decomp1.size() < 2)
+  {
+    return thrust::reduce(thrust::seq, first, last, init, binary_op);
+  }
+
   thrust::system::detail::internal::uniform_decomposition<difference_type> decomp2(decomp1.size() + 1, 1, 1);
 
   // allocate storage for the initializer and partial sums
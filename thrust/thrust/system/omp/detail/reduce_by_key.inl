@@ -25,10 +25,23 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
 #include <thrust/distance.h>
-#include <thrust/system/detail/generic/reduce_by_key.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/pair.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/system/detail/internal/reduce_tile.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 #include <thrust/system/omp/detail/reduce_by_key.h>
 
+#include <cstdint>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -36,7 +49,36 @@ namespace omp
 {
 namespace detail
 {
+namespace reduce_by_key_detail
+{
+
+// true if the i-th key starts a new segment
+template <typename InputIterator, typename BinaryPredicate>
+bool is_head(InputIterator keys_first, std::intptr_t i, BinaryPredicate binary_pred)
+{
+  using KeyType = typename thrust::iterator_value<InputIterator>::type;
+
+  if (i == 0)
+  {
+    return true;
+  }
 
+  // compare copies, like the sequential implementation, so predicates see keys
+  // rather than references into the sequence
+  KeyType prev_key = keys_first[i - 1];
+  KeyType key      = keys_first[i];
+
+  return !binary_pred(prev_key, key);
+}
+
+} // end namespace reduce_by_key_detail
+
+// Every tile first counts the segments starting inside it and reduces the
+// values in front of its first head, which belong to a segment started by an
+// earlier tile. A serial pass over these per-tile results yields each tile's
+// output offset and the carry its last segment picks up from the following
+// tiles, after which every tile reduces its own segments directly into the
+// output. Scratch memory is proportional to the number of tiles.
 template <typename DerivedPolicy,
           typename InputIterator1,
           typename InputIterator2,
@@ -54,12 +96,160 @@ thrust::pair<OutputIterator1, OutputIterator2> reduce_by_key(
   BinaryPredicate binary_pred,
   BinaryFunction binary_op)
 {
-  // omp prefers generic::reduce_by_key to cpp::reduce_by_key
-  return thrust::system::detail::generic::reduce_by_key(
-    exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  // Use the input iterator's value type per https://wg21.link/P0571
+  using ValueType = typename thrust::iterator_value<InputIterator2>::type;
+
+  using index_type = std::intptr_t;
+
+  const index_type n = static_cast<index_type>(thrust::distance(keys_first, keys_last));
+
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+    thrust::system::omp::detail::default_decomposition(
+      exec,
+      n,
+      thrust::system::detail::internal::tuning_family::reduce_by_key,
+      thrust::system::detail::internal::tuning_element_size<InputIterator1>::value);
+
+  // a single tile has nothing to combine
+  if (decomp.size() < 2)
+  {
+    return thrust::reduce_by_key(
+      thrust::seq, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  }
+
+  const index_type num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<index_type, DerivedPolicy> offsets(exec, num_tiles + 1);
+  thrust::detail::temporary_array<index_type, DerivedPolicy> first_heads(exec, num_tiles);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> prefixes(exec, num_tiles);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> carries(exec, num_tiles);
+  thrust::detail::temporary_array<bool, DerivedPolicy> has_carry(exec, num_tiles);
+
+  index_type* out     = thrust::raw_pointer_cast(offsets.data());
+  index_type* heads   = thrust::raw_pointer_cast(first_heads.data());
+  ValueType* prefix   = thrust::raw_pointer_cast(prefixes.data());
+  ValueType* carry    = thrust::raw_pointer_cast(carries.data());
+  bool* carry_present = thrust::raw_pointer_cast(has_carry.data());
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const int threads = thrust::system::omp::detail::thread_count(exec);
+
+  // count the segments starting in every tile and reduce the values in front
+  // of the first of them
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; i++)
+  {
+    const index_type first = decomp[i].begin();
+    const index_type last  = decomp[i].end();
+
+    index_type count      = 0;
+    index_type first_head = last;
+
+    for (index_type j = first; j < last; ++j)
+    {
+      if (reduce_by_key_detail::is_head(keys_first, j, binary_pred))
+      {
+        first_head = count == 0 ? j : first_head;
+        ++count;
+      }
+    }
+
+    out[i]   = count;
+    heads[i] = first_head;
+
+    if (first_head > first)
+    {
+      prefix[i] =
+        thrust::system::detail::internal::reduce_tile<ValueType>(values_first + first, first_head - first, binary_op);
+    }
+  }
+
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  // the carry of a tile's last segment is the prefix of the next tile, extended
+  // through the carry of that tile if the segment covers all of it
+  carry_present[num_tiles - 1] = false;
+
+  for (index_type i = num_tiles - 2; i >= 0; --i)
+  {
+    const index_type next = i + 1;
+
+    carry_present[i] = heads[next] > decomp[next].begin();
+
+    if (carry_present[i])
+    {
+      carry[i] = heads[next] == decomp[next].end() && carry_present[next]
+                 ? wrapped_binary_op(prefix[next], carry[next])
+                 : prefix[next];
+    }
+  }
+
+  out[num_tiles] = 0;
+
+  thrust::exclusive_scan(thrust::seq, out, out + num_tiles + 1, out);
+
+  // every tile reduces the segments starting in it into its slice of the output
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; i++)
+  {
+    const index_type last = decomp[i].end();
+
+    index_type head = heads[i];
+
+    if (head == last)
+    {
+      continue;
+    }
+
+    OutputIterator1 keys_result   = keys_output + out[i];
+    OutputIterator2 values_result = values_output + out[i];
+
+    ValueType sum = values_first[head];
+
+    for (index_type j = head + 1; j < last; ++j)
+    {
+      if (reduce_by_key_detail::is_head(keys_first, j, binary_pred))
+      {
+        *keys_result   = keys_first[head];
+        *values_result = sum;
+
+        ++keys_result;
+        ++values_result;
+
+        head = j;
+        sum  = values_first[j];
+      }
+      else
+      {
+        sum = wrapped_binary_op(sum, values_first[j]);
+      }
+    }
+
+    // the last segment may continue into the following tiles
+    if (carry_present[i])
+    {
+      sum = wrapped_binary_op(sum, carry[i]);
+    }
+
+    *keys_result   = keys_first[head];
+    *values_result = sum;
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return thrust::make_pair(keys_output + out[num_tiles], values_output + out[num_tiles]);
 } // end reduce_by_key()
 
-} // namespace detail
-} // namespace omp
-} // namespace system
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
 THRUST_NAMESPACE_END
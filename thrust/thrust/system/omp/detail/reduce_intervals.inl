@@ -25,9 +25,10 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/detail/function.h>
 #include <thrust/detail/static_assert.h> // for depend_on_instantiation
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/reduce_tile.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/pragma_omp.h>
 #include <thrust/system/omp/detail/reduce_intervals.h>
 
@@ -47,7 +48,7 @@ template <typename DerivedPolicy,
           typename BinaryFunction,
           typename Decomposition>
 void reduce_intervals(
-  execution_policy<DerivedPolicy>&,
+  execution_policy<DerivedPolicy>& exec,
   InputIterator input,
   OutputIterator output,
   BinaryFunction binary_op,
@@ -66,33 +67,23 @@ void reduce_intervals(
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
   using OutputType = typename thrust::iterator_value<OutputIterator>::type;
 
-  // wrap binary_op
-  thrust::detail::wrapped_function<BinaryFunction, OutputType> wrapped_binary_op{binary_op};
-
   using index_type = std::intptr_t;
 
   index_type n = static_cast<index_type>(decomp.size());
 
-  THRUST_PRAGMA_OMP(parallel for)
+  const int threads = thrust::system::omp::detail::thread_count(exec);
+
+  // a single interval, like the second level of a reduction, runs without
+  // waking up a team
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads) if(n > 1))
   for (index_type i = 0; i < n; i++)
   {
-    InputIterator begin = input + decomp[i].begin();
-    InputIterator end   = input + decomp[i].end();
+    const index_type size = static_cast<index_type>(decomp[i].end() - decomp[i].begin());
 
-    if (begin != end)
+    if (size > 0)
     {
-      OutputType sum = thrust::raw_reference_cast(*begin);
-
-      ++begin;
-
-      while (begin != end)
-      {
-        sum = wrapped_binary_op(sum, *begin);
-        ++begin;
-      }
-
       OutputIterator tmp = output + i;
-      *tmp               = sum;
+      *tmp = thrust::system::detail::internal::reduce_tile<OutputType>(input + decomp[i].begin(), size, binary_op);
     }
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
@@ -25,9 +25,18 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
 #include <thrust/system/detail/generic/remove.h>
+#include <thrust/system/detail/internal/tile_compaction.h>
+#include <thrust/system/detail/sequential/remove.h>
+#include <thrust/system/omp/detail/compact_tiles.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 #include <thrust/system/omp/detail/remove.h>
 
+#include <cstdint>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -36,12 +45,83 @@ namespace omp
 namespace detail
 {
 
+namespace remove_detail
+{
+
+// Each tile moves the elements it keeps to its own front, which needs no
+// scratch beyond a count per tile. They are then moved next to each other in
+// order.
+template <typename DerivedPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2, typename Predicate>
+RandomAccessIterator1 remove_if(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 stencil,
+  Predicate pred,
+  thrust::detail::true_type) // is_tileable
+{
+  namespace internal = thrust::system::detail::internal;
+  using index_type   = std::intptr_t;
+
+  const internal::uniform_decomposition<index_type> decomp = compact_detail::decompose(exec, first, last);
+
+  if (decomp.size() < 2)
+  {
+    return thrust::system::detail::sequential::remove_if(exec, first, last, stencil, pred);
+  }
+
+  const index_type num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<index_type, DerivedPolicy> offsets(exec, num_tiles + 1);
+  index_type* tile_offsets = thrust::raw_pointer_cast(offsets.data());
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const int threads = thrust::system::omp::detail::thread_count(exec);
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    const index_type begin = decomp[i].begin();
+    const index_type end   = decomp[i].end();
+
+    tile_offsets[i] =
+      thrust::system::detail::sequential::remove_if(exec, first + begin, first + end, stencil + begin, pred)
+      - (first + begin);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  const index_type num_kept = internal::tile_offsets(tile_offsets, num_tiles);
+  internal::close_tile_gaps(exec, first, decomp, tile_offsets);
+
+  return first + num_kept;
+} // end remove_if()
+
+template <typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename Predicate>
+ForwardIterator remove_if(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  InputIterator stencil,
+  Predicate pred,
+  thrust::detail::false_type) // is_tileable
+{
+  return thrust::system::detail::generic::remove_if(exec, first, last, stencil, pred);
+} // end remove_if()
+
+} // end namespace remove_detail
+
 template <typename DerivedPolicy, typename ForwardIterator, typename Predicate>
 ForwardIterator
 remove_if(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, Predicate pred)
 {
-  // omp prefers generic::remove_if to cpp::remove_if
-  return thrust::system::detail::generic::remove_if(exec, first, last, pred);
+  // the elements are their own stencil; a tile only ever reads the ones it didn't write yet
+  return remove_detail::remove_if(
+    exec,
+    first,
+    last,
+    first,
+    pred,
+    typename thrust::system::detail::internal::is_tileable<ForwardIterator>::type());
 }
 
 template <typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename Predicate>
@@ -52,8 +132,13 @@ ForwardIterator remove_if(
   InputIterator stencil,
   Predicate pred)
 {
-  // omp prefers generic::remove_if to cpp::remove_if
-  return thrust::system::detail::generic::remove_if(exec, first, last, stencil, pred);
+  return remove_detail::remove_if(
+    exec,
+    first,
+    last,
+    stencil,
+    pred,
+    typename thrust::system::detail::internal::is_tileable<ForwardIterator, InputIterator>::type());
 }
 
 template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename Predicate>
@@ -14,6 +14,10 @@
  *  limitations under the License.
  */
 
+/*! \file scan.h
+ *  \brief OpenMP implementations of scan functions.
+ */
+
 #pragma once
 
 #include <thrust/detail/config.h>
@@ -25,6 +29,38 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/system/omp/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryFunction>
+OutputIterator inclusive_scan(execution_policy<DerivedPolicy>& exec,
+                              InputIterator first,
+                              InputIterator last,
+                              OutputIterator result,
+                              BinaryFunction binary_op);
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
+OutputIterator exclusive_scan(execution_policy<DerivedPolicy>& exec,
+                              InputIterator first,
+                              InputIterator last,
+                              OutputIterator result,
+                              InitialValueType init,
+                              BinaryFunction binary_op);
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
 
-// this system inherits scan
-#include <thrust/system/cpp/detail/scan.h>
+#include <thrust/system/omp/detail/scan.inl>
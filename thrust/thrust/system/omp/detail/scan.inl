@@ -0,0 +1,230 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/scan.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/reduce_intervals.h>
+#include <thrust/system/omp/detail/scan.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace scan_detail
+{
+
+// scans [first, last) into result, seeding the running sum with carry
+template <typename InputIterator, typename OutputIterator, typename BinaryFunction, typename ValueType>
+void inclusive_scan_tile(
+  InputIterator first, InputIterator last, OutputIterator result, BinaryFunction binary_op, ValueType carry)
+{
+  for (; first != last; ++first, ++result)
+  {
+    *result = carry = binary_op(carry, *first);
+  }
+}
+
+// the temporary allows in-situ scan
+template <typename InputIterator, typename OutputIterator, typename BinaryFunction, typename ValueType>
+void exclusive_scan_tile(
+  InputIterator first, InputIterator last, OutputIterator result, BinaryFunction binary_op, ValueType carry)
+{
+  for (; first != last; ++first, ++result)
+  {
+    ValueType tmp = *first;
+    *result       = carry;
+    carry         = binary_op(carry, tmp);
+  }
+}
+
+} // end namespace scan_detail
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryFunction>
+OutputIterator inclusive_scan(execution_policy<DerivedPolicy>& exec,
+                              InputIterator first,
+                              InputIterator last,
+                              OutputIterator result,
+                              BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  // Use the input iterator's value type per https://wg21.link/P0571
+  using ValueType = typename thrust::iterator_value<InputIterator>::type;
+
+  using index_type = std::intptr_t;
+
+  const index_type n = static_cast<index_type>(thrust::distance(first, last));
+
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+    thrust::system::omp::detail::default_decomposition(
+      exec,
+      n,
+      thrust::system::detail::internal::tuning_family::scan,
+      thrust::system::detail::internal::tuning_element_size<InputIterator>::value);
+
+  // a single tile gains nothing from the extra pass over the input
+  if (decomp.size() < 2)
+  {
+    return thrust::inclusive_scan(thrust::seq, first, last, result, binary_op);
+  }
+
+  // reduce each tile independently
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> tile_sums(exec, decomp.size());
+  thrust::system::omp::detail::reduce_intervals(exec, first, tile_sums.begin(), binary_op, decomp);
+
+  // scan the tile sums to obtain the carry-in of every tile
+  thrust::inclusive_scan(thrust::seq, tile_sums.begin(), tile_sums.end(), tile_sums.begin(), binary_op);
+
+  // rescan each tile, seeded by the sum of its predecessors
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const int threads = thrust::system::omp::detail::thread_count(exec);
+
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  const index_type num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; i++)
+  {
+    InputIterator tile_first   = first + decomp[i].begin();
+    InputIterator tile_last    = first + decomp[i].end();
+    OutputIterator tile_result = result + decomp[i].begin();
+
+    if (i == 0)
+    {
+      ValueType carry = *tile_first;
+      *tile_result    = carry;
+      scan_detail::inclusive_scan_tile(++tile_first, tile_last, ++tile_result, wrapped_binary_op, carry);
+    }
+    else
+    {
+      scan_detail::inclusive_scan_tile(
+        tile_first, tile_last, tile_result, wrapped_binary_op, static_cast<ValueType>(tile_sums[i - 1]));
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return result + n;
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
+OutputIterator exclusive_scan(execution_policy<DerivedPolicy>& exec,
+                              InputIterator first,
+                              InputIterator last,
+                              OutputIterator result,
+                              InitialValueType init,
+                              BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  // Use the initial value type per https://wg21.link/P0571
+  using ValueType = InitialValueType;
+
+  using index_type = std::intptr_t;
+
+  const index_type n = static_cast<index_type>(thrust::distance(first, last));
+
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+    thrust::system::omp::detail::default_decomposition(
+      exec,
+      n,
+      thrust::system::detail::internal::tuning_family::scan,
+      thrust::system::detail::internal::tuning_element_size<InputIterator>::value);
+
+  // a single tile gains nothing from the extra pass over the input
+  if (decomp.size() < 2)
+  {
+    return thrust::exclusive_scan(thrust::seq, first, last, result, init, binary_op);
+  }
+
+  // reduce each tile independently
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> tile_sums(exec, decomp.size());
+  thrust::system::omp::detail::reduce_intervals(exec, first, tile_sums.begin(), binary_op, decomp);
+
+  // scan the tile sums to obtain the carry-in of every tile
+  thrust::exclusive_scan(thrust::seq, tile_sums.begin(), tile_sums.end(), tile_sums.begin(), init, binary_op);
+
+  // rescan each tile, seeded by the sum of its predecessors
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const int threads = thrust::system::omp::detail::thread_count(exec);
+
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  const index_type num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; i++)
+  {
+    scan_detail::exclusive_scan_tile(
+      first + decomp[i].begin(),
+      first + decomp[i].end(),
+      result + decomp[i].begin(),
+      wrapped_binary_op,
+      static_cast<ValueType>(tile_sums[i]));
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return result + n;
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,350 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/scan.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/scan_by_key.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace scan_by_key_detail
+{
+
+// true if the i-th key belongs to the same segment as its predecessor
+template <typename InputIterator, typename BinaryPredicate>
+bool continues_segment(InputIterator keys_first, std::intptr_t i, BinaryPredicate binary_pred)
+{
+  using KeyType = typename thrust::iterator_value<InputIterator>::type;
+
+  if (i == 0)
+  {
+    return false;
+  }
+
+  // compare copies, like the sequential implementation, so predicates see keys
+  // rather than references into the sequence
+  KeyType prev_key = keys_first[i - 1];
+  KeyType key      = keys_first[i];
+
+  return binary_pred(prev_key, key);
+}
+
+// Finds the sum of the segment each tile ends in, as far as it reaches into
+// that tile. joins_next[i] is set if the first key of tile i + 1 continues that
+// segment, in which case carry_out[i] is the sum tile i + 1 starts with: the
+// sum of the last segment of tile i, extended by carry_out[i - 1] if that
+// segment covers all of tile i. Only the values of the last segment of every
+// tile are read. The flags are recorded up front because the keys at tile
+// boundaries may be overwritten by in-place scans later on.
+template <typename ValueType,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+void tile_carries(
+  InputIterator1 keys_first,
+  InputIterator2 values_first,
+  const thrust::system::detail::internal::uniform_decomposition<std::intptr_t>& decomp,
+  int threads,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op,
+  ValueType* carry_out,
+  bool* joins_next,
+  bool* covers_tile)
+{
+  // Avoid issues on compilers that don't provide OpenMP.
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using index_type = std::intptr_t;
+
+  // the last tile has nobody to carry into
+  const index_type num_tiles = decomp.size() - 1;
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; i++)
+  {
+    const index_type first = decomp[i].begin();
+
+    index_type j  = decomp[i].end() - 1;
+    ValueType sum = values_first[j];
+
+    for (; j > first && continues_segment(keys_first, j, binary_pred); --j)
+    {
+      ValueType tmp = values_first[j - 1];
+      sum           = binary_op(tmp, sum);
+    }
+
+    carry_out[i]   = sum;
+    joins_next[i]  = continues_segment(keys_first, decomp[i].end(), binary_pred);
+    covers_tile[i] = j == first;
+  }
+
+  for (index_type i = 1; i < num_tiles; i++)
+  {
+    if (covers_tile[i] && joins_next[i - 1])
+    {
+      carry_out[i] = binary_op(carry_out[i - 1], carry_out[i]);
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+} // end namespace scan_by_key_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator inclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using KeyType   = typename thrust::iterator_value<InputIterator1>::type;
+  using ValueType = typename thrust::iterator_value<InputIterator2>::type;
+
+  using index_type = std::intptr_t;
+
+  const index_type n = static_cast<index_type>(thrust::distance(first1, last1));
+
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+    thrust::system::omp::detail::default_decomposition(
+      exec,
+      n,
+      thrust::system::detail::internal::tuning_family::scan,
+      thrust::system::detail::internal::tuning_element_size<InputIterator1>::value);
+
+  // a single tile has no carries to exchange
+  if (decomp.size() < 2)
+  {
+    return thrust::inclusive_scan_by_key(thrust::seq, first1, last1, first2, result, binary_pred, binary_op);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const index_type num_tiles = decomp.size();
+  const int threads          = thrust::system::omp::detail::thread_count(exec);
+
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_binary_op{binary_op};
+
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> carries(exec, num_tiles - 1);
+  thrust::detail::temporary_array<bool, DerivedPolicy> joins_next(exec, num_tiles - 1);
+  thrust::detail::temporary_array<bool, DerivedPolicy> covers_tile(exec, num_tiles - 1);
+
+  ValueType* carry = thrust::raw_pointer_cast(carries.data());
+  bool* joins      = thrust::raw_pointer_cast(joins_next.data());
+
+  scan_by_key_detail::tile_carries(
+    first1,
+    first2,
+    decomp,
+    threads,
+    binary_pred,
+    wrapped_binary_op,
+    carry,
+    joins,
+    thrust::raw_pointer_cast(covers_tile.data()));
+
+  // rescan each tile, seeded by the carry of the segment it starts in
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; i++)
+  {
+    const index_type first = decomp[i].begin();
+    const index_type last  = decomp[i].end();
+
+    ValueType prev_value = first2[first];
+
+    if (i > 0 && joins[i - 1])
+    {
+      prev_value = wrapped_binary_op(carry[i - 1], prev_value);
+    }
+
+    KeyType prev_key = first1[first];
+
+    result[first] = prev_value;
+
+    for (index_type j = first + 1; j < last; ++j)
+    {
+      KeyType key = first1[j];
+
+      if (binary_pred(prev_key, key))
+      {
+        result[j] = prev_value = wrapped_binary_op(prev_value, first2[j]);
+      }
+      else
+      {
+        result[j] = prev_value = first2[j];
+      }
+
+      prev_key = key;
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return result + n;
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename T,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator exclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  T init,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using KeyType   = typename thrust::iterator_value<InputIterator1>::type;
+  using ValueType = T;
+
+  using index_type = std::intptr_t;
+
+  const index_type n = static_cast<index_type>(thrust::distance(first1, last1));
+
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+    thrust::system::omp::detail::default_decomposition(
+      exec,
+      n,
+      thrust::system::detail::internal::tuning_family::scan,
+      thrust::system::detail::internal::tuning_element_size<InputIterator1>::value);
+
+  // a single tile has no carries to exchange
+  if (decomp.size() < 2)
+  {
+    return thrust::exclusive_scan_by_key(thrust::seq, first1, last1, first2, result, init, binary_pred, binary_op);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const index_type num_tiles = decomp.size();
+  const int threads          = thrust::system::omp::detail::thread_count(exec);
+
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> carries(exec, num_tiles - 1);
+  thrust::detail::temporary_array<bool, DerivedPolicy> joins_next(exec, num_tiles - 1);
+  thrust::detail::temporary_array<bool, DerivedPolicy> covers_tile(exec, num_tiles - 1);
+
+  ValueType* carry = thrust::raw_pointer_cast(carries.data());
+  bool* joins      = thrust::raw_pointer_cast(joins_next.data());
+
+  scan_by_key_detail::tile_carries(
+    first1,
+    first2,
+    decomp,
+    threads,
+    binary_pred,
+    binary_op,
+    carry,
+    joins,
+    thrust::raw_pointer_cast(covers_tile.data()));
+
+  // rescan each tile, seeded by the carry of the segment it starts in
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; i++)
+  {
+    const index_type first = decomp[i].begin();
+    const index_type last  = decomp[i].end();
+
+    ValueType next = init;
+
+    if (i > 0 && joins[i - 1])
+    {
+      next = binary_op(next, carry[i - 1]);
+    }
+
+    KeyType prev_key = first1[first];
+
+    for (index_type j = first; j < last; ++j)
+    {
+      KeyType key = first1[j];
+
+      // use temp to permit in-place scans
+      ValueType temp_value = first2[j];
+
+      if (j > first && !binary_pred(prev_key, key))
+      {
+        next = init; // reset sum
+      }
+
+      result[j] = next;
+      next      = binary_op(next, temp_value);
+      prev_key  = key;
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return result + n;
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
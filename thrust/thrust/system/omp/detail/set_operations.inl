@@ -0,0 +1,313 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/binary_search.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/set_operations.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/merge.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/set_operations.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace set_operations_detail
+{
+
+// finds the point where the merge path crosses diag, then backs it up to the
+// start of the run of equivalent elements it lands in, so that every run of
+// equivalent elements from both inputs is processed by a single tile
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename StrictWeakOrdering>
+void balanced_path_search(
+  RandomAccessIterator1 first1,
+  Size n1,
+  RandomAccessIterator2 first2,
+  Size n2,
+  Size diag,
+  StrictWeakOrdering comp,
+  Size& i,
+  Size& j)
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  i = merge_detail::merge_path_search(first1, n1, first2, n2, diag, comp);
+  j = diag - i;
+
+  if (j < n2 && (i == n1 || wrapped_comp(first2[j], first1[i])))
+  {
+    // the next element of the merge comes from the second range
+    RandomAccessIterator2 split = first2 + j;
+
+    i = thrust::lower_bound(thrust::seq, first1, first1 + i, *split, comp) - first1;
+    j = thrust::lower_bound(thrust::seq, first2, split, *split, comp) - first2;
+  }
+  else if (i < n1)
+  {
+    // the next element of the merge comes from the first range
+    RandomAccessIterator1 split = first1 + i;
+
+    i = thrust::lower_bound(thrust::seq, first1, split, *split, comp) - first1;
+    j = thrust::lower_bound(thrust::seq, first2, first2 + j, *split, comp) - first2;
+  }
+}
+
+struct serial_set_difference
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(
+    InputIterator1 first1,
+    InputIterator1 last1,
+    InputIterator2 first2,
+    InputIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_difference(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_intersection
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(
+    InputIterator1 first1,
+    InputIterator1 last1,
+    InputIterator2 first2,
+    InputIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_intersection(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_symmetric_difference
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(
+    InputIterator1 first1,
+    InputIterator1 last1,
+    InputIterator2 first2,
+    InputIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_symmetric_difference(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_union
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(
+    InputIterator1 first1,
+    InputIterator1 last1,
+    InputIterator2 first2,
+    InputIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_union(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename SerialSetOperation>
+OutputIterator set_operation(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp,
+  SerialSetOperation set_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<InputIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using index_type = std::intptr_t;
+
+  const index_type n1 = static_cast<index_type>(thrust::distance(first1, last1));
+  const index_type n2 = static_cast<index_type>(thrust::distance(first2, last2));
+
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+    thrust::system::omp::detail::default_decomposition(exec, n1 + n2);
+
+  if (decomp.size() < 2)
+  {
+    return set_op(first1, last1, first2, last2, result, comp);
+  }
+
+  const index_type num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<index_type, DerivedPolicy> splits1(exec, num_tiles + 1);
+  thrust::detail::temporary_array<index_type, DerivedPolicy> splits2(exec, num_tiles + 1);
+  thrust::detail::temporary_array<index_type, DerivedPolicy> offsets(exec, num_tiles + 1);
+
+  index_type* s1  = thrust::raw_pointer_cast(splits1.data());
+  index_type* s2  = thrust::raw_pointer_cast(splits2.data());
+  index_type* out = thrust::raw_pointer_cast(offsets.data());
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const int threads = thrust::system::omp::detail::thread_count(exec);
+
+  // find the boundaries of every tile
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i <= num_tiles; i++)
+  {
+    const index_type diag = i < num_tiles ? decomp[i].begin() : n1 + n2;
+
+    balanced_path_search(first1, n1, first2, n2, diag, comp, s1[i], s2[i]);
+  }
+
+  // count the output of every tile without writing it
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; i++)
+  {
+    thrust::discard_iterator<> discard;
+
+    out[i] = set_op(first1 + s1[i], first1 + s1[i + 1], first2 + s2[i], first2 + s2[i + 1], discard, comp) - discard;
+  }
+  out[num_tiles] = 0;
+
+  thrust::exclusive_scan(thrust::seq, out, out + num_tiles + 1, out);
+
+  // every tile writes its output at its offset
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; i++)
+  {
+    set_op(first1 + s1[i], first1 + s1[i + 1], first2 + s2[i], first2 + s2[i + 1], result + out[i], comp);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return result + out[num_tiles];
+}
+
+} // end namespace set_operations_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, set_operations_detail::serial_set_difference());
+} // end set_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_intersection(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, set_operations_detail::serial_set_intersection());
+} // end set_intersection()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_symmetric_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, set_operations_detail::serial_set_symmetric_difference());
+} // end set_symmetric_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_union(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, set_operations_detail::serial_set_union());
+} // end set_union()
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
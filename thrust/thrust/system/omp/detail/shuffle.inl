@@ -0,0 +1,122 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/bijection_shuffle.h>
+#include <thrust/system/detail/internal/tile_compaction.h>
+#include <thrust/system/detail/internal/tuning_profile.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/shuffle.h>
+
+#include <cstddef>
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+template <typename DerivedPolicy, typename RandomIterator, typename URBG>
+void shuffle(execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, URBG&& g)
+{
+  using InputType = typename thrust::iterator_value<RandomIterator>::type;
+
+  // the elements are gathered in a random order, which can't be done in place
+  thrust::detail::temporary_array<InputType, DerivedPolicy> temp(exec, first, last);
+  thrust::system::omp::detail::shuffle_copy(exec, temp.begin(), temp.end(), first, g);
+} // end shuffle()
+
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename URBG>
+void shuffle_copy(
+  execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, OutputIterator result, URBG&& g)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<RandomIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  using index_type = std::intptr_t;
+
+  const std::uint64_t n = static_cast<std::uint64_t>(thrust::distance(first, last));
+
+  const thrust::system::detail::internal::bijection_shuffle plan(n, g);
+
+  // the tiles are fixed up front, as they must be the same when counting and
+  // when writing
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+    thrust::system::omp::detail::default_decomposition(
+      exec,
+      static_cast<index_type>(plan.size()),
+      thrust::system::detail::internal::tuning_family::scan,
+      thrust::system::detail::internal::tuning_element_size<RandomIterator>::value);
+
+  const index_type num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<index_type, DerivedPolicy> offsets(exec, num_tiles + 1);
+  index_type* tile_offsets = thrust::raw_pointer_cast(offsets.data());
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const int threads = thrust::system::omp::detail::thread_count(exec);
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; i++)
+  {
+    tile_offsets[i] = static_cast<index_type>(plan.count_tile(
+      static_cast<std::uint64_t>(decomp[i].begin()), static_cast<std::uint64_t>(decomp[i].end())));
+  }
+
+  thrust::system::detail::internal::tile_offsets(tile_offsets, num_tiles);
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; i++)
+  {
+    plan.scatter_tile(first,
+                      static_cast<std::uint64_t>(decomp[i].begin()),
+                      static_cast<std::uint64_t>(decomp[i].end()),
+                      result,
+                      static_cast<std::uint64_t>(tile_offsets[i]));
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end shuffle_copy()
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
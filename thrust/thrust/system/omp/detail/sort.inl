@@ -31,13 +31,21 @@
 #  include <omp.h>
 #endif // omp support
 
+#include <thrust/copy.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/internal/radix_sort.h>
+#include <thrust/system/detail/sequential/sort.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/merge.h>
+
+#include <cstddef>
+#include <cstdint>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -49,53 +57,228 @@ namespace detail
 namespace sort_detail
 {
 
-template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-void inplace_merge(execution_policy<DerivedPolicy>& exec,
-                   RandomAccessIterator first,
-                   RandomAccessIterator middle,
-                   RandomAccessIterator last,
-                   StrictWeakOrdering comp)
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+void sort_tile(RandomAccessIterator1 keys_first,
+               RandomAccessIterator1 keys_last,
+               RandomAccessIterator2,
+               StrictWeakOrdering comp,
+               thrust::detail::false_type)
 {
-  using value_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+  thrust::stable_sort(thrust::seq, keys_first, keys_last, comp);
+}
 
-  thrust::detail::temporary_array<value_type, DerivedPolicy> a(exec, first, middle);
-  thrust::detail::temporary_array<value_type, DerivedPolicy> b(exec, middle, last);
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+void sort_tile(RandomAccessIterator1 keys_first,
+               RandomAccessIterator1 keys_last,
+               RandomAccessIterator2 values_first,
+               StrictWeakOrdering comp,
+               thrust::detail::true_type)
+{
+  thrust::stable_sort_by_key(thrust::seq, keys_first, keys_last, values_first, comp);
+}
 
-  thrust::merge(thrust::seq, a.begin(), a.end(), b.begin(), b.end(), first, comp);
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename StrictWeakOrdering>
+void merge_tile(
+  RandomAccessIterator1 keys_first1,
+  RandomAccessIterator1 keys_last1,
+  RandomAccessIterator1 keys_first2,
+  RandomAccessIterator1 keys_last2,
+  RandomAccessIterator2,
+  RandomAccessIterator2,
+  RandomAccessIterator3 keys_result,
+  RandomAccessIterator4,
+  StrictWeakOrdering comp,
+  thrust::detail::false_type)
+{
+  thrust::merge(thrust::seq, keys_first1, keys_last1, keys_first2, keys_last2, keys_result, comp);
+}
+
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename StrictWeakOrdering>
+void merge_tile(
+  RandomAccessIterator1 keys_first1,
+  RandomAccessIterator1 keys_last1,
+  RandomAccessIterator1 keys_first2,
+  RandomAccessIterator1 keys_last2,
+  RandomAccessIterator2 values_first1,
+  RandomAccessIterator2 values_first2,
+  RandomAccessIterator3 keys_result,
+  RandomAccessIterator4 values_result,
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  thrust::merge_by_key(
+    thrust::seq,
+    keys_first1,
+    keys_last1,
+    keys_first2,
+    keys_last2,
+    values_first1,
+    values_first2,
+    keys_result,
+    values_result,
+    comp);
 }
 
+// merges every pair of adjacent sorted runs of run_tiles tiles from (keys_first,
+// values_first) into (keys_result, values_result). Each tile of the output is
+// produced by a single thread, which finds its slice of the two runs on their
+// merge path, so all threads do the same amount of work in every round.
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename StrictWeakOrdering,
+          typename HasValues>
+void merge_runs(
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  RandomAccessIterator3 keys_result,
+  RandomAccessIterator4 values_result,
+  const thrust::system::detail::internal::uniform_decomposition<std::intptr_t>& decomp,
+  std::intptr_t run_tiles,
+  int threads,
+  StrictWeakOrdering comp,
+  HasValues has_values)
+{
+  // Avoid issues on compilers that don't provide OpenMP.
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using index_type = std::intptr_t;
+
+  const index_type num_tiles = decomp.size();
+  const index_type n         = decomp[num_tiles - 1].end();
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; i++)
+  {
+    // locate the pair of runs this tile's output belongs to
+    const index_type first_tile  = i - i % (2 * run_tiles);
+    const index_type middle_tile = first_tile + run_tiles;
+    const index_type last_tile   = middle_tile + run_tiles;
+
+    const index_type first  = decomp[first_tile].begin();
+    const index_type middle = middle_tile < num_tiles ? decomp[middle_tile].begin() : n;
+    const index_type last   = last_tile < num_tiles ? decomp[last_tile].begin() : n;
+
+    const index_type n1 = middle - first;
+    const index_type n2 = last - middle;
+
+    const index_type diag_first = decomp[i].begin() - first;
+    const index_type diag_last  = decomp[i].end() - first;
+
+    const index_type a_first = merge_detail::merge_path_search(
+      keys_first + first, n1, keys_first + middle, n2, diag_first, comp);
+    const index_type a_last = merge_detail::merge_path_search(
+      keys_first + first, n1, keys_first + middle, n2, diag_last, comp);
+    const index_type b_first = diag_first - a_first;
+    const index_type b_last  = diag_last - a_last;
+
+    merge_tile(keys_first + (first + a_first),
+               keys_first + (first + a_last),
+               keys_first + (middle + b_first),
+               keys_first + (middle + b_last),
+               values_first + (first + a_first),
+               values_first + (middle + b_first),
+               keys_result + decomp[i].begin(),
+               values_result + decomp[i].begin(),
+               comp,
+               has_values);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+// sorts [keys1, keys1 + n) and, if HasValues, the corresponding values with a
+// merge sort, using keys2 and vals2 as scratch: every thread sorts its own tile,
+// then rounds of merge_runs double the length of the sorted runs until a single
+// run remains, alternating between the input and the scratch buffer
 template <typename DerivedPolicy,
           typename RandomAccessIterator1,
           typename RandomAccessIterator2,
-          typename StrictWeakOrdering>
-void inplace_merge_by_key(
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename StrictWeakOrdering,
+          typename HasValues>
+void merge_sort(
   execution_policy<DerivedPolicy>& exec,
-  RandomAccessIterator1 first1,
-  RandomAccessIterator1 middle1,
-  RandomAccessIterator1 last1,
-  RandomAccessIterator2 first2,
-  StrictWeakOrdering comp)
+  RandomAccessIterator1 keys1,
+  RandomAccessIterator2 keys2,
+  RandomAccessIterator3 vals1,
+  RandomAccessIterator4 vals2,
+  const thrust::system::detail::internal::uniform_decomposition<std::intptr_t>& decomp,
+  StrictWeakOrdering comp,
+  HasValues has_values)
 {
-  using value_type1 = typename thrust::iterator_value<RandomAccessIterator1>::type;
-  using value_type2 = typename thrust::iterator_value<RandomAccessIterator2>::type;
+  // Avoid issues on compilers that don't provide OpenMP.
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using index_type = std::intptr_t;
 
-  RandomAccessIterator2 middle2 = first2 + (middle1 - first1);
-  RandomAccessIterator2 last2   = first2 + (last1 - first1);
+  const index_type num_tiles = decomp.size();
+  const index_type n         = decomp[num_tiles - 1].end();
 
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> lhs1(exec, first1, middle1);
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> rhs1(exec, middle1, last1);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> lhs2(exec, first2, middle2);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> rhs2(exec, middle2, last2);
+  const int threads = thrust::system::omp::detail::thread_count(exec);
 
-  thrust::merge_by_key(
-    thrust::seq, lhs1.begin(), lhs1.end(), rhs1.begin(), rhs1.end(), lhs2.begin(), rhs2.begin(), first1, first2, comp);
-}
+  // every thread sorts its own tile
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; i++)
+  {
+    sort_tile(keys1 + decomp[i].begin(), keys1 + decomp[i].end(), vals1 + decomp[i].begin(), comp, has_values);
+  }
 
-} // namespace sort_detail
+  // false if most recent data is stored in (keys1,vals1)
+  bool flip = false;
 
-template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-void stable_sort(
-  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+  for (index_type run_tiles = 1; run_tiles < num_tiles; run_tiles *= 2)
+  {
+    if (flip)
+    {
+      merge_runs(keys2, vals2, keys1, vals1, decomp, run_tiles, threads, comp, has_values);
+    }
+    else
+    {
+      merge_runs(keys1, vals1, keys2, vals2, decomp, run_tiles, threads, comp, has_values);
+    }
+
+    flip = !flip;
+  }
+
+  // ensure final values are in (keys1,vals1)
+  if (flip)
+  {
+    thrust::copy(exec, keys2, keys2 + n, keys1);
+
+    if (HasValues::value)
+    {
+      thrust::copy(exec, vals2, vals2 + n, vals1);
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+// sorts [keys1, keys1 + n) and, if HasValues, the corresponding values with an
+// LSD radix sort, using keys2 and vals2 as scratch: every pass histograms each
+// tile, scans the histograms and stably scatters each tile in parallel
+template <bool Descending,
+          typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename HasValues>
+void radix_sort(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys1,
+  RandomAccessIterator2 keys2,
+  RandomAccessIterator3 vals1,
+  RandomAccessIterator4 vals2,
+  std::intptr_t n,
+  HasValues has_values)
 {
   // we're attempting to launch an omp kernel, assert we're compiling with omp support
   // ========================================================================
@@ -103,68 +286,142 @@ void stable_sort(
   // X you need to enable OpenMP support in your compiler.                  X
   // ========================================================================
   THRUST_STATIC_ASSERT_MSG(
-    (thrust::detail::depend_on_instantiation<RandomAccessIterator,
+    (thrust::detail::depend_on_instantiation<RandomAccessIterator1,
                                              (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
     "OpenMP compiler support is not enabled");
 
-  // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  using IndexType = typename thrust::iterator_difference<RandomAccessIterator>::type;
-
-  if (first == last)
-  {
-    return;
-  }
+  namespace radix = thrust::system::detail::internal::radix_sort_detail;
 
-  THRUST_PRAGMA_OMP(parallel)
-  {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, 1, omp_get_num_threads());
+  using KeyType        = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using DigitExtractor = radix::digit_extractor<KeyType, Descending>;
+  using index_type     = std::intptr_t;
 
-    // process id
-    IndexType p_i = omp_get_thread_num();
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+    thrust::system::omp::detail::default_decomposition(
+      exec,
+      n,
+      thrust::system::detail::internal::tuning_family::sort,
+      thrust::system::detail::internal::tuning_element_size<RandomAccessIterator1>::value);
 
-    // every thread sorts its own tile
-    if (p_i < decomp.size())
-    {
-      thrust::stable_sort(thrust::seq, first + decomp[p_i].begin(), first + decomp[p_i].end(), comp);
-    }
+  const index_type num_tiles = decomp.size();
 
-    THRUST_PRAGMA_OMP(barrier)
+  const int threads = thrust::system::omp::detail::thread_count(exec);
 
-    // XXX For some reason, MSVC 2015 yields an error unless we include this meaningless semicolon here
-    ;
+  // one histogram per tile, reused by every pass
+  thrust::detail::temporary_array<std::size_t, DerivedPolicy> histograms(exec, num_tiles * radix::num_buckets);
+  std::size_t* h = thrust::raw_pointer_cast(histograms.data());
 
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
+  // false if most recent data is stored in (keys1,vals1)
+  bool flip = false;
 
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
+  for (unsigned int pass = 0; pass < DigitExtractor::num_passes; ++pass)
+  {
+    const DigitExtractor digit(pass);
 
-    while (nseg > 1)
+    THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+    for (index_type i = 0; i < num_tiles; i++)
     {
-      if (c >= decomp.size())
+      std::size_t* histogram = h + i * radix::num_buckets;
+
+      if (flip)
       {
-        c = decomp.size() - 1;
+        radix::histogram_tile(keys2 + decomp[i].begin(), keys2 + decomp[i].end(), digit, histogram);
       }
-
-      if ((p_i % h) == 0 && c > b)
+      else
       {
-        sort_detail::inplace_merge(
-          exec, first + decomp[a].begin(), first + decomp[b].end(), first + decomp[c].end(), comp);
+        radix::histogram_tile(keys1 + decomp[i].begin(), keys1 + decomp[i].end(), digit, histogram);
+      }
+    }
 
-        b = c;
-        c += h;
+    if (!radix::scan_histograms(h, num_tiles, n))
+    {
+      continue;
+    }
+
+    THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+    for (index_type i = 0; i < num_tiles; i++)
+    {
+      std::size_t* offsets = h + i * radix::num_buckets;
+
+      if (flip)
+      {
+        radix::scatter_tile(
+          keys2 + decomp[i].begin(),
+          keys2 + decomp[i].end(),
+          vals2 + decomp[i].begin(),
+          keys1,
+          vals1,
+          digit,
+          offsets,
+          has_values);
       }
+      else
+      {
+        radix::scatter_tile(
+          keys1 + decomp[i].begin(),
+          keys1 + decomp[i].end(),
+          vals1 + decomp[i].begin(),
+          keys2,
+          vals2,
+          digit,
+          offsets,
+          has_values);
+      }
+    }
+
+    flip = !flip;
+  }
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+  // ensure final values are in (keys1,vals1)
+  if (flip)
+  {
+    thrust::copy(exec, keys2, keys2 + n, keys1);
 
-      THRUST_PRAGMA_OMP(barrier)
+    if (HasValues::value)
+    {
+      thrust::copy(exec, vals2, vals2 + n, vals1);
     }
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
+////////////////
+// Radix Sort //
+////////////////
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::true_type)
+{
+  using KeyType = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  const std::intptr_t n = last - first;
+
+  const thrust::system::detail::internal::uniform_decomposition<std::intptr_t> decomp =
+    thrust::system::omp::detail::default_decomposition(
+      exec,
+      n,
+      thrust::system::detail::internal::tuning_family::sort,
+      thrust::system::detail::internal::tuning_element_size<RandomAccessIterator>::value);
+
+  // a single tile is better served by the sequential radix sort
+  if (decomp.size() < 2)
+  {
+    thrust::system::detail::sequential::stable_sort(exec, first, last, comp);
+    return;
+  }
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> temp(exec, n);
+
+  // keys stand in for the values when there are none
+  radix_sort<thrust::system::detail::internal::radix_sort_detail::is_descending<KeyType, StrictWeakOrdering>::value>(
+    exec, first, temp.begin(), first, temp.begin(), n, thrust::detail::false_type());
+}
+
 template <typename DerivedPolicy,
           typename RandomAccessIterator1,
           typename RandomAccessIterator2,
@@ -174,7 +431,45 @@ void stable_sort_by_key(
   RandomAccessIterator1 keys_first,
   RandomAccessIterator1 keys_last,
   RandomAccessIterator2 values_first,
-  StrictWeakOrdering comp)
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  using KeyType   = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using ValueType = typename thrust::iterator_value<RandomAccessIterator2>::type;
+
+  const std::intptr_t n = keys_last - keys_first;
+
+  const thrust::system::detail::internal::uniform_decomposition<std::intptr_t> decomp =
+    thrust::system::omp::detail::default_decomposition(
+      exec,
+      n,
+      thrust::system::detail::internal::tuning_family::sort,
+      thrust::system::detail::internal::tuning_element_size<RandomAccessIterator1>::value);
+
+  // a single tile is better served by the sequential radix sort
+  if (decomp.size() < 2)
+  {
+    thrust::system::detail::sequential::stable_sort_by_key(exec, keys_first, keys_last, values_first, comp);
+    return;
+  }
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> keys_temp(exec, n);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> values_temp(exec, n);
+
+  radix_sort<thrust::system::detail::internal::radix_sort_detail::is_descending<KeyType, StrictWeakOrdering>::value>(
+    exec, keys_first, keys_temp.begin(), values_first, values_temp.begin(), n, thrust::detail::true_type());
+}
+
+////////////////
+// Merge Sort //
+////////////////
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::false_type)
 {
   // we're attempting to launch an omp kernel, assert we're compiling with omp support
   // ========================================================================
@@ -182,77 +477,117 @@ void stable_sort_by_key(
   // X you need to enable OpenMP support in your compiler.                  X
   // ========================================================================
   THRUST_STATIC_ASSERT_MSG(
-    (thrust::detail::depend_on_instantiation<RandomAccessIterator1,
+    (thrust::detail::depend_on_instantiation<RandomAccessIterator,
                                              (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
     "OpenMP compiler support is not enabled");
 
-  // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
-#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  using IndexType = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+  using KeyType = typename thrust::iterator_value<RandomAccessIterator>::type;
 
-  if (keys_first == keys_last)
+  const std::intptr_t n = last - first;
+
+  thrust::system::detail::internal::uniform_decomposition<std::intptr_t> decomp =
+    thrust::system::omp::detail::default_decomposition(
+      exec,
+      n,
+      thrust::system::detail::internal::tuning_family::sort,
+      thrust::system::detail::internal::tuning_element_size<RandomAccessIterator>::value);
+
+  // a single tile needs no merging
+  if (decomp.size() < 2)
   {
+    thrust::system::detail::sequential::stable_sort(exec, first, last, comp);
     return;
   }
 
-  THRUST_PRAGMA_OMP(parallel)
-  {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(
-      keys_last - keys_first, 1, omp_get_num_threads());
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> temp(exec, n);
 
-    // process id
-    IndexType p_i = omp_get_thread_num();
+  // keys stand in for the values when there are none
+  merge_sort(exec, first, temp.begin(), first, temp.begin(), decomp, comp, thrust::detail::false_type());
+}
 
-    // every thread sorts its own tile
-    if (p_i < decomp.size())
-    {
-      thrust::stable_sort_by_key(
-        thrust::seq,
-        keys_first + decomp[p_i].begin(),
-        keys_first + decomp[p_i].end(),
-        values_first + decomp[p_i].begin(),
-        comp);
-    }
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp,
+  thrust::detail::false_type)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<RandomAccessIterator1,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
 
-    THRUST_PRAGMA_OMP(barrier)
+  using KeyType   = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using ValueType = typename thrust::iterator_value<RandomAccessIterator2>::type;
 
-    // XXX For some reason, MSVC 2015 yields an error unless we include this meaningless semicolon here
-    ;
+  const std::intptr_t n = keys_last - keys_first;
 
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
+  thrust::system::detail::internal::uniform_decomposition<std::intptr_t> decomp =
+    thrust::system::omp::detail::default_decomposition(
+      exec,
+      n,
+      thrust::system::detail::internal::tuning_family::sort,
+      thrust::system::detail::internal::tuning_element_size<RandomAccessIterator1>::value);
 
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
+  // a single tile needs no merging
+  if (decomp.size() < 2)
+  {
+    thrust::system::detail::sequential::stable_sort_by_key(exec, keys_first, keys_last, values_first, comp);
+    return;
+  }
 
-    while (nseg > 1)
-    {
-      if (c >= decomp.size())
-      {
-        c = decomp.size() - 1;
-      }
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> keys_temp(exec, n);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> values_temp(exec, n);
+
+  merge_sort(exec,
+             keys_first,
+             keys_temp.begin(),
+             values_first,
+             values_temp.begin(),
+             decomp,
+             comp,
+             thrust::detail::true_type());
+}
 
-      if ((p_i % h) == 0 && c > b)
-      {
-        sort_detail::inplace_merge_by_key(
-          exec,
-          keys_first + decomp[a].begin(),
-          keys_first + decomp[b].end(),
-          keys_first + decomp[c].end(),
-          values_first + decomp[a].begin(),
-          comp);
-
-        b = c;
-        c += h;
-      }
+} // end namespace sort_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(
+  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  using KeyType = typename thrust::iterator_value<RandomAccessIterator>::type;
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+  thrust::system::detail::internal::radix_sort_detail::use_radix_sort<KeyType, StrictWeakOrdering> use_radix_sort;
 
-      THRUST_PRAGMA_OMP(barrier)
-    }
-  }
-#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+  sort_detail::stable_sort(exec, first, last, comp, use_radix_sort);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp)
+{
+  using KeyType = typename thrust::iterator_value<RandomAccessIterator1>::type;
+
+  thrust::system::detail::internal::radix_sort_detail::use_radix_sort<KeyType, StrictWeakOrdering> use_radix_sort;
+
+  sort_detail::stable_sort_by_key(exec, keys_first, keys_last, values_first, comp, use_radix_sort);
 }
 
 } // end namespace detail
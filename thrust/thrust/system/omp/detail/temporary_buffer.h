@@ -25,5 +25,42 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/system/cpp/detail/temporary_buffer.h>
 
-// this system has no special temporary buffer functions
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+struct tag;
+struct par_t;
+struct execute_with_threads;
+
+} // namespace detail
+} // namespace omp
+
+namespace cpp
+{
+namespace detail
+{
+
+// the OpenMP policies cache temporary storage the way the cpp ones do
+template <>
+struct caches_temporary_buffers<thrust::system::omp::detail::tag> : thrust::detail::true_type
+{};
+
+template <>
+struct caches_temporary_buffers<thrust::system::omp::detail::par_t> : thrust::detail::true_type
+{};
+
+template <>
+struct caches_temporary_buffers<thrust::system::omp::detail::execute_with_threads> : thrust::detail::true_type
+{};
+
+} // namespace detail
+} // namespace cpp
+} // namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,78 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file tuning.h
+ *  \brief The tuning profile the OpenMP algorithms consult.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/system/detail/internal/trivial_copy.h>
+#include <thrust/system/detail/internal/tuning_profile.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+// Splits inputs as finely as before profiles existed, except that inputs too
+// small to repay starting a parallel region run serially.
+inline thrust::system::detail::internal::tuning_profile default_tuning_profile()
+{
+  using thrust::system::detail::internal::tuning_family;
+
+  thrust::system::detail::internal::tuning_profile result;
+
+  result[tuning_family::for_each]      = {1024, 256};
+  result[tuning_family::reduce]        = {4096, 256};
+  result[tuning_family::scan]          = {4096, 256};
+  result[tuning_family::sort]          = {4096, 256};
+  result[tuning_family::merge]         = {4096, 256};
+  result[tuning_family::reduce_by_key] = {4096, 256};
+  result[tuning_family::copy]          = {2 * thrust::system::detail::internal::trivial_copy_min_bytes_per_thread,
+                                          thrust::system::detail::internal::trivial_copy_min_bytes_per_thread};
+
+  return result;
+}
+
+// the profile in effect, read from the file THRUST_OMP_TUNING_PROFILE names
+// on first use
+inline thrust::system::detail::internal::tuning_profile& tuning_profile_storage()
+{
+  static thrust::system::detail::internal::tuning_profile profile =
+    thrust::system::detail::internal::tuning_profile_from_environment(
+      "THRUST_OMP_TUNING_PROFILE", default_tuning_profile());
+
+  return profile;
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
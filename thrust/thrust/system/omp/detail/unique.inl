@@ -25,9 +25,18 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
 #include <thrust/pair.h>
 #include <thrust/system/detail/generic/unique.h>
+#include <thrust/system/detail/internal/unique_tile.h>
+#include <thrust/system/detail/sequential/unique.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 #include <thrust/system/omp/detail/unique.h>
+#include <thrust/system/omp/detail/unique_tiles.h>
+
+#include <cstdint>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -36,13 +45,170 @@ namespace omp
 {
 namespace detail
 {
+namespace unique_detail
+{
+
+// Each tile moves its groups to its own front, which needs no scratch beyond
+// a count per tile. The groups are then moved next to each other in order.
+template <typename DerivedPolicy, typename RandomAccessIterator, typename BinaryPredicate>
+RandomAccessIterator unique(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  BinaryPredicate binary_pred,
+  thrust::detail::true_type) // is_tileable
+{
+  namespace internal = thrust::system::detail::internal;
+  using index_type   = std::intptr_t;
+
+  const internal::uniform_decomposition<index_type> decomp = unique_detail::decompose(exec, first, last);
+
+  if (decomp.size() < 2)
+  {
+    return thrust::system::detail::sequential::unique(exec, first, last, binary_pred);
+  }
+
+  const index_type num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<index_type, DerivedPolicy> offsets(exec, num_tiles + 1);
+  index_type* tile_offsets = thrust::raw_pointer_cast(offsets.data());
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const int threads = thrust::system::omp::detail::thread_count(exec);
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    tile_offsets[i] = internal::compact_unique_heads(first, decomp[i].begin(), decomp[i].end(), binary_pred);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  const index_type num_unique = internal::tile_offsets(tile_offsets, num_tiles);
+  internal::close_tile_gaps(exec, first, decomp, tile_offsets);
+
+  return first + num_unique;
+} // end unique()
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator unique(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  BinaryPredicate binary_pred,
+  thrust::detail::false_type) // is_tileable
+{
+  return thrust::system::detail::generic::unique(exec, first, last, binary_pred);
+} // end unique()
+
+// counts the groups of every tile, then copies each tile's groups to where
+// the counts of its predecessors say
+template <typename DerivedPolicy,
+          typename RandomAccessIterator,
+          typename RandomAccessOutputIterator,
+          typename BinaryPredicate>
+RandomAccessOutputIterator unique_copy(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  RandomAccessOutputIterator output,
+  BinaryPredicate binary_pred,
+  thrust::detail::true_type) // is_tileable
+{
+  namespace internal = thrust::system::detail::internal;
+  using index_type   = std::intptr_t;
+
+  const internal::uniform_decomposition<index_type> decomp = unique_detail::decompose(exec, first, last);
+
+  if (decomp.size() < 2)
+  {
+    return thrust::system::detail::sequential::unique_copy(exec, first, last, output, binary_pred);
+  }
+
+  const index_type num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<index_type, DerivedPolicy> offsets(exec, num_tiles + 1);
+  index_type* tile_offsets = thrust::raw_pointer_cast(offsets.data());
+
+  unique_detail::count_tiles(exec, first, decomp, tile_offsets, binary_pred);
+
+  const index_type num_unique = internal::tile_offsets(tile_offsets, num_tiles);
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const int threads = thrust::system::omp::detail::thread_count(exec);
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    internal::copy_unique_heads(first, decomp[i].begin(), decomp[i].end(), output + tile_offsets[i], binary_pred);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return output + num_unique;
+} // end unique_copy()
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryPredicate>
+OutputIterator unique_copy(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator output,
+  BinaryPredicate binary_pred,
+  thrust::detail::false_type) // is_tileable
+{
+  return thrust::system::detail::generic::unique_copy(exec, first, last, output, binary_pred);
+} // end unique_copy()
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename BinaryPredicate>
+typename thrust::iterator_traits<RandomAccessIterator>::difference_type unique_count(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  BinaryPredicate binary_pred,
+  thrust::detail::true_type) // is_tileable
+{
+  using index_type = std::intptr_t;
+
+  const thrust::system::detail::internal::uniform_decomposition<index_type> decomp =
+    unique_detail::decompose(exec, first, last);
+
+  if (decomp.size() < 2)
+  {
+    return thrust::system::detail::sequential::unique_count(exec, first, last, binary_pred);
+  }
+
+  const index_type num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<index_type, DerivedPolicy> counts(exec, num_tiles + 1);
+  index_type* tile_counts = thrust::raw_pointer_cast(counts.data());
+
+  unique_detail::count_tiles(exec, first, decomp, tile_counts, binary_pred);
+
+  return thrust::system::detail::internal::tile_offsets(tile_counts, num_tiles);
+} // end unique_count()
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+typename thrust::iterator_traits<ForwardIterator>::difference_type unique_count(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  BinaryPredicate binary_pred,
+  thrust::detail::false_type) // is_tileable
+{
+  return thrust::system::detail::generic::unique_count(exec, first, last, binary_pred);
+} // end unique_count()
+
+} // end namespace unique_detail
 
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
 ForwardIterator
 unique(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique to cpp::unique
-  return thrust::system::detail::generic::unique(exec, first, last, binary_pred);
+  return unique_detail::unique(
+    exec,
+    first,
+    last,
+    binary_pred,
+    typename thrust::system::detail::internal::is_tileable<ForwardIterator>::type());
 } // end unique()
 
 template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryPredicate>
@@ -53,16 +219,25 @@ OutputIterator unique_copy(
   OutputIterator output,
   BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_copy to cpp::unique_copy
-  return thrust::system::detail::generic::unique_copy(exec, first, last, output, binary_pred);
+  return unique_detail::unique_copy(
+    exec,
+    first,
+    last,
+    output,
+    binary_pred,
+    typename thrust::system::detail::internal::is_tileable<InputIterator, OutputIterator>::type());
 } // end unique_copy()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
 typename thrust::iterator_traits<ForwardIterator>::difference_type unique_count(
   execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_count to cpp::unique_count
-  return thrust::system::detail::generic::unique_count(exec, first, last, binary_pred);
+  return unique_detail::unique_count(
+    exec,
+    first,
+    last,
+    binary_pred,
+    typename thrust::system::detail::internal::is_tileable<ForwardIterator>::type());
 } // end unique_count()
 
 } // end namespace detail
@@ -25,9 +25,18 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
 #include <thrust/pair.h>
 #include <thrust/system/detail/generic/unique_by_key.h>
+#include <thrust/system/detail/internal/unique_tile.h>
+#include <thrust/system/detail/sequential/unique_by_key.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 #include <thrust/system/omp/detail/unique_by_key.h>
+#include <thrust/system/omp/detail/unique_tiles.h>
+
+#include <cstdint>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -36,6 +45,55 @@ namespace omp
 {
 namespace detail
 {
+namespace unique_by_key_detail
+{
+
+// like unique, moving the values along with the keys
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename BinaryPredicate>
+thrust::pair<RandomAccessIterator1, RandomAccessIterator2> unique_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  BinaryPredicate binary_pred,
+  thrust::detail::true_type) // is_tileable
+{
+  namespace internal = thrust::system::detail::internal;
+  using index_type   = std::intptr_t;
+
+  const internal::uniform_decomposition<index_type> decomp =
+    unique_detail::decompose(exec, keys_first, keys_last);
+
+  if (decomp.size() < 2)
+  {
+    return thrust::system::detail::sequential::unique_by_key(exec, keys_first, keys_last, values_first, binary_pred);
+  }
+
+  const index_type num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<index_type, DerivedPolicy> offsets(exec, num_tiles + 1);
+  index_type* tile_offsets = thrust::raw_pointer_cast(offsets.data());
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const int threads = thrust::system::omp::detail::thread_count(exec);
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    tile_offsets[i] = internal::compact_unique_heads_by_key(
+      keys_first, values_first, decomp[i].begin(), decomp[i].end(), binary_pred);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  const index_type num_unique = internal::tile_offsets(tile_offsets, num_tiles);
+  internal::close_tile_gaps(exec, keys_first, decomp, tile_offsets);
+  internal::close_tile_gaps(exec, values_first, decomp, tile_offsets);
+
+  return thrust::make_pair(keys_first + num_unique, values_first + num_unique);
+} // end unique_by_key()
 
 template <typename DerivedPolicy, typename ForwardIterator1, typename ForwardIterator2, typename BinaryPredicate>
 thrust::pair<ForwardIterator1, ForwardIterator2> unique_by_key(
@@ -43,12 +101,69 @@ thrust::pair<ForwardIterator1, ForwardIterator2> unique_by_key(
   ForwardIterator1 keys_first,
   ForwardIterator1 keys_last,
   ForwardIterator2 values_first,
-  BinaryPredicate binary_pred)
+  BinaryPredicate binary_pred,
+  thrust::detail::false_type) // is_tileable
 {
-  // omp prefers generic::unique_by_key to cpp::unique_by_key
   return thrust::system::detail::generic::unique_by_key(exec, keys_first, keys_last, values_first, binary_pred);
 } // end unique_by_key()
 
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessOutputIterator1,
+          typename RandomAccessOutputIterator2,
+          typename BinaryPredicate>
+thrust::pair<RandomAccessOutputIterator1, RandomAccessOutputIterator2> unique_by_key_copy(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  RandomAccessOutputIterator1 keys_output,
+  RandomAccessOutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  thrust::detail::true_type) // is_tileable
+{
+  namespace internal = thrust::system::detail::internal;
+  using index_type   = std::intptr_t;
+
+  const internal::uniform_decomposition<index_type> decomp =
+    unique_detail::decompose(exec, keys_first, keys_last);
+
+  if (decomp.size() < 2)
+  {
+    return thrust::system::detail::sequential::unique_by_key_copy(
+      exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred);
+  }
+
+  const index_type num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<index_type, DerivedPolicy> offsets(exec, num_tiles + 1);
+  index_type* tile_offsets = thrust::raw_pointer_cast(offsets.data());
+
+  unique_detail::count_tiles(exec, keys_first, decomp, tile_offsets, binary_pred);
+
+  const index_type num_unique = internal::tile_offsets(tile_offsets, num_tiles);
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  const int threads = thrust::system::omp::detail::thread_count(exec);
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    internal::copy_unique_heads_by_key(
+      keys_first,
+      values_first,
+      decomp[i].begin(),
+      decomp[i].end(),
+      keys_output + tile_offsets[i],
+      values_output + tile_offsets[i],
+      binary_pred);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return thrust::make_pair(keys_output + num_unique, values_output + num_unique);
+} // end unique_by_key_copy()
+
 template <typename DerivedPolicy,
           typename InputIterator1,
           typename InputIterator2,
@@ -62,13 +177,59 @@ thrust::pair<OutputIterator1, OutputIterator2> unique_by_key_copy(
   InputIterator2 values_first,
   OutputIterator1 keys_output,
   OutputIterator2 values_output,
-  BinaryPredicate binary_pred)
+  BinaryPredicate binary_pred,
+  thrust::detail::false_type) // is_tileable
 {
-  // omp prefers generic::unique_by_key_copy to cpp::unique_by_key_copy
   return thrust::system::detail::generic::unique_by_key_copy(
     exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred);
 } // end unique_by_key_copy()
 
+} // end namespace unique_by_key_detail
+
+template <typename DerivedPolicy, typename ForwardIterator1, typename ForwardIterator2, typename BinaryPredicate>
+thrust::pair<ForwardIterator1, ForwardIterator2> unique_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator1 keys_first,
+  ForwardIterator1 keys_last,
+  ForwardIterator2 values_first,
+  BinaryPredicate binary_pred)
+{
+  return unique_by_key_detail::unique_by_key(
+    exec,
+    keys_first,
+    keys_last,
+    values_first,
+    binary_pred,
+    typename thrust::system::detail::internal::is_tileable<ForwardIterator1, ForwardIterator2>::type());
+} // end unique_by_key()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+thrust::pair<OutputIterator1, OutputIterator2> unique_by_key_copy(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred)
+{
+  return unique_by_key_detail::unique_by_key_copy(
+    exec,
+    keys_first,
+    keys_last,
+    values_first,
+    keys_output,
+    values_output,
+    binary_pred,
+    typename thrust::system::detail::internal::
+      is_tileable<InputIterator1, InputIterator2, OutputIterator1, OutputIterator2>::type());
+} // end unique_by_key_copy()
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
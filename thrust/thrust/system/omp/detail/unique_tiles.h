@@ -0,0 +1,96 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/static_assert.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/tuning_profile.h>
+#include <thrust/system/detail/internal/unique_tile.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace unique_detail
+{
+
+template <typename DerivedPolicy, typename RandomAccessIterator>
+thrust::system::detail::internal::uniform_decomposition<std::intptr_t>
+decompose(execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<RandomAccessIterator,
+                                             (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value),
+    "OpenMP compiler support is not enabled");
+
+  return thrust::system::omp::detail::default_decomposition(
+    exec,
+    static_cast<std::intptr_t>(last - first),
+    thrust::system::detail::internal::tuning_family::scan,
+    thrust::system::detail::internal::tuning_element_size<RandomAccessIterator>::value);
+}
+
+// counts the groups of every tile, which is all unique_count needs
+template <typename DerivedPolicy, typename RandomAccessIterator, typename BinaryPredicate>
+void count_tiles(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 const thrust::system::detail::internal::uniform_decomposition<std::intptr_t>& decomp,
+                 std::intptr_t* tile_counts,
+                 BinaryPredicate binary_pred)
+{
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using index_type = std::intptr_t;
+
+  const int threads          = thrust::system::omp::detail::thread_count(exec);
+  const index_type num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(threads))
+  for (index_type i = 0; i < num_tiles; ++i)
+  {
+    tile_counts[i] =
+      thrust::system::detail::internal::count_unique_heads(first, decomp[i].begin(), decomp[i].end(), binary_pred);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+} // end namespace unique_detail
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -122,6 +122,11 @@ struct tag : thrust::system::omp::execution_policy<tag> { unspecified };
  *
  *  The type of \p thrust::omp::par is implementation-defined.
  *
+ *  \p thrust::omp::par.with_threads(n) runs the parallel regions of an algorithm on \p n threads
+ *  instead of OpenMP's default, and \p thrust::omp::par.with_grain(g) never splits off less than
+ *  \p g elements of work for a single thread. The two may be chained and combined with an allocator,
+ *  as in \p thrust::omp::par(alloc).with_threads(n).with_grain(g).
+ *
  *  The following code snippet demonstrates how to use \p thrust::omp::par to explicitly dispatch an
  *  invocation of \p thrust::for_each to the OpenMP backend system:
  *
@@ -32,6 +32,7 @@
 #include <thrust/detail/type_traits.h>
 #include <thrust/memory.h>
 #include <thrust/mr/allocator.h>
+#include <thrust/system/cpp/memory.h>
 #include <thrust/system/omp/memory_resource.h>
 
 #include <ostream>
@@ -89,6 +90,11 @@ using allocator = thrust::mr::stateless_resource_allocator<T, thrust::system::om
 template <typename T>
 using universal_allocator = thrust::mr::stateless_resource_allocator<T, thrust::system::omp::universal_memory_resource>;
 
+// the omp algorithms share the temporary storage cache of the cpp system
+using thrust::system::cpp::get_temporary_cache_limit;
+using thrust::system::cpp::release_temporary_cache;
+using thrust::system::cpp::set_temporary_cache_limit;
+
 } // namespace omp
 } // namespace system
 
@@ -99,7 +105,10 @@ namespace omp
 {
 using thrust::system::omp::allocator;
 using thrust::system::omp::free;
+using thrust::system::omp::get_temporary_cache_limit;
 using thrust::system::omp::malloc;
+using thrust::system::omp::release_temporary_cache;
+using thrust::system::omp::set_temporary_cache_limit;
 using thrust::system::omp::universal_allocator;
 } // namespace omp
 
@@ -0,0 +1,134 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file omp/tuning.h
+ *  \brief Cutoffs that decide when the OpenMP algorithms run in parallel and
+ *         how finely they split their input.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/detail/internal/tuning_calibration.h>
+#include <thrust/system/detail/internal/tuning_profile.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/tuning.h>
+#include <thrust/system/omp/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+
+/*! \addtogroup execution_policies
+ *  \{
+ */
+
+/*! \p tuning_profile holds, for each \p tuning_family of algorithms, the input
+ *  size in bytes below which the algorithms run serially and the smallest
+ *  tile in bytes they hand to a thread, as well as an upper bound on the
+ *  number of threads they use.
+ *
+ *  The profile is read at startup from the file the environment variable
+ *  \c THRUST_OMP_TUNING_PROFILE names, if any. Its format is the one
+ *  <tt>operator<<</tt> writes, one setting per line:
+ *
+ *  \code
+ *  max_threads 0
+ *  for_each 1024 256
+ *  sort 4096 256
+ *  \endcode
+ *
+ *  Families the file doesn't mention keep their defaults.
+ *  \p thrust::omp::par.with_threads and \p thrust::omp::par.with_grain take
+ *  precedence over the profile.
+ */
+using tuning_profile = thrust::system::detail::internal::tuning_profile;
+
+/*! \p tuning_family enumerates the groups of algorithms whose cutoffs are
+ *  tuned together.
+ */
+using tuning_family = thrust::system::detail::internal::tuning_family;
+
+/*! \return The profile the OpenMP algorithms use when no other is given.
+ */
+inline tuning_profile default_tuning_profile()
+{
+  return detail::default_tuning_profile();
+}
+
+/*! \return The profile the OpenMP algorithms currently use.
+ */
+inline tuning_profile get_tuning_profile()
+{
+  return detail::tuning_profile_storage();
+}
+
+/*! Replaces the profile the OpenMP algorithms use.
+ *
+ *  \note Not synchronized with algorithms running concurrently.
+ */
+inline void set_tuning_profile(const tuning_profile& profile)
+{
+  detail::tuning_profile_storage() = profile;
+}
+
+/*! Times each family of OpenMP algorithms against its serial version on
+ *  inputs of up to a few megabytes and derives a profile from where the
+ *  parallel version starts to win. The profile in effect is left alone; pass
+ *  the result to \p set_tuning_profile, or write it to the file
+ *  \c THRUST_OMP_TUNING_PROFILE names, to use it.
+ *
+ *  \return The measured profile.
+ *  \note Takes on the order of seconds and must not run concurrently with
+ *        other OpenMP algorithms.
+ */
+inline tuning_profile calibrate_tuning_profile()
+{
+  detail::par_t par;
+
+  const int threads = detail::thread_count(par);
+
+  return thrust::system::detail::internal::calibrate_tuning_profile(
+    par, detail::tuning_profile_storage(), detail::default_tuning_profile(), static_cast<unsigned int>(threads));
+}
+
+/*! \}
+ */
+
+} // namespace omp
+} // namespace system
+
+namespace omp
+{
+using thrust::system::omp::calibrate_tuning_profile;
+using thrust::system::omp::default_tuning_profile;
+using thrust::system::omp::get_tuning_profile;
+using thrust::system::omp::set_tuning_profile;
+using thrust::system::omp::tuning_family;
+using thrust::system::omp::tuning_profile;
+} // namespace omp
+
+THRUST_NAMESPACE_END
@@ -0,0 +1,148 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/instrumentation.h>
+#include <thrust/system/detail/internal/tuning_profile.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/tuning.h>
+
+#include <cstddef>
+#include <thread>
+
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+// policies without per-call controls run in the calling thread's arena and
+// use each algorithm's own grain size
+template <typename DerivedPolicy>
+::tbb::task_arena* get_arena(const execution_policy<DerivedPolicy>&)
+{
+  return nullptr;
+}
+
+template <typename DerivedPolicy>
+std::size_t get_grain_size(const execution_policy<DerivedPolicy>&)
+{
+  return 0;
+}
+
+// the grain size of exec if it has one, otherwise default_grain_size
+template <typename DerivedPolicy>
+std::size_t grain_size(execution_policy<DerivedPolicy>& exec, std::size_t default_grain_size)
+{
+  const std::size_t result = get_grain_size(thrust::detail::derived_cast(exec));
+
+  return result > 0 ? result : default_grain_size;
+}
+
+// The grain size of exec if it has one, otherwise the tile size the tuning
+// profile prescribes for family.
+template <typename DerivedPolicy>
+std::size_t grain_size(execution_policy<DerivedPolicy>& exec,
+                       thrust::system::detail::internal::tuning_family family,
+                       std::size_t element_size)
+{
+  return grain_size(exec, tuning_profile_storage().tile_size(family, element_size));
+}
+
+// The number of elements below which family runs serially: the grain size of
+// exec if it has one, otherwise the serial cutoff of the tuning profile.
+template <typename DerivedPolicy>
+std::size_t serial_cutoff(execution_policy<DerivedPolicy>& exec,
+                          thrust::system::detail::internal::tuning_family family,
+                          std::size_t element_size)
+{
+  return grain_size(exec, tuning_profile_storage().serial_cutoff(family, element_size));
+}
+
+// the grain size of a blocked_range over n elements of family, which keeps
+// inputs below the serial cutoff in a single piece
+template <typename DerivedPolicy>
+std::size_t grain_size(execution_policy<DerivedPolicy>& exec,
+                       thrust::system::detail::internal::tuning_family family,
+                       std::size_t element_size,
+                       std::size_t n)
+{
+  if (get_grain_size(thrust::detail::derived_cast(exec)) == 0
+      && n < tuning_profile_storage().serial_cutoff(family, element_size))
+  {
+    return n > 0 ? n : 1;
+  }
+
+  return grain_size(exec, family, element_size);
+}
+
+// the number of threads that may work on behalf of exec at once, which the
+// tuning profile caps unless exec brings its own arena
+template <typename DerivedPolicy>
+unsigned int concurrency(execution_policy<DerivedPolicy>& exec)
+{
+  ::tbb::task_arena* arena = get_arena(thrust::detail::derived_cast(exec));
+
+  int result = arena ? arena->max_concurrency() : static_cast<int>(std::thread::hardware_concurrency());
+
+  const int max_threads = tuning_profile_storage().max_threads;
+
+  if (!arena && max_threads > 0 && max_threads < result)
+  {
+    result = max_threads;
+  }
+
+  return result > 1 ? static_cast<unsigned int>(result) : 1u;
+}
+
+// runs f, which launches the parallel work of an algorithm, in the arena of
+// exec. Nested calls from within that arena run f directly.
+template <typename DerivedPolicy, typename Function>
+void execute(execution_policy<DerivedPolicy>& exec, Function f)
+{
+  THRUST_DETAIL_INSTRUMENT_THREADS(static_cast<int>(thrust::system::tbb::detail::concurrency(exec)));
+
+  ::tbb::task_arena* arena = get_arena(thrust::detail::derived_cast(exec));
+
+  if (arena)
+  {
+    arena->execute(f);
+  }
+  else
+  {
+    f();
+  }
+}
+
+} // namespace detail
+} // namespace tbb
+} // namespace system
+THRUST_NAMESPACE_END
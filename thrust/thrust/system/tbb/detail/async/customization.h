@@ -0,0 +1,126 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/cpp14_required.h>
+
+#if _CCCL_STD_VER >= 2014
+
+#  include <thrust/detail/execute_with_dependencies.h>
+#  include <thrust/system/detail/internal/host_async/future.h>
+#  include <thrust/system/tbb/detail/arena.h>
+#  include <thrust/system/tbb/detail/execution_policy.h>
+#  include <thrust/system/tbb/future.h>
+
+#  include <memory>
+#  include <tuple>
+#  include <utility>
+
+#  include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace async_detail
+{
+
+inline ::tbb::task_arena& default_async_arena()
+{
+  static ::tbb::task_arena arena;
+  return arena;
+}
+
+// Enqueued tasks never block a worker: a task is only submitted once all of
+// its dependencies have completed.
+struct submit_to_arena
+{
+  ::tbb::task_arena* arena;
+
+  void operator()(thrust::system::detail::internal::host_async::task_ptr t) const
+  {
+    std::shared_ptr<thrust::system::detail::internal::host_async::task> shared(std::move(t));
+    arena->enqueue([shared] {
+      shared->run();
+    });
+  }
+};
+
+template <typename DerivedPolicy>
+submit_to_arena make_submit(DerivedPolicy const& policy)
+{
+  ::tbb::task_arena* arena = get_arena(policy);
+  return submit_to_arena{arena ? arena : &default_async_arena()};
+}
+
+// Takes over the dependencies of policy, then runs f(policy) in its arena once
+// they have completed. The policy itself moves along with the work, so
+// that per-call controls and allocators still apply.
+template <typename DerivedPolicy, typename F, typename... Dependencies>
+unique_eager_event invoke(DerivedPolicy& policy, F&& f, std::tuple<Dependencies...>&& extra_deps)
+{
+  auto deps   = std::tuple_cat(thrust::detail::extract_dependencies(std::move(policy)), std::move(extra_deps));
+  auto submit = async_detail::make_submit(policy);
+
+  return thrust::system::detail::internal::host_async::make_dependent_event<tag>(
+    submit,
+    [policy = std::move(policy), f = std::forward<F>(f)]() mutable {
+      f(policy);
+    },
+    std::move(deps));
+}
+
+template <typename DerivedPolicy, typename F>
+unique_eager_event invoke(DerivedPolicy& policy, F&& f)
+{
+  return async_detail::invoke(policy, std::forward<F>(f), std::tuple<>{});
+}
+
+// Like invoke, but the result of f(policy) becomes the content of a future.
+template <typename T, typename DerivedPolicy, typename F>
+unique_eager_future<T> invoke_future(DerivedPolicy& policy, F&& f)
+{
+  auto deps   = thrust::detail::extract_dependencies(std::move(policy));
+  auto submit = async_detail::make_submit(policy);
+
+  return thrust::system::detail::internal::host_async::make_dependent_future<tag, T>(
+    submit,
+    [policy = std::move(policy), f = std::forward<F>(f)]() mutable {
+      return f(policy);
+    },
+    std::move(deps));
+}
+
+} // namespace async_detail
+} // namespace detail
+} // namespace tbb
+} // namespace system
+THRUST_NAMESPACE_END
+
+#endif // C++14
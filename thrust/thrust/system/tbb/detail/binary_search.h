@@ -25,6 +25,183 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/system/detail/generic/binary_search.h>
+#include <thrust/system/detail/internal/batched_search.h>
+#include <thrust/system/detail/internal/tile_compaction.h>
+#include <thrust/system/detail/internal/tuning_profile.h>
+#include <thrust/system/tbb/detail/arena.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
 
-// this system inherits binary_search
+#include <cstddef>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+// this system inherits the scalar binary_search
 #include <thrust/system/cpp/detail/binary_search.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace binary_search_detail
+{
+
+// every task searches for a range of the queries, in groups or merging them
+// into the haystack if they are sorted
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename StrictWeakOrdering,
+          typename Search,
+          typename BinarySearchFunction>
+RandomAccessIterator3 batched_search(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 begin,
+  RandomAccessIterator1 end,
+  RandomAccessIterator2 values_begin,
+  RandomAccessIterator2 values_end,
+  RandomAccessIterator3 output,
+  StrictWeakOrdering comp,
+  Search search,
+  BinarySearchFunction,
+  thrust::detail::true_type) // is_tileable
+{
+  const std::ptrdiff_t n          = static_cast<std::ptrdiff_t>(end - begin);
+  const std::ptrdiff_t num_values = static_cast<std::ptrdiff_t>(values_end - values_begin);
+
+  // the prefetches only apply to pointers
+  auto first = thrust::try_unwrap_contiguous_iterator(begin);
+
+  const std::ptrdiff_t grain = static_cast<std::ptrdiff_t>(thrust::system::tbb::detail::grain_size(
+    exec,
+    thrust::system::detail::internal::tuning_family::for_each,
+    thrust::system::detail::internal::tuning_element_size<RandomAccessIterator2>::value,
+    static_cast<std::size_t>(num_values)));
+
+  thrust::system::tbb::detail::execute(exec, [&] {
+    ::tbb::parallel_for(::tbb::blocked_range<std::ptrdiff_t>(0, num_values, grain),
+                        [&](const ::tbb::blocked_range<std::ptrdiff_t>& r) {
+                          thrust::system::detail::internal::batched_search(
+                            first, n, values_begin, r.begin(), r.end(), output, comp, search);
+                        });
+  });
+
+  return output + num_values;
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename Search,
+          typename BinarySearchFunction>
+OutputIterator batched_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp,
+  Search,
+  BinarySearchFunction func,
+  thrust::detail::false_type) // is_tileable
+{
+  return thrust::system::detail::generic::detail::binary_search(
+    exec, begin, end, values_begin, values_end, output, comp, func);
+}
+
+} // namespace binary_search_detail
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator lower_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::batched_search(
+    exec,
+    begin,
+    end,
+    values_begin,
+    values_end,
+    output,
+    comp,
+    thrust::system::detail::internal::lower_bound_search(),
+    thrust::system::detail::generic::detail::lbf(),
+    thrust::system::detail::internal::is_tileable<ForwardIterator, InputIterator, OutputIterator>());
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator upper_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::batched_search(
+    exec,
+    begin,
+    end,
+    values_begin,
+    values_end,
+    output,
+    comp,
+    thrust::system::detail::internal::upper_bound_search(),
+    thrust::system::detail::generic::detail::ubf(),
+    thrust::system::detail::internal::is_tileable<ForwardIterator, InputIterator, OutputIterator>());
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator binary_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  return binary_search_detail::batched_search(
+    exec,
+    begin,
+    end,
+    values_begin,
+    values_end,
+    output,
+    comp,
+    thrust::system::detail::internal::binary_search_search(),
+    thrust::system::detail::generic::detail::bsf(),
+    thrust::system::detail::internal::is_tileable<ForwardIterator, InputIterator, OutputIterator>());
+}
+
+} // namespace detail
+} // namespace tbb
+} // namespace system
+THRUST_NAMESPACE_END
@@ -28,8 +28,16 @@
 #include <thrust/detail/copy.h>
 #include <thrust/detail/type_traits/minimum_type.h>
 #include <thrust/system/detail/generic/copy.h>
+#include <thrust/system/detail/internal/trivial_copy.h>
 #include <thrust/system/detail/sequential/copy.h>
+#include <thrust/system/detail/sequential/trivial_copy.h>
+#include <thrust/system/tbb/detail/arena.h>
 #include <thrust/system/tbb/detail/copy.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+#include <thrust/type_traits/is_trivially_relocatable.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -38,6 +46,47 @@ namespace tbb
 {
 namespace detail
 {
+
+// copies trivially relocatable data with one memcpy per task over whole
+// pages of the destination
+template <typename DerivedPolicy, typename T, typename Size>
+T* trivial_copy_n(execution_policy<DerivedPolicy>& exec, const T* first, Size n, T* result)
+{
+  namespace internal = thrust::system::detail::internal;
+
+  if (n <= 0)
+  {
+    return result;
+  }
+
+  const std::size_t bytes                 = static_cast<std::size_t>(n) * sizeof(T);
+  const internal::tuning_cutoffs& cutoffs = tuning_profile_storage()[internal::tuning_family::copy];
+  const internal::trivial_copy_partition partition(
+    result, static_cast<std::size_t>(n), sizeof(T), concurrency(exec), cutoffs);
+
+  if (partition.size() < 2 || internal::trivial_copy_overlaps(first, result, bytes))
+  {
+    return thrust::system::detail::sequential::trivial_copy_n(first, n, result);
+  }
+
+  const bool streaming = internal::use_streaming_stores(bytes);
+
+  thrust::system::tbb::detail::execute(exec, [&] {
+    ::tbb::parallel_for(::tbb::blocked_range<std::size_t>(0, partition.size(), 1),
+                        [&](const ::tbb::blocked_range<std::size_t>& r) {
+                          for (std::size_t i = r.begin(); i < r.end(); ++i)
+                          {
+                            const std::size_t begin = partition.begin(i);
+                            const std::size_t end   = partition.end(i);
+
+                            internal::copy_bytes(result + begin, first + begin, (end - begin) * sizeof(T), streaming);
+                          }
+                        });
+  });
+
+  return result + n;
+} // end trivial_copy_n()
+
 namespace dispatch
 {
 
@@ -52,6 +101,32 @@ copy(execution_policy<DerivedPolicy>& exec,
   return thrust::system::detail::sequential::copy(exec, first, last, result);
 } // end copy()
 
+template <typename DerivedPolicy, typename InputIterator, typename Size, typename OutputIterator>
+OutputIterator
+copy_n(execution_policy<DerivedPolicy>& exec,
+       InputIterator first,
+       Size n,
+       OutputIterator result,
+       thrust::random_access_traversal_tag,
+       thrust::detail::true_type) // is_indirectly_trivially_relocatable_to
+{
+  tbb::detail::trivial_copy_n(
+    exec, thrust::unwrap_contiguous_iterator(first), n, thrust::unwrap_contiguous_iterator(result));
+  return result + n;
+} // end copy_n()
+
+template <typename DerivedPolicy, typename InputIterator, typename Size, typename OutputIterator>
+OutputIterator
+copy_n(execution_policy<DerivedPolicy>& exec,
+       InputIterator first,
+       Size n,
+       OutputIterator result,
+       thrust::random_access_traversal_tag,
+       thrust::detail::false_type) // is_indirectly_trivially_relocatable_to
+{
+  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+} // end copy_n()
+
 template <typename DerivedPolicy, typename InputIterator, typename OutputIterator>
 OutputIterator
 copy(execution_policy<DerivedPolicy>& exec,
@@ -60,7 +135,13 @@ copy(execution_policy<DerivedPolicy>& exec,
      OutputIterator result,
      thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy(exec, first, last, result);
+  return dispatch::copy_n(
+    exec,
+    first,
+    last - first,
+    result,
+    thrust::random_access_traversal_tag(),
+    typename thrust::is_indirectly_trivially_relocatable_to<InputIterator, OutputIterator>::type());
 } // end copy()
 
 template <typename DerivedPolicy, typename InputIterator, typename Size, typename OutputIterator>
@@ -82,7 +163,13 @@ copy_n(execution_policy<DerivedPolicy>& exec,
        OutputIterator result,
        thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+  return dispatch::copy_n(
+    exec,
+    first,
+    n,
+    result,
+    thrust::random_access_traversal_tag(),
+    typename thrust::is_indirectly_trivially_relocatable_to<InputIterator, OutputIterator>::type());
 } // end copy_n()
 
 } // namespace dispatch
@@ -28,6 +28,7 @@
 #include <thrust/detail/function.h>
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/tbb/detail/arena.h>
 #include <thrust/system/tbb/detail/copy_if.h>
 
 #include <tbb/blocked_range.h>
@@ -111,9 +112,17 @@ struct body
 
 } // namespace copy_if_detail
 
-template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Predicate>
-OutputIterator
-copy_if(tag, InputIterator1 first, InputIterator1 last, InputIterator2 stencil, OutputIterator result, Predicate pred)
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename Predicate>
+OutputIterator copy_if(execution_policy<DerivedPolicy>& exec,
+                       InputIterator1 first,
+                       InputIterator1 last,
+                       InputIterator2 stencil,
+                       OutputIterator result,
+                       Predicate pred)
 {
   using Size = typename thrust::iterator_difference<InputIterator1>::type;
   using Body = typename copy_if_detail::body<InputIterator1, InputIterator2, OutputIterator, Predicate, Size>;
@@ -123,7 +132,10 @@ copy_if(tag, InputIterator1 first, InputIterator1 last, InputIterator2 stencil,
   if (n != 0)
   {
     Body body(first, stencil, result, pred);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), body);
+    const Size grain = static_cast<Size>(thrust::system::tbb::detail::grain_size(exec, 1));
+    thrust::system::tbb::detail::execute(exec, [&] {
+      ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n, grain), body);
+    });
     thrust::advance(result, body.sum);
   }
 
@@ -0,0 +1,154 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in ctbbliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/fill.h>
+#include <thrust/system/detail/internal/trivial_copy.h>
+#include <thrust/system/tbb/detail/arena.h>
+#include <thrust/system/tbb/detail/fill.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace fill_detail
+{
+
+template <typename OutputIterator, typename T>
+using is_trivial_fill =
+  thrust::detail::integral_constant<bool,
+                                    thrust::is_contiguous_iterator<OutputIterator>::value
+                                      && thrust::system::detail::internal::is_trivially_fillable<
+                                        typename thrust::iterator_value<OutputIterator>::type,
+                                        T>::value>;
+
+// fills trivially copyable data with one memset, or store loop, per task
+// over whole pages of the destination
+template <typename DerivedPolicy, typename T>
+void trivial_fill_n(execution_policy<DerivedPolicy>& exec, T* first, std::size_t n, const T& value)
+{
+  namespace internal = thrust::system::detail::internal;
+
+  const bool streaming                    = internal::use_streaming_stores(n * sizeof(T));
+  const internal::tuning_cutoffs& cutoffs = tuning_profile_storage()[internal::tuning_family::copy];
+  const internal::trivial_copy_partition partition(first, n, sizeof(T), concurrency(exec), cutoffs);
+
+  if (partition.size() < 2)
+  {
+    internal::fill_elements(first, n, value, streaming);
+    return;
+  }
+
+  thrust::system::tbb::detail::execute(exec, [&] {
+    ::tbb::parallel_for(::tbb::blocked_range<std::size_t>(0, partition.size(), 1),
+                        [&](const ::tbb::blocked_range<std::size_t>& r) {
+                          for (std::size_t i = r.begin(); i < r.end(); ++i)
+                          {
+                            const std::size_t begin = partition.begin(i);
+                            const std::size_t end   = partition.end(i);
+
+                            internal::fill_elements(first + begin, end - begin, value, streaming);
+                          }
+                        });
+  });
+} // end trivial_fill_n()
+
+template <typename DerivedPolicy, typename OutputIterator, typename Size, typename T>
+OutputIterator fill_n(execution_policy<DerivedPolicy>& exec,
+                      OutputIterator first,
+                      Size n,
+                      const T& value,
+                      thrust::detail::true_type) // is_trivial_fill
+{
+  using value_type = typename thrust::iterator_value<OutputIterator>::type;
+
+  if (n <= 0)
+  {
+    return first;
+  }
+
+  fill_detail::trivial_fill_n(
+    exec, thrust::unwrap_contiguous_iterator(first), static_cast<std::size_t>(n), static_cast<value_type>(value));
+
+  return first + n;
+} // end fill_n()
+
+template <typename DerivedPolicy, typename OutputIterator, typename Size, typename T>
+OutputIterator fill_n(execution_policy<DerivedPolicy>& exec,
+                      OutputIterator first,
+                      Size n,
+                      const T& value,
+                      thrust::detail::false_type) // is_trivial_fill
+{
+  return thrust::system::detail::generic::fill_n(exec, first, n, value);
+} // end fill_n()
+
+template <typename DerivedPolicy, typename ForwardIterator, typename T>
+void fill(execution_policy<DerivedPolicy>& exec,
+          ForwardIterator first,
+          ForwardIterator last,
+          const T& value,
+          thrust::detail::true_type) // is_trivial_fill
+{
+  fill_detail::fill_n(exec, first, last - first, value, thrust::detail::true_type());
+} // end fill()
+
+template <typename DerivedPolicy, typename ForwardIterator, typename T>
+void fill(execution_policy<DerivedPolicy>& exec,
+          ForwardIterator first,
+          ForwardIterator last,
+          const T& value,
+          thrust::detail::false_type) // is_trivial_fill
+{
+  thrust::system::detail::generic::fill(exec, first, last, value);
+} // end fill()
+
+} // namespace fill_detail
+
+template <typename DerivedPolicy, typename OutputIterator, typename Size, typename T>
+OutputIterator fill_n(execution_policy<DerivedPolicy>& exec, OutputIterator first, Size n, const T& value)
+{
+  return fill_detail::fill_n(exec, first, n, value, typename fill_detail::is_trivial_fill<OutputIterator, T>::type());
+} // end fill_n()
+
+template <typename DerivedPolicy, typename ForwardIterator, typename T>
+void fill(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, const T& value)
+{
+  fill_detail::fill(exec, first, last, value, typename fill_detail::is_trivial_fill<ForwardIterator, T>::type());
+} // end fill()
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
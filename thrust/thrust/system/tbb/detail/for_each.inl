@@ -29,6 +29,7 @@
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/tbb/detail/arena.h>
 
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
@@ -70,9 +71,17 @@ body<RandomAccessIterator, Size, UnaryFunction> make_body(RandomAccessIterator f
 } // namespace for_each_detail
 
 template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename UnaryFunction>
-RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIterator first, Size n, UnaryFunction f)
+RandomAccessIterator
+for_each_n(execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, Size n, UnaryFunction f)
 {
-  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, n), for_each_detail::make_body<Size>(first, f));
+  const Size grain = static_cast<Size>(thrust::system::tbb::detail::grain_size(
+    exec,
+    thrust::system::detail::internal::tuning_family::for_each,
+    thrust::system::detail::internal::tuning_element_size<RandomAccessIterator>::value,
+    static_cast<std::size_t>(n)));
+  thrust::system::tbb::detail::execute(exec, [&] {
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, n, grain), for_each_detail::make_body<Size>(first, f));
+  });
 
   // return the end of the range
   return first + n;
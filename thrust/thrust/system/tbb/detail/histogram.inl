@@ -0,0 +1,154 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/histogram.h>
+#include <thrust/system/tbb/detail/arena.h>
+#include <thrust/system/tbb/detail/histogram.h>
+
+#include <vector>
+
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace histogram_detail
+{
+
+// Every thread counts into bins of its own, which are summed afterwards, so
+// that threads never contend for a count.
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator, typename BinIndex>
+OutputIterator privatized_histogram(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator histogram,
+  int num_bins,
+  BinIndex bin_index)
+{
+  using CountType = typename thrust::iterator_value<OutputIterator>::type;
+  using Size      = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  if (num_bins <= 0)
+  {
+    return histogram;
+  }
+
+  const Size n = thrust::distance(first, last);
+
+  ::tbb::enumerable_thread_specific<std::vector<CountType>> private_counts(
+    static_cast<std::size_t>(num_bins), CountType(0));
+
+  const Size grain = static_cast<Size>(thrust::system::tbb::detail::grain_size(exec, 1));
+
+  thrust::system::tbb::detail::execute(exec, [&] {
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, n, grain), [&](const ::tbb::blocked_range<Size>& r) {
+      thrust::system::detail::internal::histogram_tile(
+        first + r.begin(), r.end() - r.begin(), bin_index, num_bins, private_counts.local().data());
+    });
+
+    ::tbb::parallel_for(::tbb::blocked_range<int>(0, num_bins), [&](const ::tbb::blocked_range<int>& r) {
+      for (int b = r.begin(); b < r.end(); ++b)
+      {
+        CountType sum(0);
+
+        for (const std::vector<CountType>& counts : private_counts)
+        {
+          sum += counts[b];
+        }
+
+        histogram[b] = sum;
+      }
+    });
+  });
+
+  return histogram + num_bins;
+}
+
+} // namespace histogram_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename OutputIterator, typename Level>
+OutputIterator histogram_even(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  OutputIterator histogram,
+  int num_levels,
+  Level lower_level,
+  Level upper_level)
+{
+  const int num_bins = num_levels - 1;
+
+  if (num_bins <= 0)
+  {
+    return histogram;
+  }
+
+  return histogram_detail::privatized_histogram(
+    exec,
+    first,
+    last,
+    histogram,
+    num_bins,
+    thrust::system::detail::internal::even_bin_index<Level>(lower_level, upper_level, num_bins));
+} // end histogram_even()
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename OutputIterator>
+OutputIterator histogram_range(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first,
+  RandomAccessIterator1 last,
+  RandomAccessIterator2 levels_first,
+  RandomAccessIterator2 levels_last,
+  OutputIterator histogram)
+{
+  const int num_levels = static_cast<int>(thrust::distance(levels_first, levels_last));
+
+  return histogram_detail::privatized_histogram(
+    exec,
+    first,
+    last,
+    histogram,
+    num_levels - 1,
+    thrust::system::detail::internal::range_bin_index<RandomAccessIterator2>{levels_first, num_levels});
+} // end histogram_range()
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
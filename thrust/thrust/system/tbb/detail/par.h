@@ -26,8 +26,13 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/detail/allocator_aware_execution_policy.h>
+#include <thrust/detail/dependencies_aware_execution_policy.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
+#include <cstddef>
+
+#include <tbb/task_arena.h>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -36,13 +41,77 @@ namespace tbb
 namespace detail
 {
 
+// carries the per-call controls of tbb::par: the task arena the algorithm's
+// parallel work runs in and the smallest amount of work split off as a task
+template <typename Derived>
+struct execute_on_arena_base : thrust::system::tbb::detail::execution_policy<Derived>
+{
+private:
+  ::tbb::task_arena* arena;
+  std::size_t grain_size;
+
+public:
+  execute_on_arena_base(::tbb::task_arena* arena_ = nullptr, std::size_t grain_size_ = 0)
+      : arena(arena_)
+      , grain_size(grain_size_)
+  {}
+
+  Derived on(::tbb::task_arena& a) const
+  {
+    Derived result = thrust::detail::derived_cast(*this);
+    result.arena   = &a;
+    return result;
+  }
+
+  Derived with_grain(std::size_t g) const
+  {
+    Derived result    = thrust::detail::derived_cast(*this);
+    result.grain_size = g;
+    return result;
+  }
+
+private:
+  friend ::tbb::task_arena* get_arena(const execute_on_arena_base& exec)
+  {
+    return exec.arena;
+  }
+
+  friend std::size_t get_grain_size(const execute_on_arena_base& exec)
+  {
+    return exec.grain_size;
+  }
+};
+
+struct execute_on_arena : execute_on_arena_base<execute_on_arena>
+{
+  using base_t = execute_on_arena_base<execute_on_arena>;
+
+  execute_on_arena(::tbb::task_arena* arena, std::size_t grain_size)
+      : base_t(arena, grain_size)
+  {}
+};
+
 struct par_t
     : thrust::system::tbb::detail::execution_policy<par_t>
-    , thrust::detail::allocator_aware_execution_policy<thrust::system::tbb::detail::execution_policy>
+    , thrust::detail::allocator_aware_execution_policy<execute_on_arena_base>
+    , thrust::detail::dependencies_aware_execution_policy<execute_on_arena_base>
 {
   _CCCL_HOST_DEVICE constexpr par_t()
       : thrust::system::tbb::detail::execution_policy<par_t>()
   {}
+
+  // runs the parallel work of an algorithm in arena, whose concurrency then
+  // bounds the number of threads working on it
+  execute_on_arena on(::tbb::task_arena& arena) const
+  {
+    return execute_on_arena(&arena, 0);
+  }
+
+  // never splits off tasks of fewer than g elements
+  execute_on_arena with_grain(std::size_t g) const
+  {
+    return execute_on_arena(nullptr, g);
+  }
 };
 
 } // namespace detail
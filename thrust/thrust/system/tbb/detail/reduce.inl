@@ -30,6 +30,8 @@
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reduce.h>
+#include <thrust/system/detail/internal/reduce_tile.h>
+#include <thrust/system/tbb/detail/arena.h>
 
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_reduce.h>
@@ -78,16 +80,8 @@ struct body
       return; // nothing to do
     }
 
-    RandomAccessIterator iter = first + r.begin();
-
-    OutputType temp = thrust::raw_reference_cast(*iter);
-
-    ++iter;
-
-    for (Size i = r.begin() + 1; i != r.end(); ++i, ++iter)
-    {
-      temp = binary_op(temp, *iter);
-    }
+    OutputType temp = thrust::system::detail::internal::reduce_tile<OutputType>(
+      first + r.begin(), r.end() - r.begin(), binary_op.m_f);
 
     if (first_call)
     {
@@ -111,8 +105,11 @@ struct body
 } // namespace reduce_detail
 
 template <typename DerivedPolicy, typename InputIterator, typename OutputType, typename BinaryFunction>
-OutputType reduce(
-  execution_policy<DerivedPolicy>&, InputIterator begin, InputIterator end, OutputType init, BinaryFunction binary_op)
+OutputType reduce(execution_policy<DerivedPolicy>& exec,
+                  InputIterator begin,
+                  InputIterator end,
+                  OutputType init,
+                  BinaryFunction binary_op)
 {
   using Size = typename thrust::iterator_difference<InputIterator>::type;
 
@@ -126,7 +123,14 @@ OutputType reduce(
   {
     using Body = typename reduce_detail::body<InputIterator, OutputType, BinaryFunction>;
     Body reduce_body(begin, init, binary_op);
-    ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0, n), reduce_body);
+    const Size grain = static_cast<Size>(thrust::system::tbb::detail::grain_size(
+      exec,
+      thrust::system::detail::internal::tuning_family::reduce,
+      thrust::system::detail::internal::tuning_element_size<InputIterator>::value,
+      static_cast<std::size_t>(n)));
+    thrust::system::tbb::detail::execute(exec, [&] {
+      ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0, n, grain), reduce_body);
+    });
     return binary_op(init, reduce_body.sum);
   }
 }
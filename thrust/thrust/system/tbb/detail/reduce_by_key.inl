@@ -32,6 +32,7 @@
 #include <thrust/detail/type_traits/iterator/is_output_iterator.h>
 #include <thrust/iterator/reverse_iterator.h>
 #include <thrust/scan.h>
+#include <thrust/system/tbb/detail/arena.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 #include <thrust/system/tbb/detail/reduce_by_key.h>
 #include <thrust/system/tbb/detail/reduce_intervals.h>
@@ -39,7 +40,6 @@
 #include <cuda/std/__type_traits/void_t.h>
 
 #include <cassert>
-#include <thread>
 
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
@@ -308,8 +308,10 @@ thrust::pair<Iterator3, Iterator4> reduce_by_key(
     return thrust::make_pair(keys_result, values_result);
   }
 
-  // XXX this value is a tuning opportunity
-  const difference_type parallelism_threshold = 10000;
+  const std::size_t key_size = thrust::system::detail::internal::tuning_element_size<Iterator1>::value;
+
+  const difference_type parallelism_threshold = static_cast<difference_type>(thrust::system::tbb::detail::serial_cutoff(
+    exec, thrust::system::detail::internal::tuning_family::reduce_by_key, key_size));
 
   if (n < parallelism_threshold)
   {
@@ -319,13 +321,15 @@ thrust::pair<Iterator3, Iterator4> reduce_by_key(
   }
 
   // count the number of processors
-  const unsigned int p = thrust::max<unsigned int>(1u, std::thread::hardware_concurrency());
+  const unsigned int p = thrust::system::tbb::detail::concurrency(exec);
 
   // generate O(P) intervals of sequential work
   // XXX oversubscribing is a tuning opportunity
   const unsigned int subscription_rate = 1;
+  const difference_type grain = static_cast<difference_type>(thrust::system::tbb::detail::grain_size(
+    exec, thrust::system::detail::internal::tuning_family::reduce_by_key, key_size));
   difference_type interval_size =
-    thrust::min<difference_type>(parallelism_threshold, thrust::max<difference_type>(n, n / (subscription_rate * p)));
+    thrust::min<difference_type>(grain, thrust::max<difference_type>(n, n / (subscription_rate * p)));
   difference_type num_intervals = reduce_by_key_detail::divide_ri(n, interval_size);
 
   // decompose the input into intervals of size N / num_intervals
@@ -357,21 +361,23 @@ thrust::pair<Iterator3, Iterator4> reduce_by_key(
   thrust::detail::temporary_array<carry_type, DerivedPolicy> carries(0, exec, num_intervals - 1);
 
   // force grainsize == 1 with simple_partioner()
-  ::tbb::parallel_for(
-    ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
-    reduce_by_key_detail::make_serial_reduce_by_key_body(
-      keys_first,
-      values_first,
-      interval_output_offsets.begin(),
-      keys_result,
-      values_result,
-      carries.begin(),
-      n,
-      interval_size,
-      num_intervals,
-      binary_pred,
-      binary_op),
-    ::tbb::simple_partitioner());
+  thrust::system::tbb::detail::execute(exec, [&] {
+    ::tbb::parallel_for(
+      ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+      reduce_by_key_detail::make_serial_reduce_by_key_body(
+        keys_first,
+        values_first,
+        interval_output_offsets.begin(),
+        keys_result,
+        values_result,
+        carries.begin(),
+        n,
+        interval_size,
+        num_intervals,
+        binary_pred,
+        binary_op),
+      ::tbb::simple_partitioner());
+  });
 
   difference_type size_of_result = interval_output_offsets[num_intervals];
 
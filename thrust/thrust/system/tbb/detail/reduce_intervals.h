@@ -30,6 +30,7 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reduce.h>
 #include <thrust/system/cpp/memory.h>
+#include <thrust/system/tbb/detail/arena.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
 #include <cassert>
@@ -104,7 +105,7 @@ template <typename DerivedPolicy,
           typename RandomAccessIterator2,
           typename BinaryFunction>
 void reduce_intervals(
-  thrust::tbb::execution_policy<DerivedPolicy>&,
+  thrust::tbb::execution_policy<DerivedPolicy>& exec,
   RandomAccessIterator1 first,
   RandomAccessIterator1 last,
   Size interval_size,
@@ -115,9 +116,11 @@ void reduce_intervals(
 
   Size num_intervals = reduce_intervals_detail::divide_ri(n, interval_size);
 
-  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_intervals, 1),
-                      reduce_intervals_detail::make_body(first, result, Size(n), interval_size, binary_op),
-                      ::tbb::simple_partitioner());
+  thrust::system::tbb::detail::execute(exec, [&] {
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_intervals, 1),
+                        reduce_intervals_detail::make_body(first, result, Size(n), interval_size, binary_op),
+                        ::tbb::simple_partitioner());
+  });
 }
 
 template <typename DerivedPolicy, typename RandomAccessIterator1, typename Size, typename RandomAccessIterator2>
@@ -39,13 +39,20 @@ namespace tbb
 namespace detail
 {
 
-template <typename InputIterator, typename OutputIterator, typename BinaryFunction>
-OutputIterator
-inclusive_scan(tag, InputIterator first, InputIterator last, OutputIterator result, BinaryFunction binary_op);
-
-template <typename InputIterator, typename OutputIterator, typename T, typename BinaryFunction>
-OutputIterator
-exclusive_scan(tag, InputIterator first, InputIterator last, OutputIterator result, T init, BinaryFunction binary_op);
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryFunction>
+OutputIterator inclusive_scan(execution_policy<DerivedPolicy>& exec,
+                              InputIterator first,
+                              InputIterator last,
+                              OutputIterator result,
+                              BinaryFunction binary_op);
+
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename T, typename BinaryFunction>
+OutputIterator exclusive_scan(execution_policy<DerivedPolicy>& exec,
+                              InputIterator first,
+                              InputIterator last,
+                              OutputIterator result,
+                              T init,
+                              BinaryFunction binary_op);
 
 } // end namespace detail
 } // end namespace tbb
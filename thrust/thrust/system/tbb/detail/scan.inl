@@ -25,12 +25,12 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-#include <thrust/advance.h>
 #include <thrust/detail/function.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/detail/type_traits/iterator/is_output_iterator.h>
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/tbb/detail/arena.h>
 #include <thrust/system/tbb/detail/scan.h>
 
 #include <tbb/blocked_range.h>
@@ -225,9 +225,12 @@ struct exclusive_body
 
 } // namespace scan_detail
 
-template <typename InputIterator, typename OutputIterator, typename BinaryFunction>
-OutputIterator
-inclusive_scan(tag, InputIterator first, InputIterator last, OutputIterator result, BinaryFunction binary_op)
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryFunction>
+OutputIterator inclusive_scan(execution_policy<DerivedPolicy>& exec,
+                              InputIterator first,
+                              InputIterator last,
+                              OutputIterator result,
+                              BinaryFunction binary_op)
 {
   using namespace thrust::detail;
 
@@ -241,17 +244,30 @@ inclusive_scan(tag, InputIterator first, InputIterator last, OutputIterator resu
   {
     using Body = typename scan_detail::inclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType>;
     Body scan_body(first, result, binary_op, *first);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), scan_body);
+    const Size grain = static_cast<Size>(thrust::system::tbb::detail::grain_size(
+      exec,
+      thrust::system::detail::internal::tuning_family::scan,
+      thrust::system::detail::internal::tuning_element_size<InputIterator>::value,
+      static_cast<std::size_t>(n)));
+    thrust::system::tbb::detail::execute(exec, [&] {
+      ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n, grain), scan_body);
+    });
   }
 
-  thrust::advance(result, n);
-
-  return result;
+  return result + n;
 }
 
-template <typename InputIterator, typename OutputIterator, typename InitialValueType, typename BinaryFunction>
-OutputIterator exclusive_scan(
-  tag, InputIterator first, InputIterator last, OutputIterator result, InitialValueType init, BinaryFunction binary_op)
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
+OutputIterator exclusive_scan(execution_policy<DerivedPolicy>& exec,
+                              InputIterator first,
+                              InputIterator last,
+                              OutputIterator result,
+                              InitialValueType init,
+                              BinaryFunction binary_op)
 {
   using namespace thrust::detail;
 
@@ -265,12 +281,17 @@ OutputIterator exclusive_scan(
   {
     using Body = typename scan_detail::exclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType>;
     Body scan_body(first, result, binary_op, init);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), scan_body);
+    const Size grain = static_cast<Size>(thrust::system::tbb::detail::grain_size(
+      exec,
+      thrust::system::detail::internal::tuning_family::scan,
+      thrust::system::detail::internal::tuning_element_size<InputIterator>::value,
+      static_cast<std::size_t>(n)));
+    thrust::system::tbb::detail::execute(exec, [&] {
+      ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n, grain), scan_body);
+    });
   }
 
-  thrust::advance(result, n);
-
-  return result;
+  return result + n;
 }
 
 } // end namespace detail
@@ -0,0 +1,111 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/bijection_shuffle.h>
+#include <thrust/system/detail/internal/tile_compaction.h>
+#include <thrust/system/detail/internal/tuning_profile.h>
+#include <thrust/system/tbb/detail/arena.h>
+#include <thrust/system/tbb/detail/shuffle.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+template <typename DerivedPolicy, typename RandomIterator, typename URBG>
+void shuffle(execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, URBG&& g)
+{
+  using InputType = typename thrust::iterator_value<RandomIterator>::type;
+
+  // the elements are gathered in a random order, which can't be done in place
+  thrust::detail::temporary_array<InputType, DerivedPolicy> temp(exec, first, last);
+  thrust::system::tbb::detail::shuffle_copy(exec, temp.begin(), temp.end(), first, g);
+} // end shuffle()
+
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename URBG>
+void shuffle_copy(
+  execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, OutputIterator result, URBG&& g)
+{
+  const std::uint64_t n = static_cast<std::uint64_t>(thrust::distance(first, last));
+
+  const thrust::system::detail::internal::bijection_shuffle plan(n, g);
+  const std::size_t size = static_cast<std::size_t>(plan.size());
+
+  // the tiles are fixed up front, as they must be the same when counting and
+  // when writing
+  const std::size_t grain = thrust::system::tbb::detail::grain_size(
+    exec,
+    thrust::system::detail::internal::tuning_family::scan,
+    thrust::system::detail::internal::tuning_element_size<RandomIterator>::value,
+    size);
+  const std::size_t max_tiles = (size + grain - 1) / grain;
+  const std::size_t p         = thrust::system::tbb::detail::concurrency(exec);
+  const std::size_t num_tiles = max_tiles < p ? max_tiles : p;
+
+  thrust::detail::temporary_array<std::size_t, DerivedPolicy> offsets(exec, num_tiles + 1);
+  std::size_t* tile_offsets = thrust::raw_pointer_cast(offsets.data());
+
+  thrust::system::tbb::detail::execute(exec, [&] {
+    ::tbb::parallel_for(::tbb::blocked_range<std::size_t>(0, num_tiles, 1),
+                        [&](const ::tbb::blocked_range<std::size_t>& r) {
+                          for (std::size_t i = r.begin(); i < r.end(); ++i)
+                          {
+                            tile_offsets[i] = static_cast<std::size_t>(
+                              plan.count_tile(size * i / num_tiles, size * (i + 1) / num_tiles));
+                          }
+                        });
+
+    thrust::system::detail::internal::tile_offsets(tile_offsets, num_tiles);
+
+    ::tbb::parallel_for(::tbb::blocked_range<std::size_t>(0, num_tiles, 1),
+                        [&](const ::tbb::blocked_range<std::size_t>& r) {
+                          for (std::size_t i = r.begin(); i < r.end(); ++i)
+                          {
+                            plan.scatter_tile(
+                              first, size * i / num_tiles, size * (i + 1) / num_tiles, result, tile_offsets[i]);
+                          }
+                        });
+  });
+} // end shuffle_copy()
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
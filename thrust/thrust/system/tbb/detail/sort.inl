@@ -28,11 +28,20 @@
 #include <thrust/detail/copy.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/radix_sort.h>
+#include <thrust/system/detail/sequential/sort.h>
+#include <thrust/system/tbb/detail/arena.h>
 
+#include <cstddef>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 #include <tbb/parallel_invoke.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -45,9 +54,6 @@ namespace detail
 namespace sort_detail
 {
 
-// TODO tune this based on data type and comp
-const static int threshold = 128 * 1024;
-
 template <typename DerivedPolicy, typename Iterator1, typename Iterator2, typename StrictWeakOrdering>
 void merge_sort(execution_policy<DerivedPolicy>& exec,
                 Iterator1 first1,
@@ -98,7 +104,12 @@ void merge_sort(execution_policy<DerivedPolicy>& exec,
 
   difference_type n = thrust::distance(first1, last1);
 
-  if (n < threshold)
+  const std::size_t leaf_size = thrust::system::tbb::detail::grain_size(
+    exec,
+    thrust::system::detail::internal::tuning_family::sort,
+    thrust::system::detail::internal::tuning_element_size<Iterator1>::value);
+
+  if (n < static_cast<difference_type>(leaf_size))
   {
     thrust::stable_sort(thrust::seq, first1, last1, comp);
 
@@ -136,9 +147,6 @@ void merge_sort(execution_policy<DerivedPolicy>& exec,
 namespace sort_by_key_detail
 {
 
-// TODO tune this based on data type and comp
-const static int threshold = 128 * 1024;
-
 template <typename DerivedPolicy,
           typename Iterator1,
           typename Iterator2,
@@ -223,7 +231,12 @@ void merge_sort_by_key(
   Iterator2 last2 = first2 + n;
   Iterator3 last3 = first3 + n;
 
-  if (n < threshold)
+  const std::size_t leaf_size = thrust::system::tbb::detail::grain_size(
+    exec,
+    thrust::system::detail::internal::tuning_family::sort,
+    thrust::system::detail::internal::tuning_element_size<Iterator1>::value);
+
+  if (n < static_cast<difference_type>(leaf_size))
   {
     thrust::stable_sort_by_key(thrust::seq, first1, last1, first2, comp);
 
@@ -256,15 +269,302 @@ void merge_sort_by_key(
 
 } // namespace sort_by_key_detail
 
+namespace radix_sort_detail
+{
+
+template <typename Iterator, typename DigitExtractor, typename Size>
+struct histogram_body
+{
+  Iterator keys_first;
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp;
+  DigitExtractor digit;
+  std::size_t* histograms;
+
+  histogram_body(Iterator keys_first,
+                 thrust::system::detail::internal::uniform_decomposition<Size> decomp,
+                 DigitExtractor digit,
+                 std::size_t* histograms)
+      : keys_first(keys_first)
+      , decomp(decomp)
+      , digit(digit)
+      , histograms(histograms)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    namespace radix = thrust::system::detail::internal::radix_sort_detail;
+
+    for (Size i = r.begin(); i != r.end(); ++i)
+    {
+      radix::histogram_tile(
+        keys_first + decomp[i].begin(), keys_first + decomp[i].end(), digit, histograms + i * radix::num_buckets);
+    }
+  }
+};
+
+template <typename Iterator1,
+          typename Iterator2,
+          typename Iterator3,
+          typename Iterator4,
+          typename DigitExtractor,
+          typename HasValues,
+          typename Size>
+struct scatter_body
+{
+  Iterator1 keys_first;
+  Iterator2 values_first;
+  Iterator3 keys_result;
+  Iterator4 values_result;
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp;
+  DigitExtractor digit;
+  std::size_t* offsets;
+
+  scatter_body(Iterator1 keys_first,
+               Iterator2 values_first,
+               Iterator3 keys_result,
+               Iterator4 values_result,
+               thrust::system::detail::internal::uniform_decomposition<Size> decomp,
+               DigitExtractor digit,
+               std::size_t* offsets)
+      : keys_first(keys_first)
+      , values_first(values_first)
+      , keys_result(keys_result)
+      , values_result(values_result)
+      , decomp(decomp)
+      , digit(digit)
+      , offsets(offsets)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r) const
+  {
+    namespace radix = thrust::system::detail::internal::radix_sort_detail;
+
+    for (Size i = r.begin(); i != r.end(); ++i)
+    {
+      radix::scatter_tile(
+        keys_first + decomp[i].begin(),
+        keys_first + decomp[i].end(),
+        values_first + decomp[i].begin(),
+        keys_result,
+        values_result,
+        digit,
+        offsets + i * radix::num_buckets,
+        HasValues());
+    }
+  }
+};
+
+template <typename HasValues,
+          typename Iterator1,
+          typename Iterator2,
+          typename Iterator3,
+          typename Iterator4,
+          typename DigitExtractor,
+          typename Size>
+scatter_body<Iterator1, Iterator2, Iterator3, Iterator4, DigitExtractor, HasValues, Size> make_scatter_body(
+  Iterator1 keys_first,
+  Iterator2 values_first,
+  Iterator3 keys_result,
+  Iterator4 values_result,
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp,
+  DigitExtractor digit,
+  std::size_t* offsets)
+{
+  return scatter_body<Iterator1, Iterator2, Iterator3, Iterator4, DigitExtractor, HasValues, Size>(
+    keys_first, values_first, keys_result, values_result, decomp, digit, offsets);
+}
+
+// sorts [keys1, keys1 + n) and, if HasValues, the corresponding values with an
+// LSD radix sort, using keys2 and vals2 as scratch: every pass histograms each
+// tile, scans the histograms and stably scatters each tile in parallel
+template <bool Descending,
+          typename HasValues,
+          typename DerivedPolicy,
+          typename Iterator1,
+          typename Iterator2,
+          typename Iterator3,
+          typename Iterator4,
+          typename Size>
+void radix_sort(execution_policy<DerivedPolicy>& exec,
+                Iterator1 keys1,
+                Iterator2 keys2,
+                Iterator3 vals1,
+                Iterator4 vals2,
+                Size n)
+{
+  namespace radix = thrust::system::detail::internal::radix_sort_detail;
+
+  using KeyType        = typename thrust::iterator_value<Iterator1>::type;
+  using DigitExtractor = radix::digit_extractor<KeyType, Descending>;
+
+  // one tile per processor
+  const Size p = static_cast<Size>(thrust::system::tbb::detail::concurrency(exec));
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp(n, 1, p);
+
+  const Size num_tiles = decomp.size();
+
+  // one histogram per tile, reused by every pass
+  thrust::detail::temporary_array<std::size_t, DerivedPolicy> histograms(exec, num_tiles * radix::num_buckets);
+  std::size_t* h = thrust::raw_pointer_cast(histograms.data());
+
+  // false if most recent data is stored in (keys1,vals1)
+  bool flip = false;
+
+  for (unsigned int pass = 0; pass < DigitExtractor::num_passes; ++pass)
+  {
+    const DigitExtractor digit(pass);
+
+    // force grainsize == 1 with simple_partioner()
+    if (flip)
+    {
+      ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1),
+                          histogram_body<Iterator2, DigitExtractor, Size>(keys2, decomp, digit, h),
+                          ::tbb::simple_partitioner());
+    }
+    else
+    {
+      ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1),
+                          histogram_body<Iterator1, DigitExtractor, Size>(keys1, decomp, digit, h),
+                          ::tbb::simple_partitioner());
+    }
+
+    if (!radix::scan_histograms(h, num_tiles, n))
+    {
+      continue;
+    }
+
+    if (flip)
+    {
+      ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1),
+                          make_scatter_body<HasValues>(keys2, vals2, keys1, vals1, decomp, digit, h),
+                          ::tbb::simple_partitioner());
+    }
+    else
+    {
+      ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1),
+                          make_scatter_body<HasValues>(keys1, vals1, keys2, vals2, decomp, digit, h),
+                          ::tbb::simple_partitioner());
+    }
+
+    flip = !flip;
+  }
+
+  // ensure final values are in (keys1,vals1)
+  if (flip)
+  {
+    thrust::copy(exec, keys2, keys2 + n, keys1);
+
+    if (HasValues::value)
+    {
+      thrust::copy(exec, vals2, vals2 + n, vals1);
+    }
+  }
+}
+
 template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-void stable_sort(
+void stable_radix_sort(
   execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  using key_type        = typename thrust::iterator_value<RandomAccessIterator>::type;
+  using difference_type = typename thrust::iterator_difference<RandomAccessIterator>::type;
+
+  difference_type n = thrust::distance(first, last);
+
+  const std::size_t cutoff = thrust::system::tbb::detail::serial_cutoff(
+    exec,
+    thrust::system::detail::internal::tuning_family::sort,
+    thrust::system::detail::internal::tuning_element_size<RandomAccessIterator>::value);
+
+  if (n < static_cast<difference_type>(cutoff))
+  {
+    thrust::system::detail::sequential::stable_sort(exec, first, last, comp);
+    return;
+  }
+
+  thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, n);
+
+  // keys stand in for the values when there are none
+  radix_sort<thrust::system::detail::internal::radix_sort_detail::is_descending<key_type, StrictWeakOrdering>::value,
+             thrust::detail::false_type>(exec, first, temp.begin(), first, temp.begin(), n);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void stable_radix_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering comp)
+{
+  using key_type        = typename thrust::iterator_value<RandomAccessIterator1>::type;
+  using val_type        = typename thrust::iterator_value<RandomAccessIterator2>::type;
+  using difference_type = typename thrust::iterator_difference<RandomAccessIterator1>::type;
+
+  difference_type n = thrust::distance(first1, last1);
+
+  const std::size_t cutoff = thrust::system::tbb::detail::serial_cutoff(
+    exec,
+    thrust::system::detail::internal::tuning_family::sort,
+    thrust::system::detail::internal::tuning_element_size<RandomAccessIterator1>::value);
+
+  if (n < static_cast<difference_type>(cutoff))
+  {
+    thrust::system::detail::sequential::stable_sort_by_key(exec, first1, last1, first2, comp);
+    return;
+  }
+
+  thrust::detail::temporary_array<key_type, DerivedPolicy> temp1(exec, n);
+  thrust::detail::temporary_array<val_type, DerivedPolicy> temp2(exec, n);
+
+  radix_sort<thrust::system::detail::internal::radix_sort_detail::is_descending<key_type, StrictWeakOrdering>::value,
+             thrust::detail::true_type>(exec, first1, temp1.begin(), first2, temp2.begin(), n);
+}
+
+} // namespace radix_sort_detail
+
+namespace sort_detail
+{
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::true_type)
+{
+  radix_sort_detail::stable_radix_sort(exec, first, last, comp);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering comp,
+  thrust::detail::true_type)
+{
+  radix_sort_detail::stable_radix_sort_by_key(exec, first1, last1, first2, comp);
+}
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::false_type)
 {
   using key_type = typename thrust::iterator_value<RandomAccessIterator>::type;
 
   thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, first, last);
 
-  sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true);
+  merge_sort(exec, first, last, temp.begin(), comp, true);
 }
 
 template <typename DerivedPolicy,
@@ -276,7 +576,8 @@ void stable_sort_by_key(
   RandomAccessIterator1 first1,
   RandomAccessIterator1 last1,
   RandomAccessIterator2 first2,
-  StrictWeakOrdering comp)
+  StrictWeakOrdering comp,
+  thrust::detail::false_type)
 {
   using key_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
   using val_type = typename thrust::iterator_value<RandomAccessIterator2>::type;
@@ -289,6 +590,41 @@ void stable_sort_by_key(
   sort_by_key_detail::merge_sort_by_key(exec, first1, last1, first2, temp1.begin(), temp2.begin(), comp, true);
 }
 
+} // namespace sort_detail
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void stable_sort(
+  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  using key_type = typename thrust::iterator_value<RandomAccessIterator>::type;
+
+  thrust::system::detail::internal::radix_sort_detail::use_radix_sort<key_type, StrictWeakOrdering> use_radix_sort;
+
+  thrust::system::tbb::detail::execute(exec, [&] {
+    sort_detail::stable_sort(exec, first, last, comp, use_radix_sort);
+  });
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void stable_sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering comp)
+{
+  using key_type = typename thrust::iterator_value<RandomAccessIterator1>::type;
+
+  thrust::system::detail::internal::radix_sort_detail::use_radix_sort<key_type, StrictWeakOrdering> use_radix_sort;
+
+  thrust::system::tbb::detail::execute(exec, [&] {
+    sort_detail::stable_sort_by_key(exec, first1, last1, first2, comp, use_radix_sort);
+  });
+}
+
 } // end namespace detail
 } // end namespace tbb
 } // end namespace system
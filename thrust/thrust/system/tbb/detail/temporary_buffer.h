@@ -25,5 +25,42 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
+#include <thrust/system/cpp/detail/temporary_buffer.h>
 
-// this system has no special temporary buffer functions
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+struct tag;
+struct par_t;
+struct execute_on_arena;
+
+} // namespace detail
+} // namespace tbb
+
+namespace cpp
+{
+namespace detail
+{
+
+// the TBB policies cache temporary storage the way the cpp ones do
+template <>
+struct caches_temporary_buffers<thrust::system::tbb::detail::tag> : thrust::detail::true_type
+{};
+
+template <>
+struct caches_temporary_buffers<thrust::system::tbb::detail::par_t> : thrust::detail::true_type
+{};
+
+template <>
+struct caches_temporary_buffers<thrust::system::tbb::detail::execute_on_arena> : thrust::detail::true_type
+{};
+
+} // namespace detail
+} // namespace cpp
+} // namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,102 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/tuning_profile.h>
+#include <thrust/system/detail/internal/unique_tile.h>
+#include <thrust/system/tbb/detail/arena.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cstddef>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace unique_detail
+{
+
+// The tiles are fixed up front, as they must be the same when counting and
+// when copying. There is at most one per thread.
+template <typename DerivedPolicy, typename RandomAccessIterator>
+thrust::system::detail::internal::uniform_decomposition<std::ptrdiff_t>
+decompose(execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last)
+{
+  const std::ptrdiff_t n = static_cast<std::ptrdiff_t>(last - first);
+
+  const std::size_t grain = thrust::system::tbb::detail::grain_size(
+    exec,
+    thrust::system::detail::internal::tuning_family::scan,
+    thrust::system::detail::internal::tuning_element_size<RandomAccessIterator>::value,
+    static_cast<std::size_t>(n));
+
+  return thrust::system::detail::internal::uniform_decomposition<std::ptrdiff_t>(
+    n,
+    static_cast<std::ptrdiff_t>(grain),
+    static_cast<std::ptrdiff_t>(thrust::system::tbb::detail::concurrency(exec)));
+}
+
+// calls f with the index of each of num_tiles tiles in the arena of exec
+template <typename DerivedPolicy, typename Function>
+void for_each_tile(execution_policy<DerivedPolicy>& exec, std::ptrdiff_t num_tiles, Function f)
+{
+  thrust::system::tbb::detail::execute(exec, [&] {
+    ::tbb::parallel_for(::tbb::blocked_range<std::ptrdiff_t>(0, num_tiles, 1),
+                        [&](const ::tbb::blocked_range<std::ptrdiff_t>& r) {
+                          for (std::ptrdiff_t i = r.begin(); i < r.end(); ++i)
+                          {
+                            f(i);
+                          }
+                        });
+  });
+}
+
+// counts the groups of every tile, which is all unique_count needs
+template <typename DerivedPolicy, typename RandomAccessIterator, typename BinaryPredicate>
+void count_tiles(execution_policy<DerivedPolicy>& exec,
+                 RandomAccessIterator first,
+                 const thrust::system::detail::internal::uniform_decomposition<std::ptrdiff_t>& decomp,
+                 std::ptrdiff_t* tile_counts,
+                 BinaryPredicate binary_pred)
+{
+  unique_detail::for_each_tile(exec, decomp.size(), [&](std::ptrdiff_t i) {
+    tile_counts[i] =
+      thrust::system::detail::internal::count_unique_heads(first, decomp[i].begin(), decomp[i].end(), binary_pred);
+  });
+}
+
+} // end namespace unique_detail
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
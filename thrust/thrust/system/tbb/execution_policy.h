@@ -122,6 +122,11 @@ struct tag : thrust::system::tbb::execution_policy<tag> { unspecified };
  *
  *  The type of \p thrust::tbb::par is implementation-defined.
  *
+ *  \p thrust::tbb::par.on(arena) runs the parallel work of an algorithm in the \p tbb::task_arena
+ *  \p arena, and \p thrust::tbb::par.with_grain(g) never splits off tasks of less than \p g
+ *  elements. The two may be chained and combined with an allocator, as in
+ *  \p thrust::tbb::par(alloc).on(arena).with_grain(g).
+ *
  *  The following code snippet demonstrates how to use \p thrust::tbb::par to explicitly dispatch an
  *  invocation of \p thrust::for_each to the TBB backend system:
  *
@@ -32,6 +32,7 @@
 #include <thrust/detail/type_traits.h>
 #include <thrust/memory.h>
 #include <thrust/mr/allocator.h>
+#include <thrust/system/cpp/memory.h>
 #include <thrust/system/tbb/memory_resource.h>
 
 #include <ostream>
@@ -89,6 +90,11 @@ using allocator = thrust::mr::stateless_resource_allocator<T, thrust::system::tb
 template <typename T>
 using universal_allocator = thrust::mr::stateless_resource_allocator<T, thrust::system::tbb::universal_memory_resource>;
 
+// the tbb algorithms share the temporary storage cache of the cpp system
+using thrust::system::cpp::get_temporary_cache_limit;
+using thrust::system::cpp::release_temporary_cache;
+using thrust::system::cpp::set_temporary_cache_limit;
+
 } // namespace tbb
 } // namespace system
 
@@ -99,7 +105,10 @@ namespace tbb
 {
 using thrust::system::tbb::allocator;
 using thrust::system::tbb::free;
+using thrust::system::tbb::get_temporary_cache_limit;
 using thrust::system::tbb::malloc;
+using thrust::system::tbb::release_temporary_cache;
+using thrust::system::tbb::set_temporary_cache_limit;
 using thrust::system::tbb::universal_allocator;
 } // namespace tbb
 
@@ -0,0 +1,132 @@
+/*
+ *  Copyright 2024 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file tbb/tuning.h
+ *  \brief Cutoffs that decide when the TBB algorithms run in parallel and
+ *         how finely they split their input.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/detail/internal/tuning_calibration.h>
+#include <thrust/system/detail/internal/tuning_profile.h>
+#include <thrust/system/tbb/detail/arena.h>
+#include <thrust/system/tbb/detail/tuning.h>
+#include <thrust/system/tbb/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+
+/*! \addtogroup execution_policies
+ *  \{
+ */
+
+/*! \p tuning_profile holds, for each \p tuning_family of algorithms, the input
+ *  size in bytes below which the algorithms run serially and the smallest
+ *  task in bytes they split off, as well as an upper bound on the number of
+ *  pieces they split their input into.
+ *
+ *  The profile is read at startup from the file the environment variable
+ *  \c THRUST_TBB_TUNING_PROFILE names, if any. Its format is the one
+ *  <tt>operator<<</tt> writes, one setting per line:
+ *
+ *  \code
+ *  max_threads 0
+ *  merge 0 4096
+ *  sort 524288 524288
+ *  \endcode
+ *
+ *  Families the file doesn't mention keep their defaults.
+ *  \p thrust::tbb::par.with_grain takes precedence over the profile, and
+ *  \p thrust::tbb::par.on over its thread limit.
+ */
+using tuning_profile = thrust::system::detail::internal::tuning_profile;
+
+/*! \p tuning_family enumerates the groups of algorithms whose cutoffs are
+ *  tuned together.
+ */
+using tuning_family = thrust::system::detail::internal::tuning_family;
+
+/*! \return The profile the TBB algorithms use when no other is given.
+ */
+inline tuning_profile default_tuning_profile()
+{
+  return detail::default_tuning_profile();
+}
+
+/*! \return The profile the TBB algorithms currently use.
+ */
+inline tuning_profile get_tuning_profile()
+{
+  return detail::tuning_profile_storage();
+}
+
+/*! Replaces the profile the TBB algorithms use.
+ *
+ *  \note Not synchronized with algorithms running concurrently.
+ */
+inline void set_tuning_profile(const tuning_profile& profile)
+{
+  detail::tuning_profile_storage() = profile;
+}
+
+/*! Times each family of TBB algorithms against its serial version on
+ *  inputs of up to a few megabytes and derives a profile from where the
+ *  parallel version starts to win. The profile in effect is left alone; pass
+ *  the result to \p set_tuning_profile, or write it to the file
+ *  \c THRUST_TBB_TUNING_PROFILE names, to use it.
+ *
+ *  \return The measured profile.
+ *  \note Takes on the order of seconds and must not run concurrently with
+ *        other TBB algorithms.
+ */
+inline tuning_profile calibrate_tuning_profile()
+{
+  detail::par_t par;
+
+  return thrust::system::detail::internal::calibrate_tuning_profile(
+    par, detail::tuning_profile_storage(), detail::default_tuning_profile(), detail::concurrency(par));
+}
+
+/*! \}
+ */
+
+} // namespace tbb
+} // namespace system
+
+namespace tbb
+{
+using thrust::system::tbb::calibrate_tuning_profile;
+using thrust::system::tbb::default_tuning_profile;
+using thrust::system::tbb::get_tuning_profile;
+using thrust::system::tbb::set_tuning_profile;
+using thrust::system::tbb::tuning_family;
+using thrust::system::tbb::tuning_profile;
+} // namespace tbb
+
+THRUST_NAMESPACE_END